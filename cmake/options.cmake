@@ -47,6 +47,8 @@ else()
 endif()
 option(WITH_WARNINGS    "Show all warnings during compile"                            0)
 option(WITH_COREDEBUG   "Include additional debug-code in core"                       0)
+set(WITH_LOG_LEVEL_MIN  "trace" CACHE STRING "Remove TC_LOG_* calls below this level at compile time")
+set_property(CACHE WITH_LOG_LEVEL_MIN PROPERTY STRINGS trace debug info warn error fatal)
 set(WITH_SOURCE_TREE    "hierarchical" CACHE STRING "Build the source tree for IDE's.")
 set_property(CACHE WITH_SOURCE_TREE PROPERTY STRINGS no flat hierarchical hierarchical-folders)
 option(WITHOUT_GIT      "Disable the GIT testing routines"                            0)
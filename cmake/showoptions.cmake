@@ -76,6 +76,14 @@ else()
   message("* Use coreside debug     : No  (default)")
 endif()
 
+if(NOT WITH_LOG_LEVEL_MIN STREQUAL "trace")
+  message("* Lowest compiled log    : ${WITH_LOG_LEVEL_MIN}")
+  string(TOUPPER "${WITH_LOG_LEVEL_MIN}" LOG_LEVEL_MIN_UPPER)
+  add_definitions(-DTRINITY_LOG_MIN_LEVEL=LOG_LEVEL_${LOG_LEVEL_MIN_UPPER})
+else()
+  message("* Lowest compiled log    : trace (default)")
+endif()
+
 if(NOT WITH_SOURCE_TREE STREQUAL "no")
   message("* Show source tree       : Yes (${WITH_SOURCE_TREE})")
 else()
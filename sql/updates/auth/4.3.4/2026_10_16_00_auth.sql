@@ -0,0 +1,6 @@
+DELETE FROM `rbac_permissions` WHERE `id`=874;
+INSERT INTO `rbac_permissions` (`id`, `name`) VALUES
+(874, 'Command: server profile');
+DELETE FROM `rbac_linked_permissions` WHERE `linkedId`=874;
+INSERT INTO `rbac_linked_permissions` (`id`, `linkedId`) VALUES
+(196, 874);
@@ -0,0 +1,4 @@
+DELETE FROM `command` WHERE `name` IN ('server profile', 'server profile dump');
+INSERT INTO `command` (`name`, `permission`, `help`) VALUES
+('server profile', 874, 'Syntax: .server profile [#mapId [#instanceId]]\n\nShows average and maximum duration of every world update phase over the last ticks and the slowest maps. When #mapId is given, shows update phases of all instances of that map (or only of #instanceId).'),
+('server profile dump', 874, 'Syntax: .server profile dump [$fileName]\n\nWrites the recorded update phases of the world and all maps as a Chrome trace (chrome://tracing, Perfetto) to $fileName (default tick_profile.json) in the logs directory.');
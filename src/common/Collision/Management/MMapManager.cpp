@@ -20,18 +20,134 @@
 #include "Log.h"
 #include "MMapFactory.h"
 #include "MMapDefines.h"
+#include "Metric.h"
+#include <algorithm>
+#include <utility>
 
 namespace MMAP
 {
     static char const* const MAP_FILE_NAME_FORMAT = "%smmaps/%03i.mmap";
     static char const* const TILE_FILE_NAME_FORMAT = "%smmaps/%03i%02i%02i.mmtile";
 
+    // ######################## NavMeshQueryHandle ########################
+    NavMeshQueryHandle::NavMeshQueryHandle(NavMeshQueryHandle&& right) noexcept : _data(std::move(right._data)), _query(std::exchange(right._query, nullptr))
+    {
+    }
+
+    NavMeshQueryHandle& NavMeshQueryHandle::operator=(NavMeshQueryHandle&& right) noexcept
+    {
+        if (this != &right)
+        {
+            Release();
+            _data = std::move(right._data);
+            _query = std::exchange(right._query, nullptr);
+        }
+
+        return *this;
+    }
+
+    void NavMeshQueryHandle::Release()
+    {
+        if (_query)
+        {
+            std::lock_guard<std::mutex> lock(_data->navMeshQueryPoolLock);
+            _data->navMeshQueryPool.push_back(_query);
+            _query = nullptr;
+        }
+
+        _data = nullptr;
+    }
+
+    // ######################## NavMeshPathCache ########################
+    uint32 NavMeshPathCache::Find(Key const& key, dtPolyRef* path, uint32 maxPath)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if (CachedPath const* cached = _paths.find(key))
+        {
+            if (cached->Polys.size() <= maxPath)
+            {
+                std::copy(cached->Polys.begin(), cached->Polys.end(), path);
+                ++_stats.Hits;
+                _stats.SavedMicroseconds += cached->SearchTime.count();
+                TC_METRIC_COUNTER("mmap_path_cache_hits", 1);
+                TC_METRIC_COUNTER("mmap_path_cache_saved_us", cached->SearchTime.count());
+                return uint32(cached->Polys.size());
+            }
+        }
+
+        // a part of a shortest path is a shortest path too, units chasing the same target often start on the path of another one
+        uint32 candidates = 0;
+        for (auto const& [cachedKey, cached] : _paths)
+        {
+            if (++candidates > SubPathCandidates)
+                break;
+
+            if (cachedKey.IncludeFlags != key.IncludeFlags || cachedKey.ExcludeFlags != key.ExcludeFlags)
+                continue;
+
+            auto start = std::find(cached.Polys.begin(), cached.Polys.end(), key.StartPoly);
+            if (start == cached.Polys.end())
+                continue;
+
+            auto end = std::find(start, cached.Polys.end(), key.EndPoly);
+            if (end == cached.Polys.end())
+                continue;
+
+            uint32 pathSize = uint32(std::distance(start, end) + 1);
+            if (pathSize > maxPath)
+                continue;
+
+            std::copy(start, end + 1, path);
+            uint64 savedMicroseconds = uint64(cached.SearchTime.count()) * pathSize / cached.Polys.size();
+            ++_stats.Hits;
+            _stats.SavedMicroseconds += savedMicroseconds;
+            TC_METRIC_COUNTER("mmap_path_cache_hits", 1);
+            TC_METRIC_COUNTER("mmap_path_cache_saved_us", savedMicroseconds);
+            return pathSize;
+        }
+
+        ++_stats.Misses;
+        TC_METRIC_COUNTER("mmap_path_cache_misses", 1);
+        return 0;
+    }
+
+    void NavMeshPathCache::Insert(Key const& key, dtPolyRef const* path, uint32 pathSize, std::chrono::microseconds searchTime, uint32 generation)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if (generation != _generation)
+            return;
+
+        _paths.insert(key, { std::vector<dtPolyRef>(path, path + pathSize), searchTime });
+    }
+
+    uint32 NavMeshPathCache::GetGeneration() const
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        return _generation;
+    }
+
+    void NavMeshPathCache::Invalidate()
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _paths.clear();
+        ++_generation;
+    }
+
+    std::size_t NavMeshPathCache::GetSize() const
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        return _paths.size();
+    }
+
+    NavMeshPathCache::Stats NavMeshPathCache::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        return _stats;
+    }
+
     // ######################## MMapManager ########################
     MMapManager::~MMapManager()
     {
-        for (MMapDataSet::iterator i = loadedMMaps.begin(); i != loadedMMaps.end(); ++i)
-            delete i->second;
-
         // by now we should not have maps loaded
         // if we had, tiles in MMapData->mmapLoadedTiles, their actual data is lost!
     }
@@ -106,9 +222,7 @@ namespace MMAP
         TC_LOG_DEBUG("maps", "MMAP:loadMapData: Loaded %03i.mmap", mapId);
 
         // store inside our map list
-        MMapData* mmap_data = new MMapData(mesh);
-
-        itr->second = mmap_data;
+        itr->second = std::make_shared<MMapData>(mesh, pathCacheSize);
         return true;
     }
 
@@ -124,7 +238,7 @@ namespace MMAP
             return false;
 
         // get this mmap data
-        MMapData* mmap = loadedMMaps[mapId];
+        MMapData* mmap = loadedMMaps[mapId].get();
         ASSERT(mmap->navMesh);
 
         // check if we already have this tile loaded
@@ -196,8 +310,18 @@ namespace MMAP
         dtTileRef tileRef = 0;
 
         // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
-        if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
+        dtStatus addResult;
+        {
+            std::unique_lock<std::shared_mutex> lock(mmap->navMeshLock);
+            addResult = mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef);
+        }
+
+        if (dtStatusSucceed(addResult))
         {
+            // cached paths may now have shorter alternatives through the new tile
+            if (mmap->pathCache)
+                mmap->pathCache->Invalidate();
+
             mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
             ++loadedTiles;
             TC_LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile %03i[%02i, %02i] into %03i[%02i, %02i]", mapId, x, y, mapId, header->x, header->y);
@@ -213,27 +337,11 @@ namespace MMAP
 
     bool MMapManager::loadMapInstance(std::string const& basePath, uint32 meshMapId, uint32 instanceMapId, uint32 instanceId)
     {
+        // queries are taken from the pool of the navmesh when searching it, instances only need the navmesh loaded
         if (!loadMapData(basePath, meshMapId))
             return false;
 
-        MMapData* mmap = loadedMMaps[meshMapId];
-        auto [queryItr, inserted] = mmap->navMeshQueries.try_emplace({ instanceMapId, instanceId }, nullptr);
-        if (!inserted)
-            return true;
-
-        // allocate mesh query
-        dtNavMeshQuery* query = dtAllocNavMeshQuery();
-        ASSERT(query);
-        if (dtStatusFailed(query->init(mmap->navMesh, 1024)))
-        {
-            dtFreeNavMeshQuery(query);
-            mmap->navMeshQueries.erase(queryItr);
-            TC_LOG_ERROR("maps", "MMAP:GetNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId %03u instanceId %u", instanceMapId, instanceId);
-            return false;
-        }
-
-        TC_LOG_DEBUG("maps", "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId %03u instanceId %u", instanceMapId, instanceId);
-        queryItr->second = query;
+        TC_LOG_DEBUG("maps", "MMAP:loadMapInstance: Loaded navmesh %03u for mapId %03u instanceId %u", meshMapId, instanceMapId, instanceId);
         return true;
     }
 
@@ -248,7 +356,7 @@ namespace MMAP
             return false;
         }
 
-        MMapData* mmap = itr->second;
+        MMapData* mmap = itr->second.get();
 
         // check if we have this tile loaded
         uint32 packedGridPos = packTileID(x, y);
@@ -261,7 +369,13 @@ namespace MMAP
         }
 
         // unload, and mark as non loaded
-        if (dtStatusFailed(mmap->navMesh->removeTile(tileRefItr->second, nullptr, nullptr)))
+        dtStatus removeResult;
+        {
+            std::unique_lock<std::shared_mutex> lock(mmap->navMeshLock);
+            removeResult = mmap->navMesh->removeTile(tileRefItr->second, nullptr, nullptr);
+        }
+
+        if (dtStatusFailed(removeResult))
         {
             // this is technically a memory leak
             // if the grid is later reloaded, dtNavMesh::addTile will return error but no extra memory is used
@@ -271,6 +385,9 @@ namespace MMAP
         }
         else
         {
+            if (mmap->pathCache)
+                mmap->pathCache->Invalidate();
+
             mmap->loadedTileRefs.erase(tileRefItr);
             --loadedTiles;
             TC_LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile %04i[%02i, %02i] from %03i", mapId, x, y, mapId);
@@ -291,7 +408,8 @@ namespace MMAP
         }
 
         // unload all tiles from given map
-        MMapData* mmap = itr->second;
+        MMapData* mmap = itr->second.get();
+        std::unique_lock<std::shared_mutex> lock(mmap->navMeshLock);
         for (MMapTileSet::iterator i = mmap->loadedTileRefs.begin(); i != mmap->loadedTileRefs.end(); ++i)
         {
             uint32 x = (i->first >> 16);
@@ -305,7 +423,12 @@ namespace MMAP
             }
         }
 
-        delete mmap;
+        // navmesh queries still in use keep the (now empty) navmesh alive until they are returned
+        mmap->loadedTileRefs.clear();
+        if (mmap->pathCache)
+            mmap->pathCache->Invalidate();
+
+        lock.unlock();
         itr->second = nullptr;
         TC_LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded %03i.mmap", mapId);
 
@@ -323,16 +446,7 @@ namespace MMAP
             return false;
         }
 
-        MMapData* mmap = itr->second;
-        auto queryItr = mmap->navMeshQueries.find({ instanceMapId, instanceId });
-        if (queryItr == mmap->navMeshQueries.end())
-        {
-            TC_LOG_DEBUG("maps", "MMAP:unloadMapInstance: Asked to unload not loaded dtNavMeshQuery mapId %03u instanceId %u", instanceMapId, instanceId);
-            return false;
-        }
-
-        dtFreeNavMeshQuery(queryItr->second);
-        mmap->navMeshQueries.erase(queryItr);
+        // nothing is held per instance, the navmesh stays loaded until the map is unloaded
         TC_LOG_DEBUG("maps", "MMAP:unloadMapInstance: Unloaded mapId %03u instanceId %u", instanceMapId, instanceId);
 
         return true;
@@ -347,16 +461,47 @@ namespace MMAP
         return itr->second->navMesh;
     }
 
-    dtNavMeshQuery const* MMapManager::GetNavMeshQuery(uint32 meshMapId, uint32 instanceMapId, uint32 instanceId)
+    NavMeshPathCache const* MMapManager::GetPathCache(uint32 mapId)
     {
-        auto itr = GetMMapData(meshMapId);
+        MMapDataSet::const_iterator itr = GetMMapData(mapId);
         if (itr == loadedMMaps.end())
             return nullptr;
 
-        auto queryItr = itr->second->navMeshQueries.find({ instanceMapId, instanceId });
-        if (queryItr == itr->second->navMeshQueries.end())
-            return nullptr;
+        return itr->second->pathCache.get();
+    }
+
+    NavMeshQueryHandle MMapManager::AcquireNavMeshQuery(uint32 meshMapId)
+    {
+        auto itr = GetMMapData(meshMapId);
+        if (itr == loadedMMaps.end())
+            return {};
+
+        std::shared_ptr<MMapData> const& mmap = itr->second;
+        dtNavMeshQuery* query = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mmap->navMeshQueryPoolLock);
+            if (!mmap->navMeshQueryPool.empty())
+            {
+                query = mmap->navMeshQueryPool.back();
+                mmap->navMeshQueryPool.pop_back();
+            }
+        }
+
+        if (!query)
+        {
+            // allocate mesh query
+            query = dtAllocNavMeshQuery();
+            ASSERT(query);
+            if (dtStatusFailed(query->init(mmap->navMesh, 1024)))
+            {
+                dtFreeNavMeshQuery(query);
+                TC_LOG_ERROR("maps", "MMAP:AcquireNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId %03u", meshMapId);
+                return {};
+            }
+
+            TC_LOG_DEBUG("maps", "MMAP:AcquireNavMeshQuery: created dtNavMeshQuery for mapId %03u", meshMapId);
+        }
 
-        return queryItr->second;
+        return { mmap, query };
     }
 }
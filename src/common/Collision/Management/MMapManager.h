@@ -22,6 +22,11 @@
 #include "DetourNavMesh.h"
 #include "DetourNavMeshQuery.h"
 #include "Hash.h"
+#include "LruCache.h"
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -30,50 +35,157 @@
 namespace MMAP
 {
     typedef std::unordered_map<uint32, dtTileRef> MMapTileSet;
-    typedef std::unordered_map<std::pair<uint32, uint32>, dtNavMeshQuery*> NavMeshQuerySet;
+
+    // poly paths recently found on a navmesh, keyed by start and end polygon and query filter
+    // poly refs change when tiles are added or removed, the cache is invalidated then
+    class TC_COMMON_API NavMeshPathCache
+    {
+        public:
+            struct Key
+            {
+                dtPolyRef StartPoly;
+                dtPolyRef EndPoly;
+                uint16 IncludeFlags;
+                uint16 ExcludeFlags;
+
+                bool operator==(Key const& right) const = default;
+            };
+
+            struct KeyHash
+            {
+                std::size_t operator()(Key const& key) const
+                {
+                    std::size_t hashVal = 0;
+                    Trinity::hash_combine(hashVal, key.StartPoly);
+                    Trinity::hash_combine(hashVal, key.EndPoly);
+                    Trinity::hash_combine(hashVal, key.IncludeFlags);
+                    Trinity::hash_combine(hashVal, key.ExcludeFlags);
+                    return hashVal;
+                }
+            };
+
+            struct Stats
+            {
+                uint64 Hits = 0;
+                uint64 Misses = 0;
+                uint64 SavedMicroseconds = 0;
+            };
+
+            explicit NavMeshPathCache(std::size_t capacity) : _paths(capacity), _generation(0) { }
+
+            // copies the cached path from start to end poly, or the part of a recently cached path passing both of them
+            // returns the number of polygons copied to path, 0 if nothing was found
+            uint32 Find(Key const& key, dtPolyRef* path, uint32 maxPath);
+
+            // generation must be taken before searching the path, paths found before an invalidation are dropped
+            void Insert(Key const& key, dtPolyRef const* path, uint32 pathSize, std::chrono::microseconds searchTime, uint32 generation);
+            uint32 GetGeneration() const;
+            void Invalidate();
+
+            std::size_t GetSize() const;
+            Stats GetStats() const;
+
+        private:
+            struct CachedPath
+            {
+                std::vector<dtPolyRef> Polys;
+                std::chrono::microseconds SearchTime;
+            };
+
+            // number of most recently used paths checked for a part from start to end poly
+            static constexpr uint32 SubPathCandidates = 16;
+
+            Trinity::Containers::LruCache<Key, CachedPath, KeyHash> _paths;
+            uint32 _generation;
+            Stats _stats;
+            mutable std::mutex _lock;
+    };
 
     // dummy struct to hold map's mmap data
     struct TC_COMMON_API MMapData
     {
-        MMapData(dtNavMesh* mesh) : navMesh(mesh) { }
+        MMapData(dtNavMesh* mesh, uint32 pathCacheSize) : navMesh(mesh)
+        {
+            if (pathCacheSize)
+                pathCache = std::make_unique<NavMeshPathCache>(pathCacheSize);
+        }
         ~MMapData()
         {
-            for (NavMeshQuerySet::iterator i = navMeshQueries.begin(); i != navMeshQueries.end(); ++i)
-                dtFreeNavMeshQuery(i->second);
+            for (dtNavMeshQuery* query : navMeshQueryPool)
+                dtFreeNavMeshQuery(query);
 
             if (navMesh)
                 dtFreeNavMesh(navMesh);
         }
 
-        // we have to use single dtNavMeshQuery for every instance, since those are not thread safe
-        NavMeshQuerySet navMeshQueries;     // instanceId to query
+        // dtNavMeshQuery is not thread safe, every thread searching the navmesh takes its own from the pool
+        std::vector<dtNavMeshQuery*> navMeshQueryPool;
+        std::mutex navMeshQueryPoolLock;
 
         dtNavMesh* navMesh;
 
+        // held shared while searching, tiles are only added and removed while holding it exclusively
+        std::shared_mutex navMeshLock;
+
         MMapTileSet loadedTileRefs;        // maps [map grid coords] to [dtTile]
+
+        std::unique_ptr<NavMeshPathCache> pathCache;    // nullptr if disabled
     };
 
+    typedef std::unordered_map<uint32, std::shared_ptr<MMapData>> MMapDataSet;
 
-    typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
+    // exclusive use of a dtNavMeshQuery from the pool of a map, returned to the pool when destroyed
+    // keeps the navmesh alive even if the map is unloaded meanwhile
+    class TC_COMMON_API NavMeshQueryHandle
+    {
+        public:
+            NavMeshQueryHandle() : _query(nullptr) { }
+            NavMeshQueryHandle(std::shared_ptr<MMapData> data, dtNavMeshQuery* query) : _data(std::move(data)), _query(query) { }
+            ~NavMeshQueryHandle() { Release(); }
+
+            NavMeshQueryHandle(NavMeshQueryHandle const& right) = delete;
+            NavMeshQueryHandle(NavMeshQueryHandle&& right) noexcept;
+            NavMeshQueryHandle& operator=(NavMeshQueryHandle const& right) = delete;
+            NavMeshQueryHandle& operator=(NavMeshQueryHandle&& right) noexcept;
+
+            dtNavMeshQuery const* get() const { return _query; }
+            dtNavMeshQuery const* operator->() const { return _query; }
+            explicit operator bool() const { return _query != nullptr; }
+
+            // nullptr if disabled
+            NavMeshPathCache* GetPathCache() const { return _data->pathCache.get(); }
+
+            // must be held while using the query, grids of the same nav mesh may be loaded by other threads meanwhile
+            std::shared_lock<std::shared_mutex> LockNavMesh() const { return std::shared_lock<std::shared_mutex>(_data->navMeshLock); }
+
+        private:
+            void Release();
+
+            std::shared_ptr<MMapData> _data;
+            dtNavMeshQuery* _query;
+    };
 
     // singleton class
     // holds all all access to mmap loading unloading and meshes
     class TC_COMMON_API MMapManager
     {
         public:
-            MMapManager() : loadedTiles(0), thread_safe_environment(true) {}
+            MMapManager() : loadedTiles(0), thread_safe_environment(true), pathCacheSize(0) {}
             ~MMapManager();
 
             void InitializeThreadUnsafe(std::unordered_map<uint32, std::vector<uint32>> const& mapData);
+            // number of poly paths cached per navmesh, applies to navmeshes loaded afterwards
+            void SetPathCacheSize(uint32 size) { pathCacheSize = size; }
             bool loadMap(std::string const& basePath, uint32 mapId, int32 x, int32 y);
             bool loadMapInstance(std::string const& basePath, uint32 meshMapId, uint32 instanceMapId, uint32 instanceId);
             bool unloadMap(uint32 mapId, int32 x, int32 y);
             bool unloadMap(uint32 mapId);
             bool unloadMapInstance(uint32 meshMapId, uint32 instanceMapId, uint32 instanceId);
 
-            // the returned [dtNavMeshQuery const*] is NOT threadsafe
-            dtNavMeshQuery const* GetNavMeshQuery(uint32 meshMapId, uint32 instanceMapId, uint32 instanceId);
+            // takes a query from the pool of the map, like loading and unloading maps this is only done from map updates
+            NavMeshQueryHandle AcquireNavMeshQuery(uint32 meshMapId);
             dtNavMesh const* GetNavMesh(uint32 mapId);
+            NavMeshPathCache const* GetPathCache(uint32 mapId);
 
             uint32 getLoadedTilesCount() const { return loadedTiles; }
             uint32 getLoadedMapsCount() const { return uint32(loadedMMaps.size()); }
@@ -85,6 +197,7 @@ namespace MMAP
             MMapDataSet loadedMMaps;
             uint32 loadedTiles;
             bool thread_safe_environment;
+            uint32 pathCacheSize;
 
             std::unordered_map<uint32, uint32> parentMapData;
     };
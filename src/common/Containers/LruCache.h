@@ -0,0 +1,112 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LRU_CACHE_H
+#define TRINITYCORE_LRU_CACHE_H
+
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace Trinity::Containers
+{
+/**
+ * Hash map holding at most capacity entries, inserting into a full cache evicts the least recently used entry.
+ * Iteration visits entries from the most to the least recently used one.
+ * Not thread safe.
+ */
+template <class Key, class Value, class Hash = std::hash<Key>>
+class LruCache
+{
+public:
+    using EntryList = std::list<std::pair<Key const, Value>>;
+    using iterator = typename EntryList::iterator;
+    using const_iterator = typename EntryList::const_iterator;
+
+    explicit LruCache(std::size_t capacity) : _capacity(capacity) { }
+
+    LruCache(LruCache const&) = delete;
+    LruCache& operator=(LruCache const&) = delete;
+
+    bool empty() const { return _entries.empty(); }
+    std::size_t size() const { return _index.size(); }
+    std::size_t capacity() const { return _capacity; }
+
+    iterator begin() { return _entries.begin(); }
+    const_iterator begin() const { return _entries.begin(); }
+
+    iterator end() { return _entries.end(); }
+    const_iterator end() const { return _entries.end(); }
+
+    // marks the entry as most recently used, nullptr if not cached
+    Value* find(Key const& key)
+    {
+        auto itr = _index.find(key);
+        if (itr == _index.end())
+            return nullptr;
+
+        _entries.splice(_entries.begin(), _entries, itr->second);
+        return &itr->second->second;
+    }
+
+    // replaces the value if key is already cached
+    Value& insert(Key const& key, Value value)
+    {
+        auto itr = _index.find(key);
+        if (itr != _index.end())
+        {
+            _entries.splice(_entries.begin(), _entries, itr->second);
+            itr->second->second = std::move(value);
+            return itr->second->second;
+        }
+
+        if (_index.size() >= _capacity && !_entries.empty())
+        {
+            _index.erase(_entries.back().first);
+            _entries.pop_back();
+        }
+
+        _entries.emplace_front(key, std::move(value));
+        _index.emplace(key, _entries.begin());
+        return _entries.front().second;
+    }
+
+    bool erase(Key const& key)
+    {
+        auto itr = _index.find(key);
+        if (itr == _index.end())
+            return false;
+
+        _entries.erase(itr->second);
+        _index.erase(itr);
+        return true;
+    }
+
+    void clear()
+    {
+        _index.clear();
+        _entries.clear();
+    }
+
+private:
+    EntryList _entries;
+    std::unordered_map<Key, iterator, Hash> _index;
+    std::size_t _capacity;
+};
+}
+
+#endif // TRINITYCORE_LRU_CACHE_H
@@ -0,0 +1,108 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RcuMap.h"
+#include <algorithm>
+
+namespace
+{
+struct ReaderSlot
+{
+    // epoch the owning thread entered its read section in, 0 outside of it
+    std::atomic<uint64> Epoch{ 0 };
+    std::atomic<bool> InUse{ true };
+    ReaderSlot* Next = nullptr;
+    // nested read sections, only used by the owning thread
+    uint32 Depth = 0;
+};
+
+std::atomic<uint64> CurrentEpoch(1);
+
+// slots are never freed, a thread that exits leaves its slot to the next new thread
+std::atomic<ReaderSlot*> ReaderSlots(nullptr);
+
+ReaderSlot* AcquireSlot()
+{
+    for (ReaderSlot* slot = ReaderSlots.load(std::memory_order_acquire); slot; slot = slot->Next)
+    {
+        bool inUse = false;
+        if (!slot->InUse.load(std::memory_order_relaxed) && slot->InUse.compare_exchange_strong(inUse, true, std::memory_order_acquire))
+            return slot;
+    }
+
+    ReaderSlot* slot = new ReaderSlot();
+    slot->Next = ReaderSlots.load(std::memory_order_relaxed);
+    while (!ReaderSlots.compare_exchange_weak(slot->Next, slot, std::memory_order_release, std::memory_order_relaxed))
+        ;
+
+    return slot;
+}
+
+struct ThreadReaderSlot
+{
+    ThreadReaderSlot() : Slot(AcquireSlot()) { }
+    ~ThreadReaderSlot() { Slot->InUse.store(false, std::memory_order_release); }
+
+    ReaderSlot* Slot;
+};
+
+thread_local ThreadReaderSlot CurrentThreadSlot;
+}
+
+namespace Trinity::Containers
+{
+RcuEpoch::ReadGuard::ReadGuard()
+{
+    ReaderSlot* slot = CurrentThreadSlot.Slot;
+    if (slot->Depth++ == 0)
+    {
+        // an older epoch only delays reclamation, the fence orders the store before every load of the read section
+        slot->Epoch.store(CurrentEpoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+RcuEpoch::ReadGuard::~ReadGuard()
+{
+    ReaderSlot* slot = CurrentThreadSlot.Slot;
+    if (--slot->Depth == 0)
+        slot->Epoch.store(0, std::memory_order_release);
+}
+
+uint64 RcuEpoch::GetCurrent()
+{
+    return CurrentEpoch.load(std::memory_order_seq_cst);
+}
+
+void RcuEpoch::Advance()
+{
+    CurrentEpoch.fetch_add(1, std::memory_order_seq_cst);
+}
+
+uint64 RcuEpoch::GetSafe()
+{
+    // pairs with the fence of ReadGuard, a reader that can see unlinked memory has already published its epoch
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    uint64 safeEpoch = CurrentEpoch.load(std::memory_order_seq_cst);
+    for (ReaderSlot* slot = ReaderSlots.load(std::memory_order_acquire); slot; slot = slot->Next)
+        if (uint64 epoch = slot->Epoch.load(std::memory_order_acquire))
+            safeEpoch = std::min(safeEpoch, epoch);
+
+    return safeEpoch;
+}
+}
@@ -0,0 +1,255 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_RCU_MAP_H
+#define TRINITYCORE_RCU_MAP_H
+
+#include "Define.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Trinity::Containers
+{
+/**
+ * Epoch based grace periods for memory shared with lock free readers.
+ * Every reader thread publishes the epoch it entered its read section in, memory retired in an epoch
+ * can be freed once no reader is inside that epoch or an older one.
+ */
+class TC_COMMON_API RcuEpoch
+{
+public:
+    // marks the calling thread as reading until destroyed, can be nested
+    class TC_COMMON_API ReadGuard
+    {
+    public:
+        ReadGuard();
+        ~ReadGuard();
+
+        ReadGuard(ReadGuard const&) = delete;
+        ReadGuard& operator=(ReadGuard const&) = delete;
+    };
+
+    // epoch to record with memory that was just unlinked
+    static uint64 GetCurrent();
+
+    // starts a new epoch, called after retiring memory
+    static void Advance();
+
+    // memory retired in an epoch older than this can no longer be reached by any reader
+    static uint64 GetSafe();
+};
+
+/**
+ * Hash map for read mostly data shared between threads.
+ * Readers never lock or write memory shared with other threads, they only publish their epoch in a slot of their own.
+ * Writers must be serialized by the caller. Each bucket is an immutable chain, a modification copies the nodes in front
+ * of the changed one and publishes the new chain, growing the table copies every node once.
+ * Replaced nodes and tables are freed by ReclaimRetired() after every reader that could still see them has left.
+ */
+template <class Key, class Value, class Hash = std::hash<Key>>
+class RcuMap
+{
+    struct Node
+    {
+        Key NodeKey;
+        Value NodeValue;
+        Node const* Next;
+    };
+
+    struct Table
+    {
+        explicit Table(std::size_t bucketCount) : Buckets(new std::atomic<Node const*>[bucketCount]()), BucketCount(bucketCount) { }
+
+        ~Table()
+        {
+            for (std::size_t i = 0; i < BucketCount; ++i)
+            {
+                for (Node const* node = Buckets[i].load(std::memory_order_relaxed); node;)
+                {
+                    Node const* next = node->Next;
+                    delete node;
+                    node = next;
+                }
+            }
+        }
+
+        std::atomic<Node const*>& GetBucket(Key const& key) { return Buckets[Hash()(key) & (BucketCount - 1)]; }
+        std::atomic<Node const*> const& GetBucket(Key const& key) const { return Buckets[Hash()(key) & (BucketCount - 1)]; }
+
+        std::unique_ptr<std::atomic<Node const*>[]> Buckets;
+        std::size_t BucketCount;
+    };
+
+    struct RetiredMemory
+    {
+        uint64 Epoch;
+        Node const* RetiredNode;
+        Table const* RetiredTable;
+    };
+
+    static constexpr std::size_t InitialBucketCount = 64;
+
+public:
+    RcuMap() : _table(new Table(InitialBucketCount)), _size(0) { }
+    ~RcuMap()
+    {
+        for (RetiredMemory const& retired : _retired)
+            Free(retired);
+
+        delete _table.load(std::memory_order_relaxed);
+    }
+
+    RcuMap(RcuMap const&) = delete;
+    RcuMap& operator=(RcuMap const&) = delete;
+
+    // lock free, never waits for writers
+    Value Find(Key const& key, Value notFound = Value()) const
+    {
+        RcuEpoch::ReadGuard guard;
+        Table const* table = _table.load(std::memory_order_acquire);
+        for (Node const* node = table->GetBucket(key).load(std::memory_order_acquire); node; node = node->Next)
+            if (node->NodeKey == key)
+                return node->NodeValue;
+
+        return notFound;
+    }
+
+    void Insert(Key const& key, Value const& value)
+    {
+        Table* table = _table.load(std::memory_order_relaxed);
+        Node const* head = table->GetBucket(key).load(std::memory_order_relaxed);
+        for (Node const* node = head; node; node = node->Next)
+        {
+            if (node->NodeKey == key)
+            {
+                ReplaceInChain(table->GetBucket(key), head, node, new Node{ key, value, node->Next });
+                return;
+            }
+        }
+
+        if (_size >= table->BucketCount)
+        {
+            table = Grow();
+            head = table->GetBucket(key).load(std::memory_order_relaxed);
+        }
+
+        table->GetBucket(key).store(new Node{ key, value, head }, std::memory_order_release);
+        ++_size;
+    }
+
+    bool Erase(Key const& key)
+    {
+        Table* table = _table.load(std::memory_order_relaxed);
+        Node const* head = table->GetBucket(key).load(std::memory_order_relaxed);
+        for (Node const* node = head; node; node = node->Next)
+        {
+            if (node->NodeKey == key)
+            {
+                ReplaceInChain(table->GetBucket(key), head, node, node->Next);
+                --_size;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::size_t GetSize() const { return _size; }
+
+    // frees replaced nodes and tables no reader can reach anymore, can be called at any time by the writer
+    void ReclaimRetired()
+    {
+        if (_retired.empty())
+            return;
+
+        uint64 safeEpoch = RcuEpoch::GetSafe();
+        auto kept = _retired.begin();
+        for (RetiredMemory const& retired : _retired)
+        {
+            if (retired.Epoch < safeEpoch)
+                Free(retired);
+            else
+                *kept++ = retired;
+        }
+
+        _retired.erase(kept, _retired.end());
+    }
+
+    std::size_t GetRetiredCount() const { return _retired.size(); }
+
+private:
+    // publishes a copy of the nodes in front of target followed by tail, then retires the replaced nodes
+    void ReplaceInChain(std::atomic<Node const*>& bucket, Node const* head, Node const* target, Node const* tail)
+    {
+        bucket.store(CopyChain(head, target, tail), std::memory_order_release);
+
+        uint64 epoch = RcuEpoch::GetCurrent();
+        for (Node const* node = head; ; node = node->Next)
+        {
+            _retired.push_back({ epoch, node, nullptr });
+            if (node == target)
+                break;
+        }
+
+        RcuEpoch::Advance();
+        ReclaimRetired();
+    }
+
+    static Node const* CopyChain(Node const* node, Node const* target, Node const* tail)
+    {
+        if (node == target)
+            return tail;
+
+        return new Node{ node->NodeKey, node->NodeValue, CopyChain(node->Next, target, tail) };
+    }
+
+    Table* Grow()
+    {
+        Table* oldTable = _table.load(std::memory_order_relaxed);
+        Table* newTable = new Table(oldTable->BucketCount * 2);
+        for (std::size_t i = 0; i < oldTable->BucketCount; ++i)
+        {
+            for (Node const* node = oldTable->Buckets[i].load(std::memory_order_relaxed); node; node = node->Next)
+            {
+                std::atomic<Node const*>& bucket = newTable->GetBucket(node->NodeKey);
+                bucket.store(new Node{ node->NodeKey, node->NodeValue, bucket.load(std::memory_order_relaxed) }, std::memory_order_relaxed);
+            }
+        }
+
+        _table.store(newTable, std::memory_order_release);
+
+        // the old table still owns its nodes, readers inside it keep walking them until it is freed
+        _retired.push_back({ RcuEpoch::GetCurrent(), nullptr, oldTable });
+        RcuEpoch::Advance();
+        ReclaimRetired();
+        return newTable;
+    }
+
+    static void Free(RetiredMemory const& retired)
+    {
+        delete retired.RetiredNode;
+        delete retired.RetiredTable;
+    }
+
+    std::atomic<Table*> _table;
+    std::size_t _size;
+    std::vector<RetiredMemory> _retired;
+};
+}
+
+#endif // TRINITYCORE_RCU_MAP_H
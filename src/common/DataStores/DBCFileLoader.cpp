@@ -24,67 +24,37 @@
 #include "DBCFileLoader.h"
 #include "Errors.h"
 
-DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
+DBCFileLoader::DBCFileLoader() : file(std::make_unique<Trinity::MappedFile>()), recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
 
 bool DBCFileLoader::Load(char const* filename, char const* fmt)
 {
-    uint32 header;
-    if (data)
-    {
-        delete [] data;
-        data = nullptr;
-    }
-
-    FILE* f = fopen(filename, "rb");
-    if (!f)
-        return false;
-
-    if (fread(&header, 4, 1, f) != 1)                        // Number of records
-    {
-        fclose(f);
-        return false;
-    }
-
-
-    EndianConvert(header);
-
-    if (header != 0x43424457)                                //'WDBC'
-    {
-        fclose(f);
-        return false;
-    }
+    data = nullptr;
+    stringTable = nullptr;
+    delete[] fieldsOffset;
+    fieldsOffset = nullptr;
 
-    if (fread(&recordCount, 4, 1, f) != 1)                   // Number of records
-    {
-        fclose(f);
+    // records are read straight from the mapped file, pages only get loaded when touched
+    if (!file->Open(filename))
         return false;
-    }
-
-    EndianConvert(recordCount);
 
-    if (fread(&fieldCount, 4, 1, f) != 1)                    // Number of fields
-    {
-        fclose(f);
+    uint32 header[5];                                       // 'WDBC', records, fields, record size, string size
+    if (file->GetSize() < sizeof(header))
         return false;
-    }
 
-    EndianConvert(fieldCount);
+    memcpy(header, file->GetData(), sizeof(header));
+    for (uint32& field : header)
+        EndianConvert(field);
 
-    if (fread(&recordSize, 4, 1, f) != 1)                    // Size of a record
-    {
-        fclose(f);
+    if (header[0] != 0x43424457)                            //'WDBC'
         return false;
-    }
 
-    EndianConvert(recordSize);
+    recordCount = header[1];
+    fieldCount = header[2];
+    recordSize = header[3];
+    stringSize = header[4];
 
-    if (fread(&stringSize, 4, 1, f) != 1)                    // String size
-    {
-        fclose(f);
+    if (sizeof(header) + uint64(recordSize) * recordCount + stringSize > file->GetSize())
         return false;
-    }
-
-    EndianConvert(stringSize);
 
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
@@ -99,24 +69,13 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
             fieldsOffset[i] += sizeof(uint32);
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
-    stringTable = data + recordSize*recordCount;
-
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
-
+    data = file->GetData() + sizeof(header);
+    stringTable = data + recordSize * recordCount;
     return true;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
-
     delete[] fieldsOffset;
 }
 
@@ -171,6 +130,77 @@ uint32 DBCFileLoader::GetFormatRecordSize(char const* format, int32* index_pos)
     return recordsize;
 }
 
+char** DBCFileLoader::CreateIndexTable(int32 indexPos, uint32& count)
+{
+    typedef char* ptr;
+    ptr* indexTable;
+    if (indexPos >= 0)
+    {
+        uint32 maxi = 0;
+        //find max index
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            uint32 ind = getRecord(y).getUInt(indexPos);
+            if (ind > maxi)
+                maxi = ind;
+        }
+
+        ++maxi;
+        count = maxi;
+        indexTable = new ptr[maxi];
+        memset(indexTable, 0, maxi * sizeof(ptr));
+    }
+    else
+    {
+        count = recordCount;
+        indexTable = new ptr[recordCount];
+    }
+
+    return indexTable;
+}
+
+bool DBCFileLoader::IsLayoutMatching(char const* format) const
+{
+#if TRINITY_ENDIAN == TRINITY_BIGENDIAN
+    (void)format;
+    return false;
+#else
+    if (strlen(format) != fieldCount)
+        return false;
+
+    // dropped fields and string pointers need a converted copy
+    for (uint32 x = 0; x < fieldCount; ++x)
+        if (format[x] == FT_STRING || format[x] == FT_NA || format[x] == FT_NA_BYTE || format[x] == FT_SORT)
+            return false;
+
+    return GetFormatRecordSize(format) == recordSize;
+#endif
+}
+
+char* DBCFileLoader::ProduceDataInPlace(char const* format, uint32& records, char**& indexTable)
+{
+    ASSERT(data && IsLayoutMatching(format));
+
+    int32 i;
+    GetFormatRecordSize(format, &i);
+    indexTable = CreateIndexTable(i, records);
+
+    char* dataTable = reinterpret_cast<char*>(data);
+    for (uint32 y = 0; y < recordCount; ++y)
+        indexTable[i >= 0 ? getRecord(y).getUInt(i) : y] = &dataTable[y * recordSize];
+
+    return dataTable;
+}
+
+std::unique_ptr<Trinity::MappedFile> DBCFileLoader::ReleaseFile()
+{
+    data = nullptr;
+    stringTable = nullptr;
+    std::unique_ptr<Trinity::MappedFile> released = std::move(file);
+    file = std::make_unique<Trinity::MappedFile>();
+    return released;
+}
+
 char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**& indexTable)
 {
     /*
@@ -184,7 +214,6 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
     this func will generate  entry[rows] data;
     */
 
-    typedef char* ptr;
     if (strlen(format) != fieldCount)
         return nullptr;
 
@@ -192,27 +221,7 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
     int32 i;
     uint32 recordsize = GetFormatRecordSize(format, &i);
 
-    if (i >= 0)
-    {
-        uint32 maxi = 0;
-        //find max index
-        for (uint32 y = 0; y < recordCount; ++y)
-        {
-            uint32 ind = getRecord(y).getUInt(i);
-            if (ind > maxi)
-                maxi = ind;
-        }
-
-        ++maxi;
-        records = maxi;
-        indexTable = new ptr[maxi];
-        memset(indexTable, 0, maxi * sizeof(ptr));
-    }
-    else
-    {
-        records = recordCount;
-        indexTable = new ptr[recordCount];
-    }
+    indexTable = CreateIndexTable(i, records);
 
     char* dataTable = new char[recordCount * recordsize];
 
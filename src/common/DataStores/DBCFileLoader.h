@@ -20,7 +20,9 @@
 
 #include "Define.h"
 #include "Errors.h"
+#include "MappedFile.h"
 #include "Utilities/ByteConverter.h"
+#include <memory>
 
 class TC_COMMON_API DBCFileLoader
 {
@@ -95,7 +97,17 @@ class TC_COMMON_API DBCFileLoader
         char* AutoProduceStrings(char const* fmt, char* dataTable);
         static uint32 GetFormatRecordSize(char const* format, int32* index_pos = nullptr);
 
+        // true if records in the file have exactly the layout of the structure described by fmt and can be used without conversion
+        bool IsLayoutMatching(char const* fmt) const;
+        // same as AutoProduceData but the index table points into the mapped file, it must be kept alive with ReleaseFile
+        char* ProduceDataInPlace(char const* fmt, uint32& count, char**& indexTable);
+        // hands over the mapped file, the loader is empty afterwards
+        std::unique_ptr<Trinity::MappedFile> ReleaseFile();
+
     private:
+        char** CreateIndexTable(int32 indexPos, uint32& count);
+
+        std::unique_ptr<Trinity::MappedFile> file;
         uint32 recordSize;
         uint32 recordCount;
         uint32 fieldCount;
@@ -0,0 +1,63 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MappedFile.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace Trinity
+{
+struct MappedFile::Region
+{
+    boost::interprocess::mapped_region Mapping;
+};
+
+MappedFile::MappedFile() : _data(nullptr), _size(0) { }
+
+MappedFile::~MappedFile() = default;
+
+bool MappedFile::Open(char const* filename)
+{
+    Close();
+
+    try
+    {
+        // the region keeps the mapping alive after the file handle is closed
+        boost::interprocess::file_mapping file(filename, boost::interprocess::read_only);
+        std::unique_ptr<Region> region = std::make_unique<Region>();
+        region->Mapping = boost::interprocess::mapped_region(file, boost::interprocess::copy_on_write);
+        _data = static_cast<unsigned char*>(region->Mapping.get_address());
+        _size = region->Mapping.get_size();
+        _region = std::move(region);
+    }
+    catch (boost::interprocess::interprocess_exception const&)
+    {
+        // missing, unreadable or empty file
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void MappedFile::Close()
+{
+    _region.reset();
+    _data = nullptr;
+    _size = 0;
+}
+}
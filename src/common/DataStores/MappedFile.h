@@ -15,26 +15,39 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef LOGOPERATION_H
-#define LOGOPERATION_H
+#ifndef TRINITY_MAPPED_FILE_H
+#define TRINITY_MAPPED_FILE_H
 
 #include "Define.h"
 #include <memory>
 
-class Logger;
-struct LogMessage;
-
-class TC_COMMON_API LogOperation
+namespace Trinity
+{
+/// Whole file mapped into memory with private copy on write pages
+/// Pages are read lazily and shared with every other process mapping the same file until they are written to
+class TC_COMMON_API MappedFile
 {
-    public:
-        LogOperation(Logger const* logger, std::unique_ptr<LogMessage>&& msg);
-        ~LogOperation();
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    bool Open(char const* filename);
+    void Close();
+
+    bool IsOpen() const { return _data != nullptr; }
+    unsigned char* GetData() const { return _data; }
+    std::size_t GetSize() const { return _size; }
 
-        int call();
+private:
+    struct Region;
 
-    protected:
-        Logger const* _logger;
-        std::unique_ptr<LogMessage> _msg;
+    std::unique_ptr<Region> _region;
+    unsigned char* _data;
+    std::size_t _size;
 };
+}
 
-#endif
+#endif // TRINITY_MAPPED_FILE_H
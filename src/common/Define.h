@@ -88,6 +88,12 @@
 #  define ATTR_DEPRECATED
 #endif //TRINITY_COMPILER == TRINITY_COMPILER_GNU
 
+#if TRINITY_COMPILER == TRINITY_COMPILER_GNU
+#  define TC_PREFETCH(address) __builtin_prefetch(address)
+#else //TRINITY_COMPILER != TRINITY_COMPILER_GNU
+#  define TC_PREFETCH(address) ((void)(address))
+#endif //TRINITY_COMPILER == TRINITY_COMPILER_GNU
+
 #ifdef TRINITY_API_USE_DYNAMIC_LINKING
 #  if TRINITY_COMPILER == TRINITY_COMPILER_MICROSOFT
 #    define TC_API_EXPORT __declspec(dllexport)
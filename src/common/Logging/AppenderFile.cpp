@@ -78,15 +78,35 @@ void AppenderFile::_write(LogMessage const* message)
         fclose(file);
         return;
     }
-    else if (exceedMaxSize)
+
+    std::lock_guard<std::mutex> lock(_fileLock);
+    if (exceedMaxSize)
         logfile = OpenFile(_fileName, "w", true);
 
     if (!logfile)
         return;
 
-    fprintf(logfile, "%s%s\n", message->prefix.c_str(), message->text.c_str());
-    fflush(logfile);
+    // async logging writes lines in batches, see Log::GetFileFlushSize
+    _buffer.append(message->prefix).append(message->text).push_back('\n');
     _fileSize += uint64(message->Size());
+    if (_buffer.size() >= sLog->GetFileFlushSize())
+        FlushBuffer();
+}
+
+void AppenderFile::flush()
+{
+    std::lock_guard<std::mutex> lock(_fileLock);
+    FlushBuffer();
+}
+
+void AppenderFile::FlushBuffer()
+{
+    if (!logfile || _buffer.empty())
+        return;
+
+    fwrite(_buffer.data(), 1, _buffer.size(), logfile);
+    fflush(logfile);
+    _buffer.clear();
 }
 
 FILE* AppenderFile::OpenFile(std::string const& filename, std::string const& mode, bool backup)
@@ -115,6 +135,7 @@ void AppenderFile::CloseFile()
 {
     if (logfile)
     {
+        FlushBuffer();
         fclose(logfile);
         logfile = nullptr;
     }
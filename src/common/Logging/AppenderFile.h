@@ -20,6 +20,7 @@
 
 #include "Appender.h"
 #include <atomic>
+#include <mutex>
 
 class TC_COMMON_API AppenderFile : public Appender
 {
@@ -30,9 +31,11 @@ class TC_COMMON_API AppenderFile : public Appender
         ~AppenderFile();
         FILE* OpenFile(std::string const& name, std::string const& mode, bool backup);
         AppenderType getType() const override { return TypeIndex::value; }
+        void flush() override;
 
     private:
         void CloseFile();
+        void FlushBuffer();
         void _write(LogMessage const* message) override;
         FILE* logfile;
         std::string _fileName;
@@ -41,6 +44,8 @@ class TC_COMMON_API AppenderFile : public Appender
         bool _backup;
         uint64 _maxFileSize;
         std::atomic<uint64> _fileSize;
+        std::string _buffer;
+        std::mutex _fileLock;       // guards logfile and _buffer, without a log writer every logging thread writes here itself
 };
 
 #endif
@@ -24,12 +24,19 @@
 #include "Errors.h"
 #include "Logger.h"
 #include "LogMessage.h"
-#include "LogOperation.h"
-#include "Strand.h"
+#include "LogWriter.h"
 #include "Util.h"
 #include <sstream>
 
-Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), _ioContext(nullptr), _strand(nullptr)
+namespace
+{
+    Milliseconds GetFlushIntervalFromConfig()
+    {
+        return Milliseconds(std::max(sConfigMgr->GetIntDefault("Log.Async.FlushInterval", 100), 1));
+    }
+}
+
+Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), _generation(1), _fileFlushSize(0)
 {
     m_logsTimestamp = "_" + GetTimestampStr();
     RegisterAppender<AppenderConsole>();
@@ -38,7 +45,7 @@ Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), _ioContext(nullptr)
 
 Log::~Log()
 {
-    delete _strand;
+    _writer.reset();
     Close();
 }
 
@@ -225,15 +232,10 @@ void Log::outCommand(std::string&& message, std::string&& param1)
 
 void Log::write(std::unique_ptr<LogMessage>&& msg) const
 {
-    Logger const* logger = GetLoggerByType(msg->type);
-
-    if (_ioContext)
-    {
-        std::shared_ptr<LogOperation> logOperation = std::make_shared<LogOperation>(logger, std::move(msg));
-        Trinity::Asio::post(*_ioContext, Trinity::Asio::bind_executor(*_strand, [logOperation]() { logOperation->call(); }));
-    }
+    if (_writer)
+        _writer->Enqueue(std::move(msg));
     else
-        logger->write(msg.get());
+        GetLoggerByType(msg->type)->write(msg.get());
 }
 
 Logger const* Log::GetLoggerByType(std::string const& type) const
@@ -253,6 +255,20 @@ Logger const* Log::GetLoggerByType(std::string const& type) const
     return GetLoggerByType(parentLogger);
 }
 
+uint64 Log::ResolveFilter(LogFilterCache& cache, std::string const& type) const
+{
+    // read before the lookup so a concurrent reload leaves the cache outdated instead of wrong
+    uint64 generation = _generation.load(std::memory_order_acquire);
+
+    LogLevel level = LOG_LEVEL_DISABLED;
+    if (Logger const* logger = GetLoggerByType(type))
+        level = logger->getLogLevel();
+
+    uint64 state = (generation << 8) | level;
+    cache.State.store(state, std::memory_order_relaxed);
+    return state;
+}
+
 std::string Log::GetTimestampStr()
 {
     time_t tt = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
@@ -286,6 +302,7 @@ bool Log::SetLogLevel(std::string const& name, char const* newLevelc, bool isLog
             return false;
 
         it->second->setLogLevel(newLevel);
+        ++_generation;
 
         if (newLevel != LOG_LEVEL_DISABLED && newLevel < lowestLogLevel)
             lowestLogLevel = newLevel;
@@ -330,13 +347,12 @@ void Log::Close()
 {
     loggers.clear();
     appenders.clear();
+    ++_generation;
 }
 
 bool Log::ShouldLog(std::string const& type, LogLevel level) const
 {
-    // TODO: Use cache to store "Type.sub1.sub2": "Type" equivalence, should
-    // Speed up in cases where requesting "Type.sub1.sub2" but only configured
-    // Logger "Type"
+    // Uncached lookup, TC_LOG_* calls with a string literal filter go through LogFilterCache instead
 
     // Don't even look for a logger if the LogLevel is lower than lowest log levels across all loggers
     if (level < lowestLogLevel)
@@ -356,25 +372,64 @@ Log* Log::instance()
     return &instance;
 }
 
-void Log::Initialize(Trinity::Asio::IoContext* ioContext)
+void Log::Initialize(bool async)
 {
-    if (ioContext)
-    {
-        _ioContext = ioContext;
-        _strand = new Trinity::Asio::Strand(*ioContext);
-    }
-
     LoadFromConfig();
+
+    if (async)
+        StartWriter();
 }
 
 void Log::SetSynchronous()
 {
-    delete _strand;
-    _strand = nullptr;
-    _ioContext = nullptr;
+    if (_writer)
+        _writer->SetSynchronous();
+}
+
+void Log::StartWriter()
+{
+    std::size_t queueSize = std::max(sConfigMgr->GetIntDefault("Log.Async.QueueSize", 65536), 2);
+    _fileFlushSize = std::max(sConfigMgr->GetIntDefault("Log.Async.FlushSize", 65536), 0);
+
+    // set once before other threads start logging and kept until the process exits
+    _writer = Trinity::make_unique<LogWriter>(queueSize, GetFlushIntervalFromConfig(), sConfigMgr->GetBoolDefault("Log.Async.DropOnOverflow", false),
+        [this](LogMessage* message) { GetLoggerByType(message->type)->write(message); },
+        [this]() { FlushAppenders(); });
+}
+
+std::size_t Log::GetFileFlushSize() const
+{
+    return _writer && !_writer->IsSynchronous() ? _fileFlushSize : 0;
+}
+
+void Log::FlushAppenders()
+{
+    for (auto const& [id, appender] : appenders)
+        appender->flush();
+}
+
+uint64 Log::GetDroppedMessages() const
+{
+    return _writer ? _writer->GetDroppedMessages() : 0;
 }
 
 void Log::LoadFromConfig()
+{
+    if (!_writer)
+    {
+        LoadAppendersAndLoggers();
+        return;
+    }
+
+    // the writer thread is paused while appenders are replaced, Log.Async.QueueSize only changes on restart
+    _writer->Reconfigure(GetFlushIntervalFromConfig(), sConfigMgr->GetBoolDefault("Log.Async.DropOnOverflow", false), [this]()
+    {
+        _fileFlushSize = std::max(sConfigMgr->GetIntDefault("Log.Async.FlushSize", 65536), 0);
+        LoadAppendersAndLoggers();
+    });
+}
+
+void Log::LoadAppendersAndLoggers()
 {
     Close();
 
@@ -387,4 +442,5 @@ void Log::LoadFromConfig()
 
     ReadAppendersFromConfig();
     ReadLoggersFromConfig();
+    ++_generation;
 }
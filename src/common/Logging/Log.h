@@ -22,24 +22,28 @@
 #include "AsioHacksFwd.h"
 #include "LogCommon.h"
 #include "StringFormat.h"
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <vector>
 
 class Appender;
 class Logger;
+class LogWriter;
 struct LogMessage;
 
-namespace Trinity
-{
-    namespace Asio
-    {
-        class IoContext;
-    }
-}
-
 #define LOGGER_ROOT "root"
 
+#ifndef TRINITY_LOG_MIN_LEVEL
+#define TRINITY_LOG_MIN_LEVEL LOG_LEVEL_TRACE
+#endif
+
+/// Level of the logger a TC_LOG_* call site resolves to, looked up again once the logger configuration changes
+struct LogFilterCache
+{
+    std::atomic<uint64> State{ 0 }; // configuration generation << 8 | LogLevel
+};
+
 typedef Appender*(*AppenderCreatorFn)(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<char const*>&& extraArgs);
 
 template <class AppenderImpl>
@@ -63,11 +67,29 @@ class TC_COMMON_API Log
     public:
         static Log* instance();
 
-        void Initialize(Trinity::Asio::IoContext* ioContext);
-        void SetSynchronous();  // Not threadsafe - should only be called from main() after all threads are joined
+        void Initialize(bool async);
+        void SetSynchronous();  // Writes queued messages and makes every later message be written by the thread logging it
         void LoadFromConfig();
         void Close();
         bool ShouldLog(std::string const& type, LogLevel level) const;
+
+        // string literal filters are resolved once per configuration
+        template<std::size_t N>
+        bool ShouldLog(LogFilterCache& cache, char const(&type)[N], LogLevel level) const
+        {
+            uint64 state = cache.State.load(std::memory_order_relaxed);
+            if ((state >> 8) != _generation.load(std::memory_order_relaxed))
+                state = ResolveFilter(cache, type);
+
+            LogLevel logLevel = LogLevel(state & 0xFF);
+            return logLevel != LOG_LEVEL_DISABLED && logLevel <= level;
+        }
+
+        // filters built at runtime may change between calls from the same site
+        template<std::size_t N>
+        bool ShouldLog(LogFilterCache& /*cache*/, char(&type)[N], LogLevel level) const { return ShouldLog(std::string(type), level); }
+        bool ShouldLog(LogFilterCache& /*cache*/, std::string const& type, LogLevel level) const { return ShouldLog(type, level); }
+
         bool SetLogLevel(std::string const& name, char const* level, bool isLogger = true);
 
         template<typename Format, typename... Args>
@@ -99,11 +121,16 @@ class TC_COMMON_API Log
         std::string const& GetLogsDir() const { return m_logsDir; }
         std::string const& GetLogsTimestamp() const { return m_logsTimestamp; }
 
+        /// Bytes file appenders buffer before writing, 0 when messages are written synchronously
+        std::size_t GetFileFlushSize() const;
+        uint64 GetDroppedMessages() const;
+
     private:
         static std::string GetTimestampStr();
         void write(std::unique_ptr<LogMessage>&& msg) const;
 
         Logger const* GetLoggerByType(std::string const& type) const;
+        uint64 ResolveFilter(LogFilterCache& cache, std::string const& type) const;
         Appender* GetAppenderByName(std::string const& name);
         uint8 NextAppenderId();
         void CreateAppenderFromConfig(std::string const& name);
@@ -113,18 +140,22 @@ class TC_COMMON_API Log
         void RegisterAppender(uint8 index, AppenderCreatorFn appenderCreateFn);
         void outMessage(std::string const& filter, LogLevel const level, std::string&& message);
         void outCommand(std::string&& message, std::string&& param1);
+        void StartWriter();
+        void LoadAppendersAndLoggers();
+        void FlushAppenders();
 
         std::unordered_map<uint8, AppenderCreatorFn> appenderFactory;
         std::unordered_map<uint8, std::unique_ptr<Appender>> appenders;
         std::unordered_map<std::string, std::unique_ptr<Logger>> loggers;
         uint8 AppenderId;
         LogLevel lowestLogLevel;
+        std::atomic<uint64> _generation;
 
         std::string m_logsDir;
         std::string m_logsTimestamp;
 
-        Trinity::Asio::IoContext* _ioContext;
-        Trinity::Asio::Strand* _strand;
+        std::unique_ptr<LogWriter> _writer;
+        std::size_t _fileFlushSize;
 };
 
 #define sLog Log::instance()
@@ -151,12 +182,16 @@ void check_args(std::string const&, ...);
 // This will catch format errors on build time
 #define TC_LOG_MESSAGE_BODY(filterType__, level__, ...)                 \
         do {                                                            \
-            if (sLog->ShouldLog(filterType__, level__))                 \
+            if constexpr (level__ >= TRINITY_LOG_MIN_LEVEL)             \
             {                                                           \
-                if (false)                                              \
-                    check_args(__VA_ARGS__);                            \
+                static LogFilterCache logFilterCache__;                 \
+                if (sLog->ShouldLog(logFilterCache__, filterType__, level__)) \
+                {                                                       \
+                    if (false)                                          \
+                        check_args(__VA_ARGS__);                        \
                                                                         \
-                LOG_EXCEPTION_FREE(filterType__, level__, __VA_ARGS__); \
+                    LOG_EXCEPTION_FREE(filterType__, level__, __VA_ARGS__); \
+                }                                                       \
             }                                                           \
         } while (0)
 #else
@@ -164,8 +199,12 @@ void check_args(std::string const&, ...);
         __pragma(warning(push))                                         \
         __pragma(warning(disable:4127))                                 \
         do {                                                            \
-            if (sLog->ShouldLog(filterType__, level__))                 \
-                LOG_EXCEPTION_FREE(filterType__, level__, __VA_ARGS__); \
+            if constexpr (level__ >= TRINITY_LOG_MIN_LEVEL)             \
+            {                                                           \
+                static LogFilterCache logFilterCache__;                 \
+                if (sLog->ShouldLog(logFilterCache__, filterType__, level__)) \
+                    LOG_EXCEPTION_FREE(filterType__, level__, __VA_ARGS__); \
+            }                                                           \
         } while (0)                                                     \
         __pragma(warning(pop))
 #endif
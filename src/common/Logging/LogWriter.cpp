@@ -0,0 +1,152 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LogWriter.h"
+#include "LogMessage.h"
+#include "StringFormat.h"
+
+LogWriter::LogWriter(std::size_t queueSize, Milliseconds flushInterval, bool dropOnOverflow, WriteFn write, FlushFn flush)
+    : _queue(queueSize), _flushInterval(flushInterval), _dropOnOverflow(dropOnOverflow), _synchronous(false), _write(std::move(write)), _flush(std::move(flush)),
+    _droppedMessages(0), _reportedDroppedMessages(0), _stop(false)
+{
+    _thread = std::thread(&LogWriter::Run, this);
+}
+
+LogWriter::~LogWriter()
+{
+    {
+        // set under the lock so the writer cannot miss the wakeup between checking _stop and waiting
+        std::lock_guard<std::mutex> lock(_wakeUpLock);
+        _stop = true;
+    }
+
+    _wakeUp.notify_one();
+    _thread.join();
+}
+
+void LogWriter::Enqueue(std::unique_ptr<LogMessage>&& message)
+{
+    if (_synchronous.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(_writeLock);
+        _write(message.get());
+        return;
+    }
+
+    if (_queue.Enqueue(std::move(message)))
+    {
+        // wake the writer early instead of waiting for the flush interval when the queue is filling up
+        if (_queue.GetSizeApprox() > _queue.GetCapacity() / 2)
+            _wakeUp.notify_one();
+        return;
+    }
+
+    if (_dropOnOverflow.load(std::memory_order_relaxed) && message->level < LOG_LEVEL_ERROR)
+    {
+        _droppedMessages.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // backpressure, wait for the writer to make room
+    _wakeUp.notify_one();
+    while (!_queue.Enqueue(std::move(message)))
+        std::this_thread::yield();
+}
+
+void LogWriter::Reconfigure(Milliseconds flushInterval, bool dropOnOverflow, std::function<void()> const& reload)
+{
+    std::lock_guard<std::mutex> lock(_writeLock);
+
+    // queued messages go to the appenders they were logged for, producers keep queueing meanwhile
+    WriteQueued();
+    ReportDroppedMessages();
+    _flush();
+
+    reload();
+
+    _flushInterval = flushInterval;
+    _dropOnOverflow = dropOnOverflow;
+}
+
+void LogWriter::SetSynchronous()
+{
+    std::lock_guard<std::mutex> lock(_writeLock);
+
+    // producers seeing the flag wait for the lock, so their messages are written after the queued ones
+    _synchronous = true;
+    while (WriteQueued());
+    ReportDroppedMessages();
+    _flush();
+}
+
+void LogWriter::Run()
+{
+    std::chrono::steady_clock::time_point nextFlush = std::chrono::steady_clock::now() + _flushInterval.load();
+    while (!_stop)
+    {
+        bool wrote;
+        {
+            std::lock_guard<std::mutex> lock(_writeLock);
+            wrote = WriteQueued();
+
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            if (now >= nextFlush)
+            {
+                ReportDroppedMessages();
+                _flush();
+                nextFlush = now + _flushInterval.load();
+            }
+        }
+
+        if (!wrote)
+        {
+            std::unique_lock<std::mutex> lock(_wakeUpLock);
+            _wakeUp.wait_until(lock, nextFlush, [this]() { return _stop || _queue.GetSizeApprox() > _queue.GetCapacity() / 2; });
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_writeLock);
+    while (WriteQueued());
+    ReportDroppedMessages();
+    _flush();
+}
+
+bool LogWriter::WriteQueued()
+{
+    // bounded so flushes still happen on time while producers keep the queue busy
+    std::size_t written = 0;
+    std::unique_ptr<LogMessage> message;
+    while (written < _queue.GetCapacity() && _queue.Dequeue(message))
+    {
+        _write(message.get());
+        ++written;
+    }
+
+    return written != 0;
+}
+
+void LogWriter::ReportDroppedMessages()
+{
+    uint64 dropped = _droppedMessages.load(std::memory_order_relaxed);
+    if (dropped == _reportedDroppedMessages)
+        return;
+
+    LogMessage message(LOG_LEVEL_WARN, "server", Trinity::StringFormat("Log queue was full, dropped " UI64FMTD " messages (" UI64FMTD " total)",
+        dropped - _reportedDroppedMessages, dropped));
+    _reportedDroppedMessages = dropped;
+    _write(&message);
+}
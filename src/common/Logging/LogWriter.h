@@ -0,0 +1,83 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOGWRITER_H
+#define LOGWRITER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "MPSCRingBuffer.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+struct LogMessage;
+
+/// Hands log messages from the logging threads to a dedicated writer thread
+/// Producers only push into a lock free ring buffer, formatting and file writes happen on the writer thread
+/// which flushes appenders every flushInterval. When the ring buffer is full messages below LOG_LEVEL_ERROR
+/// are dropped if dropOnOverflow is set, otherwise (and always for errors) the producer waits for free space
+/// The writer lives as long as the process, Reconfigure and SetSynchronous can be called while other threads log
+class TC_COMMON_API LogWriter
+{
+    public:
+        typedef std::function<void(LogMessage*)> WriteFn;
+        typedef std::function<void()> FlushFn;
+
+        LogWriter(std::size_t queueSize, Milliseconds flushInterval, bool dropOnOverflow, WriteFn write, FlushFn flush);
+        ~LogWriter();
+
+        LogWriter(LogWriter const&) = delete;
+        LogWriter& operator=(LogWriter const&) = delete;
+
+        void Enqueue(std::unique_ptr<LogMessage>&& message);
+
+        /// Writes everything queued so far, then calls reload while the writer thread is paused so appenders can be replaced
+        void Reconfigure(Milliseconds flushInterval, bool dropOnOverflow, std::function<void()> const& reload);
+
+        /// Writes everything queued so far, later messages are written by the thread logging them
+        void SetSynchronous();
+        bool IsSynchronous() const { return _synchronous.load(std::memory_order_acquire); }
+
+        uint64 GetDroppedMessages() const { return _droppedMessages.load(std::memory_order_relaxed); }
+
+    private:
+        void Run();
+        bool WriteQueued();
+        void ReportDroppedMessages();
+
+        Trinity::MPSCRingBuffer<std::unique_ptr<LogMessage>> _queue;
+        std::atomic<Milliseconds> _flushInterval;
+        std::atomic<bool> _dropOnOverflow;
+        std::atomic<bool> _synchronous;
+        WriteFn _write;
+        FlushFn _flush;
+        std::mutex _writeLock;                                  // held while _write or _flush run, appenders are never used by two threads at once
+
+        std::atomic<uint64> _droppedMessages;
+        uint64 _reportedDroppedMessages;
+
+        std::atomic<bool> _stop;
+        std::mutex _wakeUpLock;
+        std::condition_variable _wakeUp;
+        std::thread _thread;
+};
+
+#endif
@@ -24,6 +24,7 @@
 #include "Util.h"
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <fstream>
 
 void Metric::Initialize(std::string const& realmName, Trinity::Asio::IoContext& ioContext, std::function<void()> overallStatusLogger)
 {
@@ -73,6 +74,14 @@ void Metric::LoadFromConfigs()
     // Cancel any scheduled operation if the config changed from Enabled to Disabled.
     if (_enabled && !previousValue)
     {
+        _outputFile = sConfigMgr->GetStringDefault("Metric.OutputFile", "");
+        if (!_outputFile.empty())
+        {
+            ScheduleSend();
+            ScheduleOverallStatusLog();
+            return;
+        }
+
         std::string connectionInfo = sConfigMgr->GetStringDefault("Metric.ConnectionInfo", "");
         if (connectionInfo.empty())
         {
@@ -125,13 +134,11 @@ void Metric::SendBatch()
     using namespace std::chrono;
 
     std::stringstream batchedData;
+    _registry.WriteLines(batchedData, _realmName, system_clock::now());
+
     MetricData* data;
-    bool firstLoop = true;
     while (_queuedData.Dequeue(data))
     {
-        if (!firstLoop)
-            batchedData << "\n";
-
         batchedData << data->Category;
         if (!_realmName.empty())
             batchedData << ",realm=" << _realmName;
@@ -150,9 +157,8 @@ void Metric::SendBatch()
 
         batchedData << " ";
 
-        batchedData << std::to_string(duration_cast<nanoseconds>(data->Timestamp.time_since_epoch()).count());
+        batchedData << std::to_string(duration_cast<nanoseconds>(data->Timestamp.time_since_epoch()).count()) << "\n";
 
-        firstLoop = false;
         delete data;
     }
 
@@ -163,6 +169,13 @@ void Metric::SendBatch()
         return;
     }
 
+    if (!_outputFile.empty())
+    {
+        WriteBatchToFile(batchedData);
+        ScheduleSend();
+        return;
+    }
+
     if (!GetDataStream().good() && !Connect())
         return;
 
@@ -196,6 +209,18 @@ void Metric::SendBatch()
     ScheduleSend();
 }
 
+void Metric::WriteBatchToFile(std::stringstream& batchedData)
+{
+    std::ofstream file(_outputFile, std::ios::out | std::ios::app);
+    if (!file)
+    {
+        TC_LOG_ERROR("metric", "Error opening '%s' for writing metric data", _outputFile.c_str());
+        return;
+    }
+
+    file << batchedData.rdbuf();
+}
+
 void Metric::ScheduleSend()
 {
     if (_enabled)
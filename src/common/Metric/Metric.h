@@ -19,6 +19,7 @@
 #define METRIC_H__
 
 #include "Define.h"
+#include "MetricRegistry.h"
 #include "MPSCQueue.h"
 #include <chrono>
 #include <functional>
@@ -61,6 +62,7 @@ private:
     std::iostream& GetDataStream() { return *_dataStream; }
     std::unique_ptr<std::iostream> _dataStream;
     MPSCQueue<MetricData> _queuedData;
+    MetricRegistry _registry;
     std::unique_ptr<Trinity::Asio::DeadlineTimer> _batchTimer;
     std::unique_ptr<Trinity::Asio::DeadlineTimer> _overallStatusTimer;
     int32 _updateInterval = 0;
@@ -70,11 +72,13 @@ private:
     std::string _hostname;
     std::string _port;
     std::string _databaseName;
+    std::string _outputFile;
     std::function<void()> _overallStatusLogger;
     std::string _realmName;
 
     bool Connect();
     void SendBatch();
+    void WriteBatchToFile(std::stringstream& batchedData);
     void ScheduleSend();
     void ScheduleOverallStatusLog();
 
@@ -115,6 +119,12 @@ public:
 
     void LogEvent(std::string const& category, std::string const& title, std::string const& description);
 
+    // Instruments are aggregated in place and flushed with every batch, updating them never allocates or locks.
+    // Register once (see TC_METRIC_COUNTER, TC_METRIC_GAUGE and TC_METRIC_HISTOGRAM) and keep the reference.
+    MetricCounter& RegisterCounter(std::string const& category) { return _registry.RegisterCounter(category); }
+    MetricGauge& RegisterGauge(std::string const& category) { return _registry.RegisterGauge(category); }
+    MetricHistogram& RegisterHistogram(std::string const& category, std::vector<uint64> upperBounds) { return _registry.RegisterHistogram(category, std::move(upperBounds)); }
+
     void Unload();
     bool IsEnabled() const { return _enabled; }
 };
@@ -124,6 +134,9 @@ public:
 #ifdef PERFORMANCE_PROFILING
 #define TC_METRIC_EVENT(category, title, description) ((void)0)
 #define TC_METRIC_VALUE(category, value) ((void)0)
+#define TC_METRIC_COUNTER(category, value) ((void)0)
+#define TC_METRIC_GAUGE(category, value) ((void)0)
+#define TC_METRIC_HISTOGRAM(category, value, ...) ((void)0)
 #elif TRINITY_PLATFORM != TRINITY_PLATFORM_WINDOWS
 #define TC_METRIC_EVENT(category, title, description)                    \
         do {                                                            \
@@ -135,6 +148,24 @@ public:
             if (sMetric->IsEnabled())                              \
                 sMetric->LogValue(category, value);                \
         } while (0)
+#define TC_METRIC_COUNTER(category, value)                               \
+        do {                                                            \
+            static MetricCounter& tc_metric_instrument = sMetric->RegisterCounter(category); \
+            if (sMetric->IsEnabled())                              \
+                tc_metric_instrument.Add(value);                   \
+        } while (0)
+#define TC_METRIC_GAUGE(category, value)                                 \
+        do {                                                            \
+            static MetricGauge& tc_metric_instrument = sMetric->RegisterGauge(category); \
+            if (sMetric->IsEnabled())                              \
+                tc_metric_instrument.Set(value);                   \
+        } while (0)
+#define TC_METRIC_HISTOGRAM(category, value, ...)                        \
+        do {                                                            \
+            static MetricHistogram& tc_metric_instrument = sMetric->RegisterHistogram(category, { __VA_ARGS__ }); \
+            if (sMetric->IsEnabled())                              \
+                tc_metric_instrument.Record(value);                \
+        } while (0)
 #else
 #define TC_METRIC_EVENT(category, title, description)                    \
         __pragma(warning(push))                                         \
@@ -152,6 +183,33 @@ public:
                 sMetric->LogValue(category, value);                \
         } while (0)                                                     \
         __pragma(warning(pop))
+#define TC_METRIC_COUNTER(category, value)                               \
+        __pragma(warning(push))                                         \
+        __pragma(warning(disable:4127))                                 \
+        do {                                                            \
+            static MetricCounter& tc_metric_instrument = sMetric->RegisterCounter(category); \
+            if (sMetric->IsEnabled())                              \
+                tc_metric_instrument.Add(value);                   \
+        } while (0)                                                     \
+        __pragma(warning(pop))
+#define TC_METRIC_GAUGE(category, value)                                 \
+        __pragma(warning(push))                                         \
+        __pragma(warning(disable:4127))                                 \
+        do {                                                            \
+            static MetricGauge& tc_metric_instrument = sMetric->RegisterGauge(category); \
+            if (sMetric->IsEnabled())                              \
+                tc_metric_instrument.Set(value);                   \
+        } while (0)                                                     \
+        __pragma(warning(pop))
+#define TC_METRIC_HISTOGRAM(category, value, ...)                        \
+        __pragma(warning(push))                                         \
+        __pragma(warning(disable:4127))                                 \
+        do {                                                            \
+            static MetricHistogram& tc_metric_instrument = sMetric->RegisterHistogram(category, { __VA_ARGS__ }); \
+            if (sMetric->IsEnabled())                              \
+                tc_metric_instrument.Record(value);                \
+        } while (0)                                                     \
+        __pragma(warning(pop))
 #endif
 
 #endif // METRIC_H__
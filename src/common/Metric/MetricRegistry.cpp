@@ -0,0 +1,137 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MetricRegistry.h"
+#include "Errors.h"
+#include <algorithm>
+#include <ostream>
+
+uint32 Trinity::Metrics::AllocateThreadSlot()
+{
+    static std::atomic<uint32> nextSlot(0);
+    return nextSlot.fetch_add(1, std::memory_order_relaxed) % METRIC_THREAD_SLOTS;
+}
+
+uint64 MetricCounter::Collect()
+{
+    uint64 total = 0;
+    for (Trinity::Metrics::CounterSlot& slot : _slots)
+        total += slot.Value.exchange(0, std::memory_order_relaxed);
+
+    return total;
+}
+
+MetricHistogram::MetricHistogram(std::string name, std::vector<uint64> upperBounds) : _name(std::move(name)), _upperBounds(std::move(upperBounds))
+{
+    ASSERT(std::is_sorted(_upperBounds.begin(), _upperBounds.end()), "Histogram %s bucket bounds must be sorted", _name.c_str());
+
+    std::size_t const counters = _upperBounds.size() + 2;
+    _linesPerSlot = (counters + Trinity::Metrics::CounterLine::Size - 1) / Trinity::Metrics::CounterLine::Size;
+    _lines = std::make_unique<Trinity::Metrics::CounterLine[]>(_linesPerSlot * METRIC_THREAD_SLOTS);
+}
+
+MetricHistogram::Snapshot MetricHistogram::Collect()
+{
+    Snapshot snapshot;
+    snapshot.BucketCounts.resize(_upperBounds.size() + 1, 0);
+    for (std::size_t slot = 0; slot < METRIC_THREAD_SLOTS; ++slot)
+    {
+        for (std::size_t bucket = 0; bucket < snapshot.BucketCounts.size(); ++bucket)
+        {
+            uint64 count = GetCounter(slot, bucket).exchange(0, std::memory_order_relaxed);
+            snapshot.BucketCounts[bucket] += count;
+            snapshot.Count += count;
+        }
+
+        snapshot.Sum += GetCounter(slot, _upperBounds.size() + 1).exchange(0, std::memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+MetricRegistry::MetricRegistry() = default;
+MetricRegistry::~MetricRegistry() = default;
+
+namespace
+{
+template<class Instrument, class... Args>
+Instrument& FindOrRegister(std::vector<std::unique_ptr<Instrument>>& instruments, std::string const& name, Args&&... args)
+{
+    for (std::unique_ptr<Instrument> const& instrument : instruments)
+        if (instrument->GetName() == name)
+            return *instrument;
+
+    instruments.push_back(std::make_unique<Instrument>(name, std::forward<Args>(args)...));
+    return *instruments.back();
+}
+}
+
+MetricCounter& MetricRegistry::RegisterCounter(std::string const& name)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    return FindOrRegister(_counters, name);
+}
+
+MetricGauge& MetricRegistry::RegisterGauge(std::string const& name)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    return FindOrRegister(_gauges, name);
+}
+
+MetricHistogram& MetricRegistry::RegisterHistogram(std::string const& name, std::vector<uint64> upperBounds)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    return FindOrRegister(_histograms, name, std::move(upperBounds));
+}
+
+std::size_t MetricRegistry::WriteLines(std::ostream& out, std::string const& realmTag, std::chrono::system_clock::time_point timestamp)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    std::string const suffix = ' ' + std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp.time_since_epoch()).count()) + '\n';
+    auto writeKey = [&](std::string const& name)
+    {
+        out << name;
+        if (!realmTag.empty())
+            out << ",realm=" << realmTag;
+        out << ' ';
+    };
+
+    for (std::unique_ptr<MetricCounter> const& counter : _counters)
+    {
+        writeKey(counter->GetName());
+        out << "value=" << counter->Collect() << 'i' << suffix;
+    }
+
+    for (std::unique_ptr<MetricGauge> const& gauge : _gauges)
+    {
+        writeKey(gauge->GetName());
+        out << "value=" << gauge->Collect() << 'i' << suffix;
+    }
+
+    for (std::unique_ptr<MetricHistogram> const& histogram : _histograms)
+    {
+        MetricHistogram::Snapshot snapshot = histogram->Collect();
+        writeKey(histogram->GetName());
+        out << "count=" << snapshot.Count << "i,sum=" << snapshot.Sum << 'i';
+        for (std::size_t bucket = 0; bucket < histogram->GetUpperBounds().size(); ++bucket)
+            out << ",bucket_" << histogram->GetUpperBounds()[bucket] << '=' << snapshot.BucketCounts[bucket] << 'i';
+        out << ",bucket_inf=" << snapshot.BucketCounts.back() << 'i' << suffix;
+    }
+
+    return _counters.size() + _gauges.size() + _histograms.size();
+}
@@ -0,0 +1,169 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef METRIC_REGISTRY_H__
+#define METRIC_REGISTRY_H__
+
+#include "Define.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <initializer_list>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// number of independent cache lines each instrument spreads its updates over, threads are assigned one round robin
+#define METRIC_THREAD_SLOTS 32
+#define METRIC_CACHE_LINE_SIZE 64
+
+namespace Trinity
+{
+namespace Metrics
+{
+    TC_COMMON_API uint32 AllocateThreadSlot();
+
+    inline uint32 GetThreadSlot()
+    {
+        static thread_local uint32 const slot = AllocateThreadSlot();
+        return slot;
+    }
+
+    struct alignas(METRIC_CACHE_LINE_SIZE) CounterSlot
+    {
+        std::atomic<uint64> Value{ 0 };
+    };
+
+    // histogram counters of a thread slot take whole lines, no line is shared with another slot
+    struct alignas(METRIC_CACHE_LINE_SIZE) CounterLine
+    {
+        static constexpr std::size_t Size = METRIC_CACHE_LINE_SIZE / sizeof(std::atomic<uint64>);
+
+        std::atomic<uint64> Values[Size] = { };
+    };
+}
+}
+
+/// Monotonic count, reported as the amount added since previous flush
+class TC_COMMON_API MetricCounter
+{
+public:
+    explicit MetricCounter(std::string name) : _name(std::move(name)) { }
+
+    void Add(uint64 value = 1)
+    {
+        _slots[Trinity::Metrics::GetThreadSlot()].Value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    std::string const& GetName() const { return _name; }
+
+    // returns amount added since previous call
+    uint64 Collect();
+
+private:
+    std::string _name;
+    std::array<Trinity::Metrics::CounterSlot, METRIC_THREAD_SLOTS> _slots;
+};
+
+/// Last set value
+class TC_COMMON_API MetricGauge
+{
+public:
+    explicit MetricGauge(std::string name) : _name(std::move(name)), _value(0) { }
+
+    void Set(int64 value) { _value.store(value, std::memory_order_relaxed); }
+
+    std::string const& GetName() const { return _name; }
+    int64 Collect() const { return _value.load(std::memory_order_relaxed); }
+
+private:
+    std::string _name;
+    alignas(METRIC_CACHE_LINE_SIZE) std::atomic<int64> _value;
+};
+
+/// Distribution of values over fixed buckets, reported as per bucket counts since previous flush
+class TC_COMMON_API MetricHistogram
+{
+public:
+    struct Snapshot
+    {
+        std::vector<uint64> BucketCounts;   // one more than bucket bounds, last one counts values above every bound
+        uint64 Count = 0;
+        uint64 Sum = 0;
+    };
+
+    // upperBounds must be sorted ascending, a value goes into the first bucket with value <= bound
+    MetricHistogram(std::string name, std::vector<uint64> upperBounds);
+
+    void Record(uint64 value)
+    {
+        std::size_t bucket = 0;
+        while (bucket < _upperBounds.size() && value > _upperBounds[bucket])
+            ++bucket;
+
+        uint32 slot = Trinity::Metrics::GetThreadSlot();
+        GetCounter(slot, bucket).fetch_add(1, std::memory_order_relaxed);
+        GetCounter(slot, _upperBounds.size() + 1).fetch_add(value, std::memory_order_relaxed);
+    }
+
+    std::string const& GetName() const { return _name; }
+    std::vector<uint64> const& GetUpperBounds() const { return _upperBounds; }
+
+    // returns distribution of values recorded since previous call
+    Snapshot Collect();
+
+private:
+    // counters of a thread slot are the buckets followed by the sum
+    std::atomic<uint64>& GetCounter(std::size_t slot, std::size_t index)
+    {
+        return _lines[slot * _linesPerSlot + index / Trinity::Metrics::CounterLine::Size].Values[index % Trinity::Metrics::CounterLine::Size];
+    }
+
+    std::string _name;
+    std::vector<uint64> _upperBounds;
+    std::size_t _linesPerSlot;
+    std::unique_ptr<Trinity::Metrics::CounterLine[]> _lines;
+};
+
+/// Owns registered instruments and formats them in InfluxDB line protocol
+class TC_COMMON_API MetricRegistry
+{
+public:
+    MetricRegistry();
+    ~MetricRegistry();
+
+    MetricRegistry(MetricRegistry const&) = delete;
+    MetricRegistry& operator=(MetricRegistry const&) = delete;
+
+    // registering the same name twice returns the same instrument, returned references stay valid for registry lifetime
+    MetricCounter& RegisterCounter(std::string const& name);
+    MetricGauge& RegisterGauge(std::string const& name);
+    MetricHistogram& RegisterHistogram(std::string const& name, std::vector<uint64> upperBounds);
+
+    // writes one line per instrument, returns number of lines written
+    std::size_t WriteLines(std::ostream& out, std::string const& realmTag, std::chrono::system_clock::time_point timestamp);
+
+private:
+    std::mutex _lock;
+    std::vector<std::unique_ptr<MetricCounter>> _counters;
+    std::vector<std::unique_ptr<MetricGauge>> _gauges;
+    std::vector<std::unique_ptr<MetricHistogram>> _histograms;
+};
+
+#endif // METRIC_REGISTRY_H__
@@ -0,0 +1,92 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPSCFilterQueue_h__
+#define MPSCFilterQueue_h__
+
+#include "MPSCQueue.h"
+#include <algorithm>
+#include <vector>
+
+/// Lock free queue with the consumer side of LockedQueue: next(result, checker) and readd()
+/// Any thread can enqueue, every other method must be called by one consumer thread only
+/// Elements left in the queue are deleted with it
+template<typename T, std::atomic<T*> T::* IntrusiveLink = nullptr>
+class MPSCFilterQueue
+{
+public:
+    MPSCFilterQueue() = default;
+    ~MPSCFilterQueue()
+    {
+        for (T* element : _front)
+            delete element;
+    }
+
+    void Enqueue(T* input)
+    {
+        _queue.Enqueue(input);
+    }
+
+    /// Takes the next element regardless of any filter
+    bool Dequeue(T*& result)
+    {
+        if (!_front.empty())
+        {
+            result = _front.back();
+            _front.pop_back();
+            return true;
+        }
+
+        return _queue.Dequeue(result);
+    }
+
+    /// Takes the next element if check.Process(element) accepts it, a rejected element stays first in line
+    template<class Checker>
+    bool Next(T*& result, Checker& check)
+    {
+        if (!_front.empty())
+            result = _front.back();
+        else if (_queue.Dequeue(result))
+            _front.push_back(result);
+        else
+            return false;
+
+        if (!check.Process(result))
+            return false;
+
+        _front.pop_back();
+        return true;
+    }
+
+    /// Puts elements taken earlier back in front of everything still queued, in the order given
+    template<class Iterator>
+    void Readd(Iterator begin, Iterator end)
+    {
+        std::size_t frontSize = _front.size();
+        _front.insert(_front.end(), begin, end);
+        std::reverse(_front.begin() + frontSize, _front.end());
+    }
+
+private:
+    MPSCQueue<T, IntrusiveLink> _queue;
+    std::vector<T*> _front;                                 // taken from _queue but not consumed yet, oldest element is at the back
+
+    MPSCFilterQueue(MPSCFilterQueue const&) = delete;
+    MPSCFilterQueue& operator=(MPSCFilterQueue const&) = delete;
+};
+
+#endif // MPSCFilterQueue_h__
@@ -97,9 +97,9 @@ class MPSCQueueIntrusive
     using Atomic = std::atomic<T*>;
 
 public:
-    MPSCQueueIntrusive() : _dummyPtr(reinterpret_cast<T*>(_dummy.data())), _head(_dummyPtr), _tail(_dummyPtr)
+    MPSCQueueIntrusive() : _dummy(), _dummyPtr(reinterpret_cast<T*>(_dummy.data())), _head(_dummyPtr), _tail(_dummyPtr)
     {
-        // _dummy is constructed from aligned_storage and is intentionally left uninitialized (it might not be default constructible)
+        // _dummy is raw zeroed storage, T is intentionally not constructed there (it might not be default constructible)
         // so we init only its IntrusiveLink here
         Atomic* dummyNext = new (&(_dummyPtr->*IntrusiveLink)) Atomic();
         dummyNext->store(nullptr, std::memory_order_relaxed);
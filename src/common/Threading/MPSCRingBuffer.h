@@ -0,0 +1,124 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPSCRingBuffer_h__
+#define MPSCRingBuffer_h__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace Trinity
+{
+// Bounded lock free queue for many producers and a single consumer, based on Dmitry Vyukov's bounded MPMC queue
+// http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+// Enqueue fails instead of allocating when the queue is full, callers decide whether to wait or drop
+template<typename T>
+class MPSCRingBuffer
+{
+public:
+    // capacity is rounded up to a power of two
+    explicit MPSCRingBuffer(std::size_t capacity) : _mask(RoundUpToPowerOfTwo(capacity) - 1), _cells(new Cell[_mask + 1])
+    {
+        for (std::size_t i = 0; i <= _mask; ++i)
+            _cells[i].Sequence.store(i, std::memory_order_relaxed);
+
+        _enqueuePos.store(0, std::memory_order_relaxed);
+        _dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    MPSCRingBuffer(MPSCRingBuffer const&) = delete;
+    MPSCRingBuffer& operator=(MPSCRingBuffer const&) = delete;
+
+    // input is only moved from if this returns true
+    bool Enqueue(T&& input)
+    {
+        Cell* cell;
+        std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &_cells[pos & _mask];
+            std::size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = std::intptr_t(sequence) - std::intptr_t(pos);
+            if (diff == 0)
+            {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false;
+            else
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+
+        cell->Data = std::move(input);
+        cell->Sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // must only be called from the consumer thread
+    bool Dequeue(T& result)
+    {
+        // only this thread writes _dequeuePos
+        std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        Cell& cell = _cells[pos & _mask];
+        std::size_t sequence = cell.Sequence.load(std::memory_order_acquire);
+        if (std::intptr_t(sequence) - std::intptr_t(pos + 1) < 0)
+            return false;
+
+        result = std::move(cell.Data);
+        cell.Sequence.store(pos + _mask + 1, std::memory_order_release);
+        _dequeuePos.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t GetCapacity() const { return _mask + 1; }
+
+    // only a hint while producers are running
+    std::size_t GetSizeApprox() const
+    {
+        std::size_t enqueued = _enqueuePos.load(std::memory_order_relaxed);
+        std::size_t dequeued = _dequeuePos.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> Sequence;
+        T Data;
+    };
+
+    static std::size_t RoundUpToPowerOfTwo(std::size_t value)
+    {
+        std::size_t result = 2;
+        while (result < value)
+            result <<= 1;
+        return result;
+    }
+
+    std::size_t const _mask;
+    std::unique_ptr<Cell[]> _cells;
+
+    alignas(64) std::atomic<std::size_t> _enqueuePos;
+    alignas(64) std::atomic<std::size_t> _dequeuePos;
+};
+}
+
+#endif // MPSCRingBuffer_h__
@@ -0,0 +1,135 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TaskGraph.h"
+#include "Errors.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace Trinity
+{
+TaskGraph::TaskId TaskGraph::AddTask(std::string name, std::initializer_list<TaskId> dependencies, std::function<void()> work)
+{
+    TaskId id = _tasks.size();
+    for (TaskId dependency : dependencies)
+        ASSERT(dependency < id, "Task %s can only depend on tasks added before it", name.c_str());
+
+    Task& task = _tasks.emplace_back();
+    task.Name = std::move(name);
+    task.Dependencies = dependencies;
+    task.Work = std::move(work);
+    return id;
+}
+
+void TaskGraph::RunTask(TaskId id, Clock::time_point graphStart)
+{
+    Task& task = _tasks[id];
+    Clock::time_point start = Clock::now();
+    task.Work();
+    Clock::time_point end = Clock::now();
+
+    task.Start = std::chrono::duration_cast<std::chrono::microseconds>(start - graphStart);
+    task.Duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+}
+
+void TaskGraph::Run(std::size_t numThreads)
+{
+    Clock::time_point graphStart = Clock::now();
+
+    if (numThreads <= 1)
+    {
+        for (TaskId id = 0; id < _tasks.size(); ++id)
+            RunTask(id, graphStart);
+    }
+    else
+    {
+        std::vector<std::vector<TaskId>> dependents(_tasks.size());
+        std::unique_ptr<std::atomic<std::size_t>[]> remaining = std::make_unique<std::atomic<std::size_t>[]>(_tasks.size());
+        for (TaskId id = 0; id < _tasks.size(); ++id)
+        {
+            remaining[id] = _tasks[id].Dependencies.size();
+            for (TaskId dependency : _tasks[id].Dependencies)
+                dependents[dependency].push_back(id);
+        }
+
+        ThreadPool pool(numThreads);
+        std::function<void(TaskId)> schedule = [&](TaskId id)
+        {
+            pool.PostWork([&, id]()
+            {
+                RunTask(id, graphStart);
+                for (TaskId dependent : dependents[id])
+                    if (remaining[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        schedule(dependent);
+            });
+        };
+
+        for (TaskId id = 0; id < _tasks.size(); ++id)
+            if (_tasks[id].Dependencies.empty())
+                schedule(id);
+
+        // returns once no task is running and none is queued
+        pool.Join();
+    }
+
+    _duration = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - graphStart);
+}
+
+std::vector<TaskGraph::TaskId> TaskGraph::GetCriticalPath() const
+{
+    if (_tasks.empty())
+        return {};
+
+    // tasks are stored in dependency order, so every dependency is final when a task is reached
+    std::vector<std::chrono::microseconds> finish(_tasks.size());
+    std::vector<TaskId> previous(_tasks.size());
+    for (TaskId id = 0; id < _tasks.size(); ++id)
+    {
+        std::chrono::microseconds longestDependency = std::chrono::microseconds::zero();
+        previous[id] = id;
+        for (TaskId dependency : _tasks[id].Dependencies)
+        {
+            if (finish[dependency] >= longestDependency)
+            {
+                longestDependency = finish[dependency];
+                previous[id] = dependency;
+            }
+        }
+
+        finish[id] = longestDependency + _tasks[id].Duration;
+    }
+
+    // prefer the later task on ties, it extends the chain of the earlier one
+    TaskId id = 0;
+    for (TaskId candidate = 1; candidate < _tasks.size(); ++candidate)
+        if (finish[candidate] >= finish[id])
+            id = candidate;
+
+    std::vector<TaskId> path;
+    path.push_back(id);
+    while (previous[id] != id)
+    {
+        id = previous[id];
+        path.push_back(id);
+    }
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+}
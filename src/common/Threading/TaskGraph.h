@@ -0,0 +1,71 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_TASK_GRAPH_H
+#define TRINITY_TASK_GRAPH_H
+
+#include "Define.h"
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace Trinity
+{
+/// Set of tasks with dependencies, run once either in the order they were added or concurrently on a thread pool
+/// Tasks can only depend on tasks added before them, so the graph never has cycles
+class TC_COMMON_API TaskGraph
+{
+public:
+    using TaskId = std::size_t;
+    using Clock = std::chrono::steady_clock;
+
+    struct Task
+    {
+        std::string Name;
+        std::vector<TaskId> Dependencies;
+        std::function<void()> Work;
+
+        // filled by Run, relative to its start
+        std::chrono::microseconds Start = std::chrono::microseconds::zero();
+        std::chrono::microseconds Duration = std::chrono::microseconds::zero();
+    };
+
+    TaskId AddTask(std::string name, std::initializer_list<TaskId> dependencies, std::function<void()> work);
+
+    // numThreads <= 1 runs all tasks on the calling thread in the order they were added
+    // returns after every task finished
+    void Run(std::size_t numThreads);
+
+    std::vector<Task> const& GetTasks() const { return _tasks; }
+
+    // wall time of the last Run
+    std::chrono::microseconds GetDuration() const { return _duration; }
+
+    // chain of dependent tasks with the longest total duration, first task first
+    std::vector<TaskId> GetCriticalPath() const;
+
+private:
+    void RunTask(TaskId id, Clock::time_point graphStart);
+
+    std::vector<Task> _tasks;
+    std::chrono::microseconds _duration = std::chrono::microseconds::zero();
+};
+}
+
+#endif // TRINITY_TASK_GRAPH_H
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_CHANGE_TRACKER_H
+#define TRINITY_CHANGE_TRACKER_H
+
+#include <map>
+#include <vector>
+
+namespace Trinity
+{
+/// Remembers the rows of a collection as they were last written to the database
+/// Save compares the current rows with them, so only inserted, updated and deleted rows have to be written
+template<class Key, class Row>
+class ChangeTracker
+{
+public:
+    using RowMap = std::map<Key, Row>;
+
+    struct Changes
+    {
+        std::vector<Key> Inserted;
+        std::vector<Key> Updated;
+        std::vector<Key> Deleted;
+
+        bool IsEmpty() const { return Inserted.empty() && Updated.empty() && Deleted.empty(); }
+        std::size_t GetCount() const { return Inserted.size() + Updated.size() + Deleted.size(); }
+    };
+
+    // false until the first Save, the whole collection has to be written then
+    bool IsTracking() const { return _tracking; }
+
+    // rows passed to the last Save
+    RowMap const& GetSaved() const { return _saved; }
+
+    // rows the database would hold if only the changes returned while verifying had been written
+    RowMap const& GetWritten() const { return _written; }
+
+    // returns the differences to the rows of the previous call and remembers rows as saved
+    // with verify the changes are also applied to GetWritten, which then drifts from GetSaved if changes were missed
+    Changes Save(RowMap rows, bool verify = false)
+    {
+        Changes changes;
+        auto saved = _saved.begin();
+        auto current = rows.begin();
+        while (saved != _saved.end() || current != rows.end())
+        {
+            if (current == rows.end() || (saved != _saved.end() && _saved.key_comp()(saved->first, current->first)))
+            {
+                changes.Deleted.push_back(saved->first);
+                ++saved;
+            }
+            else if (saved == _saved.end() || _saved.key_comp()(current->first, saved->first))
+            {
+                changes.Inserted.push_back(current->first);
+                ++current;
+            }
+            else
+            {
+                if (!(saved->second == current->second))
+                    changes.Updated.push_back(current->first);
+
+                ++saved;
+                ++current;
+            }
+        }
+
+        if (!verify)
+            _written.clear();
+        else if (_verifying)
+            _written = Apply(std::move(_written), changes, rows);
+        else
+            _written = rows;
+
+        _saved = std::move(rows);
+        _tracking = true;
+        _verifying = verify;
+        return changes;
+    }
+
+    // forgets the saved rows, the next Save reports every row as inserted and IsTracking is false until then
+    void Reset()
+    {
+        _saved.clear();
+        _written.clear();
+        _tracking = false;
+        _verifying = false;
+    }
+
+    // rows a table holding saved contains after writing changes taken from current
+    static RowMap Apply(RowMap saved, Changes const& changes, RowMap const& current)
+    {
+        for (Key const& key : changes.Deleted)
+            saved.erase(key);
+
+        for (Key const& key : changes.Updated)
+            saved[key] = current.at(key);
+
+        for (Key const& key : changes.Inserted)
+            saved.emplace(key, current.at(key));
+
+        return saved;
+    }
+
+private:
+    RowMap _saved;
+    RowMap _written;
+    bool _tracking = false;
+    bool _verifying = false;
+};
+}
+
+#endif // TRINITY_CHANGE_TRACKER_H
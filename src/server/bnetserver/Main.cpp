@@ -116,7 +116,7 @@ int main(int argc, char** argv)
     }
 
     sLog->RegisterAppender<AppenderDB>();
-    sLog->Initialize(nullptr);
+    sLog->Initialize(false);
 
     Trinity::Banner::Show("bnetserver",
         [](char const* text)
@@ -643,6 +643,7 @@ bool Battlenet::Session::Update()
 {
     EncryptableBuffer* queued;
     MessageBuffer buffer((std::size_t(BufferSizes::Read)));
+    uint32 bufferedPackets = 0;
     while (_bufferQueue.Dequeue(queued))
     {
         std::size_t packetSize = queued->Buffer.GetActiveSize();
@@ -651,12 +652,16 @@ bool Battlenet::Session::Update()
 
         if (buffer.GetRemainingSpace() < packetSize)
         {
-            QueuePacket(std::move(buffer));
+            QueuePacket(std::move(buffer), {}, bufferedPackets);
             buffer.Resize(std::size_t(BufferSizes::Read));
+            bufferedPackets = 0;
         }
 
         if (buffer.GetRemainingSpace() >= packetSize)
+        {
             buffer.Write(queued->Buffer.GetReadPointer(), packetSize);
+            ++bufferedPackets;
+        }
         else    // single packet larger than 16384 bytes - client will reject.
             QueuePacket(std::move(queued->Buffer));
 
@@ -664,7 +669,7 @@ bool Battlenet::Session::Update()
     }
 
     if (buffer.GetActiveSize() > 0)
-        QueuePacket(std::move(buffer));
+        QueuePacket(std::move(buffer), {}, bufferedPackets);
 
     if (!BattlenetSocket::Update())
         return false;
@@ -26,6 +26,7 @@
 #include "QueryResult.h"
 #include "MPSCQueue.h"
 #include <memory>
+#include <queue>
 #include <boost/asio/ip/tcp.hpp>
 
 struct Realm;
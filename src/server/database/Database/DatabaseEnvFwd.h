@@ -18,12 +18,32 @@
 #ifndef DatabaseEnvFwd_h__
 #define DatabaseEnvFwd_h__
 
+#include "Define.h"
 #include <future>
 #include <memory>
 
 struct QueryResultFieldMetadata;
 class Field;
 
+//- Lanes of the asynchronous queue, operations of a higher priority lane are executed first
+//- Order is only kept between operations of the same lane
+enum DatabaseQueuePriority
+{
+    DB_QUEUE_PRIORITY_INTERACTIVE,      // queries someone is waiting for like logins and the character list, see fence keys below
+    DB_QUEUE_PRIORITY_NORMAL,           // everything else, including all writes that depend on each other
+    DB_QUEUE_PRIORITY_BACKGROUND,       // periodic or bulk jobs that may wait behind everything else
+    MAX_DB_QUEUE_PRIORITIES
+};
+
+//- Fence keys keep interactive queries behind the queued writes they must see
+//- An interactive query with a key waits until the writes of the other lanes queued before it with the same key (an account id) are done
+//- Writes only carry a key when an interactive query reads their rows, any other operation is overtaken
+enum DatabaseFenceKey : uint32
+{
+    DB_FENCE_NONE           = 0,
+    DB_FENCE_NORMAL_LANE    = 0xFFFFFFFF    // waits for every normal lane operation queued before it, for reads without a known account id
+};
+
 class ResultSet;
 using QueryResult = std::shared_ptr<ResultSet>;
 using QueryResultFuture = std::future<QueryResult>;
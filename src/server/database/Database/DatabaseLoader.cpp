@@ -52,7 +52,15 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
 
         uint8 const synchThreads = uint8(sConfigMgr->GetIntDefault(name + "Database.SynchThreads", 1));
 
-        pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        uint8 const interactiveThreads = uint8(sConfigMgr->GetIntDefault(name + "Database.InteractiveWorkerThreads", 0));
+        if (interactiveThreads >= asyncThreads)
+        {
+            TC_LOG_ERROR(_logger, "%s database: invalid number of interactive worker threads specified. "
+                "At least one of the %u worker threads has to execute other operations.", name.c_str(), uint32(asyncThreads));
+            return false;
+        }
+
+        pool.SetConnectionInfo(dbString, asyncThreads, synchThreads, interactiveThreads);
         if (uint32 error = pool.Open())
         {
             // Database does not exist
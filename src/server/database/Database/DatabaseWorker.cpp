@@ -16,13 +16,26 @@
  */
 
 #include "DatabaseWorker.h"
+#include "MySQLConnection.h"
+#include "PreparedStatement.h"
 #include "SQLOperation.h"
-#include "ProducerConsumerQueue.h"
+#include "SQLOperationQueue.h"
+#include <vector>
 
-DatabaseWorker::DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection)
+// statements taken from the queue at once to be sent together
+static std::size_t const MAX_PIPELINED_STATEMENTS = 1000;
+
+static PreparedStatementTask* GetBatchableTask(SQLOperation* operation)
+{
+    PreparedStatementTask* task = dynamic_cast<PreparedStatementTask*>(operation);
+    return task && !task->HasResult() ? task : nullptr;
+}
+
+DatabaseWorker::DatabaseWorker(SQLOperationQueue* newQueue, MySQLConnection* connection)
 {
     _connection = connection;
     _queue = newQueue;
+    _lanes = _queue->AssignWorker();
     _cancelationToken = false;
     _workerThread = std::thread(&DatabaseWorker::WorkerThread, this);
 }
@@ -41,18 +54,65 @@ void DatabaseWorker::WorkerThread()
     if (!_queue)
         return;
 
+    SQLOperation* pending = nullptr;
     for (;;)
     {
-        SQLOperation* operation = nullptr;
+        SQLOperation* operation = pending;
+        pending = nullptr;
 
-        _queue->WaitAndPop(operation);
+        if (!operation)
+            _queue->WaitAndPop(operation, _lanes);
 
         if (_cancelationToken || !operation)
+        {
+            delete operation;
             return;
+        }
 
         operation->SetConnection(_connection);
+
+        // executions of the same INSERT queued one after another go to the server as one statement
+        PreparedStatementTask* task = GetBatchableTask(operation);
+        if (task && _connection->CanBatch(task->GetStatement(), task->GetStatement()))
+        {
+            std::vector<PreparedStatementTask*> tasks = { task };
+            while (tasks.size() < MAX_PIPELINED_STATEMENTS && _queue->Pop(pending, _lanes))
+            {
+                PreparedStatementTask* next = GetBatchableTask(pending);
+                if (!next || !_connection->CanBatch(task->GetStatement(), next->GetStatement()))
+                    break;
+
+                tasks.push_back(next);
+                pending = nullptr;
+            }
+
+            if (tasks.size() > 1)
+            {
+                std::vector<PreparedStatementBase*> statements;
+                statements.reserve(tasks.size());
+                for (PreparedStatementTask* batched : tasks)
+                    statements.push_back(batched->GetStatement());
+
+                // whatever was not executed by the batch is retried one by one, reporting errors as usual
+                for (std::size_t i = _connection->ExecuteBatch(statements); i < tasks.size(); ++i)
+                {
+                    tasks[i]->SetConnection(_connection);
+                    tasks[i]->call();
+                }
+
+                for (PreparedStatementTask* batched : tasks)
+                {
+                    _queue->Complete(batched);
+                    delete batched;
+                }
+
+                continue;
+            }
+        }
+
         operation->call();
 
+        _queue->Complete(operation);
         delete operation;
     }
 }
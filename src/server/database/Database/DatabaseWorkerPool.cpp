@@ -26,11 +26,11 @@
 #include "Log.h"
 #include "MySQLPreparedStatement.h"
 #include "PreparedStatement.h"
-#include "ProducerConsumerQueue.h"
 #include "QueryCallback.h"
 #include "QueryHolder.h"
 #include "QueryResult.h"
 #include "SQLOperation.h"
+#include "SQLOperationQueue.h"
 #include "Transaction.h"
 #include "MySQLWorkaround.h"
 #include <mysqld_error.h>
@@ -57,8 +57,8 @@ class PingOperation : public SQLOperation
 
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool()
-    : _queue(new ProducerConsumerQueue<SQLOperation*>()),
-      _async_threads(0), _synch_threads(0)
+    : _queue(new SQLOperationQueue()),
+      _async_threads(0), _synch_threads(0), _interactive_threads(0)
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
 
@@ -79,12 +79,13 @@ DatabaseWorkerPool<T>::~DatabaseWorkerPool()
 
 template <class T>
 void DatabaseWorkerPool<T>::SetConnectionInfo(std::string const& infoString,
-    uint8 const asyncThreads, uint8 const synchThreads)
+    uint8 const asyncThreads, uint8 const synchThreads, uint8 const interactiveThreads)
 {
     _connectionInfo = Trinity::make_unique<MySQLConnectionInfo>(infoString);
 
     _async_threads = asyncThreads;
     _synch_threads = synchThreads;
+    _interactive_threads = interactiveThreads;
 }
 
 template <class T>
@@ -93,9 +94,10 @@ uint32 DatabaseWorkerPool<T>::Open()
     WPFatal(_connectionInfo.get(), "Connection info was not set!");
 
     TC_LOG_INFO("sql.driver", "Opening DatabasePool '%s'. "
-        "Asynchronous connections: %u, synchronous connections: %u.",
-        GetDatabaseName(), _async_threads, _synch_threads);
+        "Asynchronous connections: %u (%u for interactive queries only), synchronous connections: %u.",
+        GetDatabaseName(), _async_threads, _interactive_threads, _synch_threads);
 
+    _queue->SetInteractiveWorkers(_interactive_threads);
     uint32 error = OpenConnections(IDX_ASYNC, _async_threads);
 
     if (error)
@@ -118,6 +120,13 @@ void DatabaseWorkerPool<T>::Close()
 {
     TC_LOG_INFO("sql.driver", "Closing down DatabasePool '%s'.", GetDatabaseName());
 
+    uint64 roundTripsSaved = 0;
+    for (auto& connections : _connections)
+        for (auto& connection : connections)
+            roundTripsSaved += connection->GetRoundTripsSaved();
+
+    TC_LOG_INFO("sql.driver", "DatabasePool '%s' saved " UI64FMTD " round trips by sending batched statements.", GetDatabaseName(), roundTripsSaved);
+
     //! Closes the actualy MySQL connection.
     _connections[IDX_ASYNC].clear();
 
@@ -215,32 +224,53 @@ PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement<T>* stmt)
 }
 
 template <class T>
-QueryCallback DatabaseWorkerPool<T>::AsyncQuery(char const* sql)
+QueryResult DatabaseWorkerPool<T>::StreamQuery(char const* sql)
+{
+    T* connection = GetFreeConnection();
+    ResultSet* result = connection->StreamQuery(sql);
+    if (!result)
+    {
+        connection->Unlock();
+        return QueryResult(nullptr);
+    }
+
+    //! From here on the result unlocks the connection
+    if (!result->NextRow())
+    {
+        delete result;
+        return QueryResult(nullptr);
+    }
+
+    return QueryResult(result);
+}
+
+template <class T>
+QueryCallback DatabaseWorkerPool<T>::AsyncQuery(char const* sql, DatabaseQueuePriority priority)
 {
     BasicStatementTask* task = new BasicStatementTask(sql, true);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     QueryResultFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, priority);
     return QueryCallback(std::move(result));
 }
 
 template <class T>
-QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
+QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt, DatabaseQueuePriority priority, uint32 fenceKey)
 {
     PreparedStatementTask* task = new PreparedStatementTask(stmt, true);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     PreparedQueryResultFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, priority, fenceKey);
     return QueryCallback(std::move(result));
 }
 
 template <class T>
-SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
+SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, DatabaseQueuePriority priority)
 {
     SQLQueryHolderTask* task = new SQLQueryHolderTask(holder);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, priority);
     return { std::move(holder), std::move(result) };
 }
 
@@ -251,7 +281,7 @@ SQLTransaction<T> DatabaseWorkerPool<T>::BeginTransaction()
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
+void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction, DatabaseQueuePriority priority, uint32 fenceKey)
 {
 #ifdef TRINITY_DEBUG
     //! Only analyze transaction weaknesses in Debug mode.
@@ -270,11 +300,11 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
     }
 #endif // TRINITY_DEBUG
 
-    Enqueue(new TransactionTask(transaction));
+    Enqueue(new TransactionTask(transaction), priority, fenceKey);
 }
 
 template <class T>
-TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction)
+TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction, DatabaseQueuePriority priority, uint32 fenceKey)
 {
 #ifdef TRINITY_DEBUG
     //! Only analyze transaction weaknesses in Debug mode.
@@ -295,7 +325,7 @@ TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction
 
     TransactionWithResultTask* task = new TransactionWithResultTask(transaction);
     TransactionFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, priority, fenceKey);
     return TransactionCallback(std::move(result));
 }
 
@@ -363,9 +393,10 @@ void DatabaseWorkerPool<T>::KeepAlive()
     //! Assuming all worker threads are free, every worker thread will receive 1 ping operation request
     //! If one or more worker threads are busy, the ping operations will not be split evenly, but this doesn't matter
     //! as the sole purpose is to prevent connections from idling.
+    //! Interactive lane is served by every worker, including the ones reserved for it.
     auto const count = _connections[IDX_ASYNC].size();
     for (uint8 i = 0; i < count; ++i)
-        Enqueue(new PingOperation);
+        Enqueue(new PingOperation, DB_QUEUE_PRIORITY_INTERACTIVE);
 }
 
 template <class T>
@@ -425,9 +456,10 @@ unsigned long DatabaseWorkerPool<T>::EscapeString(char* to, char const* from, un
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op)
+void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op, DatabaseQueuePriority priority, uint32 fenceKey)
 {
-    _queue->Push(op);
+    op->SetFenceKey(fenceKey);
+    _queue->Push(op, priority);
 }
 
 template <class T>
@@ -436,6 +468,12 @@ size_t DatabaseWorkerPool<T>::QueueSize() const
     return _queue->Size();
 }
 
+template <class T>
+size_t DatabaseWorkerPool<T>::QueueSize(DatabaseQueuePriority priority) const
+{
+    return _queue->Size(priority);
+}
+
 template <class T>
 T* DatabaseWorkerPool<T>::GetFreeConnection()
 {
@@ -471,10 +509,10 @@ void DatabaseWorkerPool<T>::Execute(char const* sql)
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt)
+void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt, DatabaseQueuePriority priority, uint32 fenceKey)
 {
     PreparedStatementTask* task = new PreparedStatementTask(stmt);
-    Enqueue(task);
+    Enqueue(task, priority, fenceKey);
 }
 
 template <class T>
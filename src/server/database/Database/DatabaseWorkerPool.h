@@ -25,10 +25,8 @@
 #include <string>
 #include <vector>
 
-template <typename T>
-class ProducerConsumerQueue;
-
 class SQLOperation;
+class SQLOperationQueue;
 struct MySQLConnectionInfo;
 
 template <class T>
@@ -48,7 +46,8 @@ class DatabaseWorkerPool
 
         ~DatabaseWorkerPool();
 
-        void SetConnectionInfo(std::string const& infoString, uint8 const asyncThreads, uint8 const synchThreads);
+        //! interactiveThreads of the asyncThreads only execute operations enqueued with DB_QUEUE_PRIORITY_INTERACTIVE
+        void SetConnectionInfo(std::string const& infoString, uint8 const asyncThreads, uint8 const synchThreads, uint8 const interactiveThreads = 0);
 
         uint32 Open();
 
@@ -83,7 +82,8 @@ class DatabaseWorkerPool
 
         //! Enqueues a one-way SQL operation in prepared statement format that will be executed asynchronously.
         //! Statement must be prepared with CONNECTION_ASYNC flag.
-        void Execute(PreparedStatement<T>* stmt);
+        //! Pass the fence key of interactive queries reading the written rows, see DatabaseFenceKey.
+        void Execute(PreparedStatement<T>* stmt, DatabaseQueuePriority priority = DB_QUEUE_PRIORITY_NORMAL, uint32 fenceKey = DB_FENCE_NONE);
 
         /**
             Direct synchronous one-way statement methods.
@@ -143,24 +143,32 @@ class DatabaseWorkerPool
         //! Statement must be prepared with CONNECTION_SYNCH flag.
         PreparedQueryResult Query(PreparedStatement<T>* stmt);
 
+        //! Directly executes an SQL query in string format, rows are read from the server one at a time while iterating the result
+        //! instead of being stored on the client first. Field values are only valid until the next NextRow call.
+        //! Keeps a synchronous connection locked until all rows are read or the result is destroyed,
+        //! do not run synchronous queries on this pool while iterating if it only has one synchronous connection.
+        //! GetRowCount returns the number of rows read so far.
+        QueryResult StreamQuery(char const* sql);
+
         /**
             Asynchronous query (with resultset) methods.
         */
 
         //! Enqueues a query in string format that will set the value of the QueryResultFuture return object as soon as the query is executed.
         //! The return value is then processed in ProcessQueryCallback methods.
-        QueryCallback AsyncQuery(char const* sql);
+        QueryCallback AsyncQuery(char const* sql, DatabaseQueuePriority priority = DB_QUEUE_PRIORITY_NORMAL);
 
         //! Enqueues a query in prepared format that will set the value of the PreparedQueryResultFuture return object as soon as the query is executed.
         //! The return value is then processed in ProcessQueryCallback methods.
         //! Statement must be prepared with CONNECTION_ASYNC flag.
-        QueryCallback AsyncQuery(PreparedStatement<T>* stmt);
+        //! Interactive queries pass a fence key to wait for the writes queued before them with the same key, see DatabaseFenceKey.
+        QueryCallback AsyncQuery(PreparedStatement<T>* stmt, DatabaseQueuePriority priority = DB_QUEUE_PRIORITY_NORMAL, uint32 fenceKey = DB_FENCE_NONE);
 
         //! Enqueues a vector of SQL operations (can be both adhoc and prepared) that will set the value of the QueryResultHolderFuture
         //! return object as soon as the query is executed.
         //! The return value is then processed in ProcessQueryCallback methods.
         //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
-        SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder);
+        SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, DatabaseQueuePriority priority = DB_QUEUE_PRIORITY_NORMAL);
 
         /**
             Transaction context methods.
@@ -171,11 +179,13 @@ class DatabaseWorkerPool
 
         //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
         //! were appended to the transaction will be respected during execution.
-        void CommitTransaction(SQLTransaction<T> transaction);
+        //! Pass the fence key of interactive queries reading the written rows, see DatabaseFenceKey.
+        void CommitTransaction(SQLTransaction<T> transaction, DatabaseQueuePriority priority = DB_QUEUE_PRIORITY_NORMAL, uint32 fenceKey = DB_FENCE_NONE);
 
         //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
         //! were appended to the transaction will be respected during execution.
-        TransactionCallback AsyncCommitTransaction(SQLTransaction<T> transaction);
+        //! Pass the fence key of interactive queries reading the written rows, see DatabaseFenceKey.
+        TransactionCallback AsyncCommitTransaction(SQLTransaction<T> transaction, DatabaseQueuePriority priority = DB_QUEUE_PRIORITY_NORMAL, uint32 fenceKey = DB_FENCE_NONE);
 
         //! Directly executes a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
         //! were appended to the transaction will be respected during execution.
@@ -207,13 +217,14 @@ class DatabaseWorkerPool
         void KeepAlive();
 
         size_t QueueSize() const;
+        size_t QueueSize(DatabaseQueuePriority priority) const;
 
     private:
         uint32 OpenConnections(InternalIndex type, uint8 numConnections);
 
         unsigned long EscapeString(char* to, char const* from, unsigned long length);
 
-        void Enqueue(SQLOperation* op);
+        void Enqueue(SQLOperation* op, DatabaseQueuePriority priority = DB_QUEUE_PRIORITY_NORMAL, uint32 fenceKey = DB_FENCE_NONE);
 
         //! Gets a free connection in the synchronous connection pool.
         //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
@@ -222,11 +233,11 @@ class DatabaseWorkerPool
         char const* GetDatabaseName() const;
 
         //! Queue shared by async worker threads.
-        std::unique_ptr<ProducerConsumerQueue<SQLOperation*>> _queue;
+        std::unique_ptr<SQLOperationQueue> _queue;
         std::array<std::vector<std::unique_ptr<T>>, IDX_SIZE> _connections;
         std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
         std::vector<uint8> _preparedStatementSize;
-        uint8 _async_threads, _synch_threads;
+        uint8 _async_threads, _synch_threads, _interactive_threads;
 };
 
 #endif
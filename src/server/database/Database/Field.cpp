@@ -237,6 +237,18 @@ std::string Field::GetString() const
     return std::string(string, data.length);
 }
 
+std::string_view Field::GetStringView() const
+{
+    if (!data.value)
+        return {};
+
+    char const* string = GetCString();
+    if (!string)
+        return {};
+
+    return std::string_view(string, data.length);
+}
+
 std::vector<uint8> Field::GetBinary() const
 {
     std::vector<uint8> result;
@@ -20,6 +20,11 @@
 
 #include "Define.h"
 #include "DatabaseEnvFwd.h"
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 enum class DatabaseFieldTypes : uint8
@@ -62,11 +67,11 @@ struct QueryResultFieldMetadata
     | BIGINT                 | GetInt64, GetUInt64                    |
     | FLOAT                  | GetFloat                               |
     | DOUBLE, DECIMAL        | GetDouble                              |
-    | CHAR, VARCHAR,         | GetCString, GetString                  |
-    | TINYTEXT, MEDIUMTEXT,  | GetCString, GetString                  |
-    | TEXT, LONGTEXT         | GetCString, GetString                  |
-    | TINYBLOB, MEDIUMBLOB,  | GetBinary, GetString                   |
-    | BLOB, LONGBLOB         | GetBinary, GetString                   |
+    | CHAR, VARCHAR,         | GetCString, GetString, GetStringView   |
+    | TINYTEXT, MEDIUMTEXT,  | GetCString, GetString, GetStringView   |
+    | TEXT, LONGTEXT         | GetCString, GetString, GetStringView   |
+    | TINYBLOB, MEDIUMBLOB,  | GetBinary, GetString, GetStringView    |
+    | BLOB, LONGBLOB         | GetBinary, GetString, GetStringView    |
     | BINARY, VARBINARY      | GetBinary                              |
 
     Return types of aggregate functions:
@@ -103,8 +108,47 @@ class TC_DATABASE_API Field
         double GetDouble() const;
         char const* GetCString() const;
         std::string GetString() const;
+        std::string_view GetStringView() const;             // points into the result set, no copy
         std::vector<uint8> GetBinary() const;
 
+        /// Typed getter for row binding, T is one of the types returned by the getters above
+        template<typename T>
+        T Get() const
+        {
+            if constexpr (std::is_same_v<T, bool>)
+                return GetBool();
+            else if constexpr (std::is_same_v<T, uint8>)
+                return GetUInt8();
+            else if constexpr (std::is_same_v<T, int8>)
+                return GetInt8();
+            else if constexpr (std::is_same_v<T, uint16>)
+                return GetUInt16();
+            else if constexpr (std::is_same_v<T, int16>)
+                return GetInt16();
+            else if constexpr (std::is_same_v<T, uint32>)
+                return GetUInt32();
+            else if constexpr (std::is_same_v<T, int32>)
+                return GetInt32();
+            else if constexpr (std::is_same_v<T, uint64>)
+                return GetUInt64();
+            else if constexpr (std::is_same_v<T, int64>)
+                return GetInt64();
+            else if constexpr (std::is_same_v<T, float>)
+                return GetFloat();
+            else if constexpr (std::is_same_v<T, double>)
+                return GetDouble();
+            else if constexpr (std::is_same_v<T, char const*>)
+                return GetCString();
+            else if constexpr (std::is_same_v<T, std::string>)
+                return GetString();
+            else if constexpr (std::is_same_v<T, std::string_view>)
+                return GetStringView();
+            else if constexpr (std::is_same_v<T, std::vector<uint8>>)
+                return GetBinary();
+            else
+                static_assert(!std::is_same_v<T, T>, "Unsupported field type");
+        }
+
         bool IsNull() const
         {
             return data.value == nullptr;
@@ -125,10 +169,31 @@ class TC_DATABASE_API Field
 
         bool IsNumeric() const;
 
+        void SetMetadata(QueryResultFieldMetadata const* fieldMeta);
+
     private:
         QueryResultFieldMetadata const* meta;
         void LogWrongType(char const* getter) const;
-        void SetMetadata(QueryResultFieldMetadata const* fieldMeta);
 };
 
+namespace Trinity
+{
+    namespace Impl
+    {
+        template<typename... Ts, std::size_t... Indexes>
+        std::tuple<Ts...> GetFields(Field const* fields, std::index_sequence<Indexes...>)
+        {
+            return std::tuple<Ts...>(fields[Indexes].template Get<Ts>()...);
+        }
+    }
+
+    /// Reads the first sizeof...(Ts) fields of a row at once, meant for structured bindings
+    /// auto [guid, entry, mapId] = Trinity::GetFields<uint32, uint32, uint16>(result->Fetch());
+    template<typename... Ts>
+    std::tuple<Ts...> GetFields(Field const* fields)
+    {
+        return Impl::GetFields<Ts...>(fields, std::index_sequence_for<Ts...>());
+    }
+}
+
 #endif
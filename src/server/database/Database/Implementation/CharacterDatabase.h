@@ -231,7 +231,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_INS_EQUIP_SET,
     CHAR_DEL_EQUIP_SET,
 
-    CHAR_INS_AURA,
+    CHAR_REP_AURA,
 
     CHAR_SEL_PLAYER_CURRENCY,
     CHAR_UPD_PLAYER_CURRENCY,
@@ -454,6 +454,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_CHARACTER,
     CHAR_DEL_CHAR_ACTION,
     CHAR_DEL_CHAR_AURA,
+    CHAR_DEL_CHAR_AURA_BY_KEY,
     CHAR_DEL_CHAR_GIFT,
     CHAR_DEL_CHAR_INSTANCE,
     CHAR_DEL_CHAR_INVENTORY,
@@ -467,6 +468,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_GUILD_EVENTLOG_BY_PLAYER,
     CHAR_DEL_GUILD_BANK_EVENTLOG_BY_PLAYER,
     CHAR_DEL_CHAR_GLYPHS,
+    CHAR_DEL_CHAR_GLYPHS_BY_TALENT_GROUP,
     CHAR_DEL_CHAR_TALENT,
     CHAR_DEL_CHAR_SKILLS,
     CHAR_UPD_CHAR_MONEY,
@@ -578,7 +580,7 @@ public:
 
     //- Constructors for sync and async connections
     CharacterDatabaseConnection(MySQLConnectionInfo& connInfo);
-    CharacterDatabaseConnection(ProducerConsumerQueue<SQLOperation*>* q, MySQLConnectionInfo& connInfo);
+    CharacterDatabaseConnection(SQLOperationQueue* q, MySQLConnectionInfo& connInfo);
     ~CharacterDatabaseConnection();
 
     //- Loads database type specific prepared statements
@@ -0,0 +1,208 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MultiRowInsert_h__
+#define MultiRowInsert_h__
+
+#include "Define.h"
+#include "PreparedStatement.h"
+#include "StringFormat.h"
+#include "Util.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/// Text building of multi-row INSERT/REPLACE statements out of executions of a single row prepared statement
+namespace Trinity::MultiRowInsert
+{
+namespace Impl
+{
+    inline bool StartsWithKeyword(std::string const& query, std::size_t pos, char const* keyword)
+    {
+        std::size_t length = std::strlen(keyword);
+        if (query.length() < pos + length)
+            return false;
+
+        for (std::size_t i = 0; i < length; ++i)
+            if (std::toupper(static_cast<unsigned char>(query[pos + i])) != keyword[i])
+                return false;
+
+        return true;
+    }
+
+    inline std::size_t FindLastKeyword(std::string const& query, char const* keyword)
+    {
+        for (std::size_t pos = query.length(); pos-- > 0;)
+            if (StartsWithKeyword(query, pos, keyword))
+                return pos;
+
+        return std::string::npos;
+    }
+}
+
+/// Splits "INSERT INTO t (a, b) VALUES (?, ?)" into the part shared by all rows and the row itself
+/// Queries with several rows, quoted values or clauses after the row are left alone and false is returned
+inline bool SplitQuery(std::string const& query, uint32 paramCount, std::string& prefix, std::string& row)
+{
+    char const* whitespace = " \t\r\n";
+    std::size_t start = query.find_first_not_of(whitespace);
+    if (start == std::string::npos || (!Impl::StartsWithKeyword(query, start, "INSERT") && !Impl::StartsWithKeyword(query, start, "REPLACE")))
+        return false;
+
+    std::size_t values = Impl::FindLastKeyword(query, "VALUES");
+    if (values == std::string::npos)
+        return false;
+
+    std::size_t rowStart = query.find_first_not_of(whitespace, values + 6);
+    std::size_t rowEnd = query.find_last_not_of(" \t\r\n;");
+    if (rowStart == std::string::npos || rowEnd == std::string::npos || rowEnd <= rowStart || query[rowStart] != '(' || query[rowEnd] != ')')
+        return false;
+
+    int32 depth = 0;
+    for (std::size_t i = rowStart; i <= rowEnd; ++i)
+    {
+        switch (query[i])
+        {
+            case '(':
+                ++depth;
+                break;
+            case ')':
+                if (--depth == 0 && i != rowEnd)
+                    return false;
+                break;
+            case '\'':
+            case '"':
+            case '`':
+                return false;
+            default:
+                break;
+        }
+    }
+
+    // all placeholders must be part of the row
+    if (std::size_t(std::count(query.begin() + rowStart, query.begin() + rowEnd + 1, '?')) != paramCount
+        || std::size_t(std::count(query.begin(), query.end(), '?')) != paramCount)
+        return false;
+
+    prefix = query.substr(0, rowStart);
+    row = query.substr(rowStart, rowEnd - rowStart + 1);
+    return true;
+}
+
+/// Appends row with its placeholders replaced by literals of values
+/// escape(sql, value, length) appends a string value escaped for the connection, without quotes
+template<class Escape>
+void AppendRow(std::string& sql, std::string const& row, std::vector<PreparedStatementData> const& values, Escape&& escape)
+{
+    std::size_t param = 0;
+    for (char c : row)
+    {
+        if (c != '?')
+        {
+            sql += c;
+            continue;
+        }
+
+        PreparedStatementData const& data = values[param++];
+        switch (data.type)
+        {
+            case TYPE_BOOL:
+                sql += data.data.boolean ? '1' : '0';
+                break;
+            case TYPE_UI8:
+                sql += std::to_string(data.data.ui8);
+                break;
+            case TYPE_UI16:
+                sql += std::to_string(data.data.ui16);
+                break;
+            case TYPE_UI32:
+                sql += std::to_string(data.data.ui32);
+                break;
+            case TYPE_UI64:
+                sql += std::to_string(data.data.ui64);
+                break;
+            case TYPE_I8:
+                sql += std::to_string(data.data.i8);
+                break;
+            case TYPE_I16:
+                sql += std::to_string(data.data.i16);
+                break;
+            case TYPE_I32:
+                sql += std::to_string(data.data.i32);
+                break;
+            case TYPE_I64:
+                sql += std::to_string(data.data.i64);
+                break;
+            // enough digits to read back the exact value
+            case TYPE_FLOAT:
+                sql += Trinity::StringFormat("%.9g", data.data.f);
+                break;
+            case TYPE_DOUBLE:
+                sql += Trinity::StringFormat("%.17g", data.data.d);
+                break;
+            case TYPE_STRING:
+                // strings are stored with their null terminator
+                sql += '\'';
+                escape(sql, reinterpret_cast<char const*>(data.binary.data()), data.binary.empty() ? 0 : data.binary.size() - 1);
+                sql += '\'';
+                break;
+            case TYPE_BINARY:
+                sql += "X'";
+                sql += ByteArrayToHexStr(data.binary.data(), uint32(data.binary.size()));
+                sql += '\'';
+                break;
+            case TYPE_NULL:
+                sql += "NULL";
+                break;
+        }
+    }
+}
+
+/// Joins rowCount rows behind prefix into as few queries as possible, a query is closed once it reaches maxQuerySize
+/// appendRow(sql, rowIndex) appends one row, execute(sql, rowsInQuery) runs a query and returns false on failure
+/// Returns the number of rows executed, all of them unless a query failed
+template<class AppendRowFn, class Execute>
+std::size_t BuildQueries(std::string const& prefix, std::size_t rowCount, std::size_t maxQuerySize, AppendRowFn&& appendRow, Execute&& execute)
+{
+    std::string sql;
+    std::size_t executed = 0;
+    for (std::size_t i = 0; i < rowCount; ++i)
+    {
+        if (sql.empty())
+            sql = prefix;
+        else
+            sql += ", ";
+
+        appendRow(sql, i);
+
+        if (sql.length() >= maxQuerySize || i + 1 == rowCount)
+        {
+            if (!execute(sql, i + 1 - executed))
+                break;
+
+            sql.clear();
+            executed = i + 1;
+        }
+    }
+
+    return executed;
+}
+}
+
+#endif // MultiRowInsert_h__
@@ -20,16 +20,23 @@
 #include "Common.h"
 #include "DatabaseWorker.h"
 #include "Log.h"
+#include "Metric.h"
+#include "MultiRowInsert.h"
 #include "MySQLHacks.h"
 #include "MySQLPreparedStatement.h"
 #include "PreparedStatement.h"
 #include "QueryResult.h"
+#include "StringFormat.h"
 #include "Timer.h"
 #include "Transaction.h"
 #include "Util.h"
 #include <errmsg.h>
 #include "MySQLWorkaround.h"
 #include <mysqld_error.h>
+#include <cmath>
+
+// multi-row statements stay well below the default max_allowed_packet of the server
+static std::size_t const MAX_BATCH_QUERY_SIZE = 1024 * 1024;
 
 MySQLConnectionInfo::MySQLConnectionInfo(std::string const& infoString)
 {
@@ -51,15 +58,17 @@ m_prepareError(false),
 m_queue(nullptr),
 m_Mysql(nullptr),
 m_connectionInfo(connInfo),
-m_connectionFlags(CONNECTION_SYNCH) { }
+m_connectionFlags(CONNECTION_SYNCH),
+m_roundTripsSaved(0) { }
 
-MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo) :
+MySQLConnection::MySQLConnection(SQLOperationQueue* queue, MySQLConnectionInfo& connInfo) :
 m_reconnecting(false),
 m_prepareError(false),
 m_queue(queue),
 m_Mysql(nullptr),
 m_connectionInfo(connInfo),
-m_connectionFlags(CONNECTION_ASYNC)
+m_connectionFlags(CONNECTION_ASYNC),
+m_roundTripsSaved(0)
 {
     m_worker = Trinity::make_unique<DatabaseWorker>(m_queue, this);
 }
@@ -209,6 +218,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
 
     uint32 _s = getMSTime();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 
     if (mysql_stmt_bind_param(msql_STMT, msql_BIND))
     {
@@ -235,6 +245,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     }
 
     TC_LOG_DEBUG("sql.sql", "[%u ms] SQL(p): %s", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString().c_str());
+    RecordLatency(m_mStmt, index, start);
 
     m_mStmt->ClearParameters();
     return true;
@@ -257,6 +268,7 @@ bool MySQLConnection::_Query(PreparedStatementBase* stmt, MySQLResult** pResult,
     MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
 
     uint32 _s = getMSTime();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 
     if (mysql_stmt_bind_param(msql_STMT, msql_BIND))
     {
@@ -284,6 +296,7 @@ bool MySQLConnection::_Query(PreparedStatementBase* stmt, MySQLResult** pResult,
     }
 
     TC_LOG_DEBUG("sql.sql", "[%u ms] SQL(p): %s", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString().c_str());
+    RecordLatency(m_mStmt, index, start);
 
     m_mStmt->ClearParameters();
 
@@ -374,16 +387,40 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
 
     BeginTransaction();
 
-    for (auto itr = queries.begin(); itr != queries.end(); ++itr)
+    for (std::size_t i = 0; i < queries.size(); ++i)
     {
-        SQLElementData const& data = *itr;
-        switch (itr->type)
+        SQLElementData const& data = queries[i];
+        switch (data.type)
         {
             case SQL_ELEMENT_PREPARED:
             {
                 PreparedStatementBase* stmt = data.element.stmt;
                 ASSERT(stmt);
-                if (!Execute(stmt))
+
+                // consecutive rows for the same INSERT are sent as one statement
+                std::vector<PreparedStatementBase*> batch;
+                if (i + 1 < queries.size() && CanBatch(stmt, stmt))
+                {
+                    batch.push_back(stmt);
+                    for (std::size_t next = i + 1; next < queries.size(); ++next)
+                    {
+                        if (queries[next].type != SQL_ELEMENT_PREPARED || !CanBatch(stmt, queries[next].element.stmt))
+                            break;
+
+                        batch.push_back(queries[next].element.stmt);
+                    }
+                }
+
+                bool success;
+                if (batch.size() > 1)
+                {
+                    success = ExecuteBatch(batch) == batch.size();
+                    i += batch.size() - 1;
+                }
+                else
+                    success = Execute(stmt);
+
+                if (!success)
                 {
                     TC_LOG_WARN("sql.sql", "Transaction aborted. %u queries not executed.", (uint32)queries.size());
                     int errorCode = GetLastError();
@@ -417,6 +454,80 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
     return 0;
 }
 
+void MySQLConnection::RecordLatency(MySQLPreparedStatement* m_mStmt, uint32 index, std::chrono::steady_clock::time_point start)
+{
+    if (!sMetric->IsEnabled())
+        return;
+
+    // registered on first use, most statements are never executed by a connection
+    if (!m_mStmt->m_latency)
+        m_mStmt->m_latency = &sMetric->RegisterHistogram(Trinity::StringFormat("db_statement_latency,database=%s,statement=%u", m_connectionInfo.database.c_str(), index),
+            { 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000 });
+
+    m_mStmt->m_latency->Record(uint64(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()));
+}
+
+bool MySQLConnection::CanBatch(PreparedStatementBase* first, PreparedStatementBase* stmt)
+{
+    if (stmt->m_index != first->m_index)
+        return false;
+
+    MySQLPreparedStatement* m_mStmt = GetPreparedStatement(stmt->m_index);
+    if (!m_mStmt || !m_mStmt->IsBatchable())
+        return false;
+
+    // inf and nan have no literal, such rows are bound as usual
+    for (PreparedStatementData const& data : stmt->statement_data)
+    {
+        if ((data.type == TYPE_FLOAT && !std::isfinite(data.data.f))
+            || (data.type == TYPE_DOUBLE && !std::isfinite(data.data.d)))
+            return false;
+    }
+
+    return true;
+}
+
+std::size_t MySQLConnection::ExecuteBatch(std::vector<PreparedStatementBase*> const& statements)
+{
+    ASSERT(!statements.empty());
+
+    uint32 index = statements.front()->m_index;
+    MySQLPreparedStatement* m_mStmt = GetPreparedStatement(index);
+    ASSERT(m_mStmt && m_mStmt->IsBatchable());
+
+    auto escape = [this](std::string& sql, char const* value, std::size_t length)
+    {
+        std::vector<char> escaped(length * 2 + 1);
+        sql.append(escaped.data(), EscapeString(escaped.data(), value, length));
+    };
+
+    std::size_t queryCount = 0;
+    std::size_t executed = Trinity::MultiRowInsert::BuildQueries(m_mStmt->m_batchPrefix, statements.size(), MAX_BATCH_QUERY_SIZE,
+        [&](std::string& sql, std::size_t i)
+        {
+            Trinity::MultiRowInsert::AppendRow(sql, m_mStmt->m_batchRow, statements[i]->statement_data, escape);
+        },
+        [&](std::string const& sql, std::size_t /*rowCount*/)
+        {
+            // a multi-row query is one sample of the statement, its rows are not timed separately
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            if (!Execute(sql.c_str()))
+                return false;
+
+            RecordLatency(m_mStmt, index, start);
+            ++queryCount;
+            return true;
+        });
+
+    if (uint64 saved = executed - queryCount)
+    {
+        m_roundTripsSaved.fetch_add(saved, std::memory_order_relaxed);
+        TC_METRIC_COUNTER("db_round_trips_saved", saved);
+    }
+
+    return executed;
+}
+
 size_t MySQLConnection::EscapeString(char* to, const char* from, size_t length)
 {
     return mysql_real_escape_string(m_Mysql, to, from, length);
@@ -506,6 +617,36 @@ PreparedResultSet* MySQLConnection::Query(PreparedStatementBase* stmt)
     return new PreparedResultSet(stmt->m_stmt->GetSTMT(), result, rowCount, fieldCount);
 }
 
+ResultSet* MySQLConnection::StreamQuery(char const* sql)
+{
+    if (!sql || !m_Mysql)
+        return nullptr;
+
+    uint32 _s = getMSTime();
+
+    if (mysql_query(m_Mysql, sql))
+    {
+        uint32 lErrno = mysql_errno(m_Mysql);
+        TC_LOG_INFO("sql.sql", "SQL: %s", sql);
+        TC_LOG_ERROR("sql.sql", "[%u] %s", lErrno, mysql_error(m_Mysql));
+
+        if (_HandleMySQLErrno(lErrno))      // If it returns true, an error was handled successfully (i.e. reconnection)
+            return StreamQuery(sql);        // We try again
+
+        return nullptr;
+    }
+
+    TC_LOG_DEBUG("sql.sql", "[%u ms] SQL(stream): %s", getMSTimeDiff(_s, getMSTime()), sql);
+
+    // unlike mysql_store_result rows stay on the server until fetched
+    MySQLResult* result = reinterpret_cast<MySQLResult*>(mysql_use_result(m_Mysql));
+    if (!result)
+        return nullptr;
+
+    MySQLField* fields = reinterpret_cast<MySQLField*>(mysql_fetch_fields(result));
+    return new ResultSet(result, fields, 0, mysql_field_count(m_Mysql), this);
+}
+
 bool MySQLConnection::_HandleMySQLErrno(uint32 errNo, uint8 attempts /*= 5*/)
 {
     switch (errNo)
@@ -20,18 +20,18 @@
 
 #include "Define.h"
 #include "DatabaseEnvFwd.h"
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
 
-template <typename T>
-class ProducerConsumerQueue;
-
 class DatabaseWorker;
 class MySQLPreparedStatement;
 class SQLOperation;
+class SQLOperationQueue;
 
 enum ConnectionFlags
 {
@@ -55,10 +55,11 @@ class TC_DATABASE_API MySQLConnection
 {
     template <class T> friend class DatabaseWorkerPool;
     friend class PingOperation;
+    friend class ResultSet;
 
     public:
         MySQLConnection(MySQLConnectionInfo& connInfo);                               //! Constructor for synchronous connections.
-        MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo);  //! Constructor for asynchronous connections.
+        MySQLConnection(SQLOperationQueue* queue, MySQLConnectionInfo& connInfo);     //! Constructor for asynchronous connections.
         virtual ~MySQLConnection();
 
         virtual uint32 Open();
@@ -70,6 +71,8 @@ class TC_DATABASE_API MySQLConnection
         bool Execute(PreparedStatementBase* stmt);
         ResultSet* Query(char const* sql);
         PreparedResultSet* Query(PreparedStatementBase* stmt);
+        /// Rows are read from the server while iterating the returned result, which takes over unlocking this connection
+        ResultSet* StreamQuery(char const* sql);
         bool _Query(char const* sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount);
         bool _Query(PreparedStatementBase* stmt, MySQLResult** pResult, uint64* pRowCount, uint32* pFieldCount);
 
@@ -77,6 +80,12 @@ class TC_DATABASE_API MySQLConnection
         void RollbackTransaction();
         void CommitTransaction();
         int ExecuteTransaction(std::shared_ptr<TransactionBase> transaction);
+        /// True if stmt can be sent in the same multi-row statement as first
+        bool CanBatch(PreparedStatementBase* first, PreparedStatementBase* stmt);
+        /// Executes statements accepted by CanBatch with the first of them using as few queries as possible
+        /// Returns the number of statements executed, all of them unless a query failed
+        std::size_t ExecuteBatch(std::vector<PreparedStatementBase*> const& statements);
+        uint64 GetRoundTripsSaved() const { return m_roundTripsSaved.load(std::memory_order_relaxed); }
         size_t EscapeString(char* to, const char* from, size_t length);
         void Ping();
 
@@ -104,13 +113,16 @@ class TC_DATABASE_API MySQLConnection
 
     private:
         bool _HandleMySQLErrno(uint32 errNo, uint8 attempts = 5);
+        /// Adds the time since start to the db_statement_latency histogram of the statement
+        void RecordLatency(MySQLPreparedStatement* m_mStmt, uint32 index, std::chrono::steady_clock::time_point start);
 
-        ProducerConsumerQueue<SQLOperation*>* m_queue;      //! Queue shared with other asynchronous connections.
+        SQLOperationQueue*    m_queue;                      //! Queue shared with other asynchronous connections.
         std::unique_ptr<DatabaseWorker> m_worker;           //! Core worker task.
         MySQLHandle*          m_Mysql;                      //! MySQL Handle.
         MySQLConnectionInfo&  m_connectionInfo;             //! Connection info (used for logging)
         ConnectionFlags       m_connectionFlags;            //! Connection flags (for preparing relevant statements)
         std::mutex            m_Mutex;
+        std::atomic<uint64>   m_roundTripsSaved;            //! Statements that were sent as part of a multi-row statement instead of on their own
 
         MySQLConnection(MySQLConnection const& right) = delete;
         MySQLConnection& operator=(MySQLConnection const& right) = delete;
@@ -18,13 +18,14 @@
 #include "MySQLPreparedStatement.h"
 #include "Errors.h"
 #include "Log.h"
+#include "MultiRowInsert.h"
 #include "MySQLHacks.h"
 #include "PreparedStatement.h"
 #include <cstring>
 #include <sstream>
 
 MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt* stmt, std::string queryString) :
-    m_stmt(nullptr), m_Mstmt(stmt), m_bind(nullptr), m_queryString(std::move(queryString))
+    m_stmt(nullptr), m_Mstmt(stmt), m_bind(nullptr), m_queryString(std::move(queryString)), m_latency(nullptr)
 {
     /// Initialize variable parameters
     m_paramCount = mysql_stmt_param_count(stmt);
@@ -32,6 +33,8 @@ MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt* stmt, std::string quer
     m_bind = new MySQLBind[m_paramCount];
     memset(m_bind, 0, sizeof(MySQLBind) * m_paramCount);
 
+    Trinity::MultiRowInsert::SplitQuery(m_queryString, m_paramCount, m_batchPrefix, m_batchRow);
+
     /// "If set to 1, causes mysql_stmt_store_result() to update the metadata MYSQL_FIELD->max_length value."
     MySQLBool bool_tmp = MySQLBool(1);
     mysql_stmt_attr_set(stmt, STMT_ATTR_UPDATE_MAX_LENGTH, &bool_tmp);
@@ -23,6 +23,7 @@
 #include <string>
 #include <vector>
 
+class MetricHistogram;
 class MySQLConnection;
 class PreparedStatementBase;
 
@@ -54,6 +55,9 @@ class TC_DATABASE_API MySQLPreparedStatement
 
         uint32 GetParameterCount() const { return m_paramCount; }
 
+        /// INSERT/REPLACE of a single row, executions of it can be sent to the server as one multi-row statement
+        bool IsBatchable() const { return !m_batchPrefix.empty(); }
+
     protected:
         MySQLStmt* GetSTMT() { return m_Mstmt; }
         MySQLBind* GetBind() { return m_bind; }
@@ -68,6 +72,9 @@ class TC_DATABASE_API MySQLPreparedStatement
         std::vector<bool> m_paramsSet;
         MySQLBind* m_bind;
         std::string const m_queryString;
+        std::string m_batchPrefix;                          //! Query up to the row values, empty if not batchable
+        std::string m_batchRow;                             //! Row values with placeholders
+        MetricHistogram* m_latency;                         //! Execution times, registered on first use while metrics are enabled
 
         MySQLPreparedStatement(MySQLPreparedStatement const& right) = delete;
         MySQLPreparedStatement& operator=(MySQLPreparedStatement const& right) = delete;
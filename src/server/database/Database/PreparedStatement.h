@@ -99,6 +99,8 @@ class TC_DATABASE_API PreparedStatementBase
         void setBinary(uint8 index, std::vector<uint8> const& value);
 
         uint32 GetIndex() const { return m_index; }
+        // same statement with the same parameters bound
+        bool IsSameStatement(PreparedStatementBase const& right) const;
     protected:
         void BindParameters(MySQLPreparedStatement* stmt);
 
@@ -135,6 +137,8 @@ class TC_DATABASE_API PreparedStatementTask : public SQLOperation
 
         bool Execute() override;
         PreparedQueryResultFuture GetFuture() { return m_result->get_future(); }
+        PreparedStatementBase* GetStatement() const { return m_stmt; }
+        bool HasResult() const { return m_has_result; }
 
     protected:
         PreparedStatementBase* m_stmt;
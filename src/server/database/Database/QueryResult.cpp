@@ -19,6 +19,7 @@
 #include "Errors.h"
 #include "Field.h"
 #include "Log.h"
+#include "MySQLConnection.h"
 #include "MySQLHacks.h"
 #include "MySQLWorkaround.h"
 #include <cstring>
@@ -165,11 +166,13 @@ void InitializeDatabaseFieldMetadata(QueryResultFieldMetadata* meta, MySQLField
 }
 }
 
-ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount) :
+ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount, MySQLConnection* streamConnection /*= nullptr*/) :
 _rowCount(rowCount),
 _fieldCount(fieldCount),
 _result(result),
-_fields(fields)
+_fields(fields),
+_streamConnection(streamConnection),
+_isStream(streamConnection != nullptr)
 {
     _fieldMetadata.resize(_fieldCount);
     _currentRow = new Field[_fieldCount];
@@ -332,6 +335,10 @@ bool ResultSet::NextRow()
     row = mysql_fetch_row(_result);
     if (!row)
     {
+        // streamed rows arrive while iterating, a failure here is a lost connection and not the end of the result
+        if (_isStream && mysql_errno(_result->handle))
+            TC_LOG_ERROR("sql.sql", "%s:mysql_fetch_row, cannot fetch streamed row. Error %s.", __FUNCTION__, mysql_error(_result->handle));
+
         CleanUp();
         return false;
     }
@@ -347,6 +354,9 @@ bool ResultSet::NextRow()
     for (uint32 i = 0; i < _fieldCount; i++)
         _currentRow[i].SetStructuredValue(row[i], lengths[i]);
 
+    if (_isStream)
+        ++_rowCount;
+
     return true;
 }
 
@@ -381,9 +391,16 @@ void ResultSet::CleanUp()
 
     if (_result)
     {
+        // also discards streamed rows that were not fetched
         mysql_free_result(_result);
         _result = nullptr;
     }
+
+    if (_streamConnection)
+    {
+        _streamConnection->Unlock();
+        _streamConnection = nullptr;
+    }
 }
 
 Field const& ResultSet::operator[](std::size_t index) const
@@ -22,14 +22,18 @@
 #include "DatabaseEnvFwd.h"
 #include <vector>
 
+class MySQLConnection;
+
 class TC_DATABASE_API ResultSet
 {
     public:
-        ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount);
+        /// streamConnection is set for results read with mysql_use_result, rows are then fetched from the server
+        /// one at a time by NextRow and the connection is unlocked when all rows are read or the result is destroyed
+        ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount, MySQLConnection* streamConnection = nullptr);
         ~ResultSet();
 
         bool NextRow();
-        uint64 GetRowCount() const { return _rowCount; }
+        uint64 GetRowCount() const { return _rowCount; }    // rows fetched so far for streamed results
         uint32 GetFieldCount() const { return _fieldCount; }
 
         Field* Fetch() const { return _currentRow; }
@@ -45,6 +49,8 @@ class TC_DATABASE_API ResultSet
         void CleanUp();
         MySQLResult* _result;
         MySQLField* _fields;
+        MySQLConnection* _streamConnection;
+        bool _isStream;
 
         ResultSet(ResultSet const& right) = delete;
         ResultSet& operator=(ResultSet const& right) = delete;
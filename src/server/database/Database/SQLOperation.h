@@ -46,8 +46,10 @@ class MySQLConnection;
 
 class TC_DATABASE_API SQLOperation
 {
+    friend class SQLOperationQueue;
+
     public:
-        SQLOperation(): m_conn(nullptr) { }
+        SQLOperation(): m_conn(nullptr), _fenceKey(DB_FENCE_NONE), _queueSequence(0), _queueLane(DB_QUEUE_PRIORITY_NORMAL) { }
         virtual ~SQLOperation() { }
 
         virtual int call()
@@ -58,9 +60,16 @@ class TC_DATABASE_API SQLOperation
         virtual bool Execute() = 0;
         virtual void SetConnection(MySQLConnection* con) { m_conn = con; }
 
+        /// Account id (or DB_FENCE_NORMAL_LANE) used to order this operation against interactive queries, see DatabaseFenceKey
+        void SetFenceKey(uint32 key) { _fenceKey = key; }
+
         MySQLConnection* m_conn;
 
     private:
+        uint32 _fenceKey;
+        uint64 _queueSequence;                              // set by SQLOperationQueue::Push
+        DatabaseQueuePriority _queueLane;
+
         SQLOperation(SQLOperation const& right) = delete;
         SQLOperation& operator=(SQLOperation const& right) = delete;
 };
@@ -0,0 +1,274 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "SQLOperationQueue.h"
+#include "Errors.h"
+#include "SQLOperation.h"
+#include <algorithm>
+
+SQLOperationQueue::SQLOperationQueue() : _shutdown(false), _interactiveWorkers(0), _assignedWorkers(0), _waitingInteractiveWorkers(0),
+    _nextSequence(0), _fencedReadCount(0)
+{
+}
+
+SQLOperationQueue::~SQLOperationQueue()
+{
+    Cancel();
+}
+
+void SQLOperationQueue::Push(SQLOperation* operation, DatabaseQueuePriority priority)
+{
+    bool wakeInteractiveWorker;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        operation->_queueSequence = ++_nextSequence;
+        operation->_queueLane = priority;
+
+        // fences only close for operations queued before, a read held back here is released by Complete
+        if (priority == DB_QUEUE_PRIORITY_INTERACTIVE && !IsFenceOpen(operation))
+        {
+            _fencedReads[operation->_fenceKey].push(operation);
+            ++_fencedReadCount;
+            return;
+        }
+
+        if (priority != DB_QUEUE_PRIORITY_INTERACTIVE && operation->_fenceKey != DB_FENCE_NONE && operation->_fenceKey != DB_FENCE_NORMAL_LANE)
+            _fencedWrites[operation->_fenceKey].insert(operation->_queueSequence);
+
+        _lanes[priority].push(operation);
+
+        // idle reserved workers take interactive operations first, every other worker can take any operation
+        wakeInteractiveWorker = priority == DB_QUEUE_PRIORITY_INTERACTIVE && _waitingInteractiveWorkers > 0;
+    }
+
+    if (wakeInteractiveWorker)
+        _interactiveCondition.notify_one();
+    else
+        _condition.notify_one();
+}
+
+bool SQLOperationQueue::PopLocked(SQLOperation*& operation, uint32 laneMask)
+{
+    for (uint32 lane = 0; lane < MAX_DB_QUEUE_PRIORITIES; ++lane)
+    {
+        if (!(laneMask & (1 << lane)) || _lanes[lane].empty())
+            continue;
+
+        operation = _lanes[lane].front();
+        _lanes[lane].pop();
+
+        if (lane == DB_QUEUE_PRIORITY_NORMAL)
+            _runningNormalOperations.push_back(operation->_queueSequence);
+
+        return true;
+    }
+
+    return false;
+}
+
+bool SQLOperationQueue::IsFenceOpen(SQLOperation const* operation) const
+{
+    uint64 sequence = operation->_queueSequence;
+    switch (operation->_fenceKey)
+    {
+        case DB_FENCE_NONE:
+            return true;
+        case DB_FENCE_NORMAL_LANE:
+        {
+            // the normal lane is taken in order, its front is the oldest operation still queued
+            std::queue<SQLOperation*> const& normal = _lanes[DB_QUEUE_PRIORITY_NORMAL];
+            if (!normal.empty() && normal.front()->_queueSequence < sequence)
+                return false;
+
+            return std::none_of(_runningNormalOperations.begin(), _runningNormalOperations.end(), [sequence](uint64 running) { return running < sequence; });
+        }
+        default:
+        {
+            auto itr = _fencedWrites.find(operation->_fenceKey);
+            return itr == _fencedWrites.end() || *itr->second.begin() > sequence;
+        }
+    }
+}
+
+bool SQLOperationQueue::ReleaseFencedReads(uint32 fenceKey)
+{
+    auto itr = _fencedReads.find(fenceKey);
+    if (itr == _fencedReads.end())
+        return false;
+
+    // held back reads of a key are in queue order, so are the fences they wait for
+    std::queue<SQLOperation*>& reads = itr->second;
+    bool released = false;
+    while (!reads.empty() && IsFenceOpen(reads.front()))
+    {
+        _lanes[DB_QUEUE_PRIORITY_INTERACTIVE].push(reads.front());
+        reads.pop();
+        --_fencedReadCount;
+        released = true;
+    }
+
+    if (reads.empty())
+        _fencedReads.erase(itr);
+
+    return released;
+}
+
+bool SQLOperationQueue::Pop(SQLOperation*& operation, uint32 laneMask)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    if (_shutdown)
+        return false;
+
+    return PopLocked(operation, laneMask);
+}
+
+void SQLOperationQueue::WaitAndPop(SQLOperation*& operation, uint32 laneMask)
+{
+    ASSERT(laneMask == ALL_LANES || laneMask == INTERACTIVE_LANE);
+
+    bool interactiveOnly = laneMask == INTERACTIVE_LANE;
+    std::condition_variable& condition = interactiveOnly ? _interactiveCondition : _condition;
+
+    std::unique_lock<std::mutex> lock(_lock);
+
+    while (!_shutdown && !PopLocked(operation, laneMask))
+    {
+        if (interactiveOnly)
+            ++_waitingInteractiveWorkers;
+
+        condition.wait(lock);
+
+        if (interactiveOnly)
+            --_waitingInteractiveWorkers;
+    }
+}
+
+void SQLOperationQueue::Complete(SQLOperation* operation)
+{
+    // nothing waits for interactive operations, background ones only matter when they carry a fence key
+    bool fencedWrite = operation->_fenceKey != DB_FENCE_NONE && operation->_fenceKey != DB_FENCE_NORMAL_LANE;
+    if (operation->_queueLane == DB_QUEUE_PRIORITY_INTERACTIVE || (operation->_queueLane == DB_QUEUE_PRIORITY_BACKGROUND && !fencedWrite))
+        return;
+
+    bool released = false;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        if (fencedWrite)
+        {
+            auto itr = _fencedWrites.find(operation->_fenceKey);
+            if (itr != _fencedWrites.end())
+            {
+                itr->second.erase(operation->_queueSequence);
+                if (itr->second.empty())
+                    _fencedWrites.erase(itr);
+            }
+
+            released = ReleaseFencedReads(operation->_fenceKey);
+        }
+
+        if (operation->_queueLane == DB_QUEUE_PRIORITY_NORMAL)
+        {
+            auto itr = std::find(_runningNormalOperations.begin(), _runningNormalOperations.end(), operation->_queueSequence);
+            if (itr != _runningNormalOperations.end())
+            {
+                *itr = _runningNormalOperations.back();
+                _runningNormalOperations.pop_back();
+            }
+
+            released = ReleaseFencedReads(DB_FENCE_NORMAL_LANE) || released;
+        }
+    }
+
+    // reserved and regular workers can both take the released reads
+    if (released)
+    {
+        _interactiveCondition.notify_all();
+        _condition.notify_all();
+    }
+}
+
+void SQLOperationQueue::Cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        for (std::queue<SQLOperation*>& lane : _lanes)
+        {
+            while (!lane.empty())
+            {
+                delete lane.front();
+                lane.pop();
+            }
+        }
+
+        for (auto& reads : _fencedReads)
+        {
+            while (!reads.second.empty())
+            {
+                delete reads.second.front();
+                reads.second.pop();
+            }
+        }
+
+        _fencedReads.clear();
+        _fencedReadCount = 0;
+        _fencedWrites.clear();
+        _shutdown = true;
+    }
+
+    _condition.notify_all();
+    _interactiveCondition.notify_all();
+}
+
+size_t SQLOperationQueue::Size() const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    size_t size = _fencedReadCount;
+    for (std::queue<SQLOperation*> const& lane : _lanes)
+        size += lane.size();
+
+    return size;
+}
+
+size_t SQLOperationQueue::Size(DatabaseQueuePriority priority) const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    if (priority == DB_QUEUE_PRIORITY_INTERACTIVE)
+        return _lanes[priority].size() + _fencedReadCount;
+
+    return _lanes[priority].size();
+}
+
+void SQLOperationQueue::SetInteractiveWorkers(uint8 count)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    _interactiveWorkers = count;
+    _assignedWorkers = 0;
+}
+
+uint32 SQLOperationQueue::AssignWorker()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    if (_assignedWorkers++ < _interactiveWorkers)
+        return INTERACTIVE_LANE;
+
+    return ALL_LANES;
+}
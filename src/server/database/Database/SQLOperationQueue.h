@@ -0,0 +1,93 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SQLOperationQueue_h__
+#define SQLOperationQueue_h__
+
+#include "Define.h"
+#include "DatabaseEnvFwd.h"
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+class SQLOperation;
+
+/// Queue shared by the asynchronous connections of a DatabaseWorkerPool, one FIFO lane per DatabaseQueuePriority
+/// Every worker serves a set of lanes and always takes from the highest priority lane that has operations
+/// Interactive operations with a DatabaseFenceKey are held back until the operations they wait for are done
+class TC_DATABASE_API SQLOperationQueue
+{
+    public:
+        SQLOperationQueue();
+        ~SQLOperationQueue();
+
+        void Push(SQLOperation* operation, DatabaseQueuePriority priority);
+
+        /// Takes the next operation of the given lanes without waiting, returns false if there is none
+        bool Pop(SQLOperation*& operation, uint32 laneMask);
+
+        /// Waits for the next operation of the given lanes, operation stays nullptr if the queue was cancelled
+        void WaitAndPop(SQLOperation*& operation, uint32 laneMask);
+
+        /// Called by workers after executing an operation taken from the queue, releases the interactive operations waiting for it
+        void Complete(SQLOperation* operation);
+
+        /// Deletes all queued operations and wakes up all waiting workers
+        void Cancel();
+
+        size_t Size() const;
+        size_t Size(DatabaseQueuePriority priority) const;
+
+        /// The first count workers assigned after this call only serve the interactive lane
+        void SetInteractiveWorkers(uint8 count);
+
+        /// Returns the lanes served by the next worker started on this queue, either ALL_LANES or INTERACTIVE_LANE
+        uint32 AssignWorker();
+
+        static constexpr uint32 ALL_LANES = (1 << MAX_DB_QUEUE_PRIORITIES) - 1;
+        static constexpr uint32 INTERACTIVE_LANE = 1 << DB_QUEUE_PRIORITY_INTERACTIVE;
+
+    private:
+        mutable std::mutex _lock;
+        std::condition_variable _condition;             //! Workers serving all lanes wait here
+        std::condition_variable _interactiveCondition;  //! Workers reserved for the interactive lane wait here
+        std::array<std::queue<SQLOperation*>, MAX_DB_QUEUE_PRIORITIES> _lanes;
+        bool _shutdown;
+        uint8 _interactiveWorkers;
+        uint8 _assignedWorkers;
+        uint8 _waitingInteractiveWorkers;
+
+        uint64 _nextSequence;
+        std::unordered_map<uint32, std::set<uint64>> _fencedWrites;                 //! Sequences of queued or running writes by fence key
+        std::unordered_map<uint32, std::queue<SQLOperation*>> _fencedReads;         //! Interactive operations kept out of their lane by fence key
+        size_t _fencedReadCount;
+        std::vector<uint64> _runningNormalOperations;                               //! Sequences of normal lane operations taken by workers
+
+        bool PopLocked(SQLOperation*& operation, uint32 laneMask);
+        bool IsFenceOpen(SQLOperation const* operation) const;
+        bool ReleaseFencedReads(uint32 fenceKey);
+
+        SQLOperationQueue(SQLOperationQueue const& right) = delete;
+        SQLOperationQueue& operator=(SQLOperationQueue const& right) = delete;
+};
+
+#endif // SQLOperationQueue_h__
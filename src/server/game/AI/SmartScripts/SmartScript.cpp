@@ -147,6 +147,7 @@ uint32 SmartScript::GetCounterValue(uint32 id) const
 
 GameObject* SmartScript::FindGameObjectNear(WorldObject* searchObject, ObjectGuid::LowType guid) const
 {
+    std::unique_lock<std::recursive_mutex> guard = searchObject->GetMap()->AcquireRegionUpdateLock();
     auto bounds = searchObject->GetMap()->GetGameObjectBySpawnIdStore().equal_range(guid);
     if (bounds.first == bounds.second)
         return nullptr;
@@ -156,6 +157,7 @@ GameObject* SmartScript::FindGameObjectNear(WorldObject* searchObject, ObjectGui
 
 Creature* SmartScript::FindCreatureNear(WorldObject* searchObject, ObjectGuid::LowType guid) const
 {
+    std::unique_lock<std::recursive_mutex> guard = searchObject->GetMap()->AcquireRegionUpdateLock();
     auto bounds = searchObject->GetMap()->GetCreatureBySpawnIdStore().equal_range(guid);
     if (bounds.first == bounds.second)
         return nullptr;
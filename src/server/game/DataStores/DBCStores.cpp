@@ -290,7 +290,7 @@ namespace
 }
 
 template<class T>
-inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename, uint32 defaultLocale, std::string const& customFormat = std::string(), std::string const& customIndexName = std::string())
+inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& cacheDir, std::string const& filename, uint32 defaultLocale, std::string const& customFormat = std::string(), std::string const& customIndexName = std::string())
 {
     // compatibility format and C++ structure sizes
     ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
@@ -298,7 +298,7 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
     ++DBCFileCount;
     std::string dbcFilename = dbcPath + localeNames[defaultLocale] + '/' + filename;
 
-    if (storage.Load(dbcFilename))
+    if (storage.Load(dbcFilename, cacheDir))
     {
         for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
         {
@@ -333,7 +333,7 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
     }
 }
 
-void DBCManager::LoadStores(const std::string& dataPath, uint32 defaultLocale)
+void DBCManager::LoadStores(const std::string& dataPath, std::string const& cacheDir, uint32 defaultLocale)
 {
     uint32 oldMSTime = getMSTime();
 
@@ -350,7 +350,7 @@ void DBCManager::LoadStores(const std::string& dataPath, uint32 defaultLocale)
     DBCStorage<PhaseGroupEntry> sPhaseGroupStore(PhaseGroupfmt);
     DBCStorage<TalentTreePrimarySpellsEntry> sTalentTreePrimarySpellsStore(TalentTreePrimarySpellsfmt);
 
-#define LOAD_DBC(store, file) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file, defaultLocale)
+#define LOAD_DBC(store, file) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, cacheDir, file, defaultLocale)
 
     LOAD_DBC(sAreaTableStore,                     "AreaTable.dbc");
     LOAD_DBC(sAnimKitStore,                       "AnimKit.dbc");//15595
@@ -521,7 +521,7 @@ void DBCManager::LoadStores(const std::string& dataPath, uint32 defaultLocale)
 
 #undef LOAD_DBC
 
-#define LOAD_DBC_EXT(store, file, dbformat, dbpk) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file, defaultLocale, dbformat, dbpk)
+#define LOAD_DBC_EXT(store, file, dbformat, dbpk) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, cacheDir, file, defaultLocale, dbformat, dbpk)
 
     LOAD_DBC_EXT(sAchievementStore,     "Achievement.dbc",     CustomAchievementfmt,            CustomAchievementIndex);//15595
     LOAD_DBC_EXT(sSpellStore,           "Spell.dbc",           CustomSpellEntryfmt,             CustomSpellEntryIndex);//15595
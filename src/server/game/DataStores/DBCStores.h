@@ -215,7 +215,8 @@ class TC_GAME_API DBCManager
 public:
     static DBCManager& Instance();
 
-    void LoadStores(const std::string& dataPath, uint32 defaultLocale);
+    // cacheDir keeps converted copies of tables without strings for later starts, empty disables it
+    void LoadStores(const std::string& dataPath, std::string const& cacheDir, uint32 defaultLocale);
 
     SimpleFactionsList const* GetFactionTeamList(uint32 faction);
     static char const* GetPetName(uint32 petfamily, uint32 dbclang);
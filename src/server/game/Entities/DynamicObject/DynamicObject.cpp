@@ -30,6 +30,7 @@
 #include "Transport.h"
 #include "Unit.h"
 #include "UpdateData.h"
+#include "UpdateFieldFlags.h"
 
 DynamicObject::DynamicObject(bool isWorldObject) : WorldObject(isWorldObject),
     _aura(nullptr), _removedAura(nullptr), _caster(nullptr), _duration(0), _isViewpoint(false)
@@ -180,13 +181,14 @@ void DynamicObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
     ASSERT(flags);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    std::array<UpdateMask::BlockType, UPDATE_MASK_MAX_BLOCKS> blocks;
+    uint32 blockCount = BuildValuesUpdateMask(updateType, flags, visibleFlag, m_valuesCount, blocks.data());
+    for (uint32 block = 0; block < blockCount; ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
+        updateMask.SetBlock(block, blocks[block]);
+        for (UpdateMask::BlockType bits = blocks[block]; bits; bits &= bits - 1)
         {
-            updateMask.SetBit(index);
-
+            uint16 index = block * UpdateMask::BLOCK_BITS + UpdateMask::GetFirstSetBit(bits);
             if (index == DYNAMICOBJECT_BYTES)
             {
                 if (Unit* caster = GetCaster())
@@ -215,6 +217,12 @@ void DynamicObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player
     data->append(fieldBuffer);
 }
 
+bool DynamicObject::IsValuesUpdateSharedBetweenViewers() const
+{
+    // spell visual may be replaced depending on caster reaction to the target
+    return !IsUpdateFieldPending(DYNAMICOBJECT_BYTES, DynamicObjectUpdateFieldFlags);
+}
+
 int32 DynamicObject::GetDuration() const
 {
     if (!_aura)
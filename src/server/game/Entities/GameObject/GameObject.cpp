@@ -2896,14 +2896,17 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
     if (GetOwnerGUID() == target->GetGUID())
         visibleFlag |= UF_FLAG_OWNER;
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    std::array<UpdateMask::BlockType, UPDATE_MASK_MAX_BLOCKS> blocks;
+    uint32 blockCount = BuildValuesUpdateMask(updateType, flags, visibleFlag, m_valuesCount, blocks.data());
+    if (forcedFlags)
+        blocks[UpdateMask::GetBlockIndex(GAMEOBJECT_FLAGS)] |= UpdateMask::GetBlockFlag(GAMEOBJECT_FLAGS);
+
+    for (uint32 block = 0; block < blockCount; ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-            (index == GAMEOBJECT_FLAGS && forcedFlags))
+        updateMask.SetBlock(block, blocks[block]);
+        for (UpdateMask::BlockType bits = blocks[block]; bits; bits &= bits - 1)
         {
-            updateMask.SetBit(index);
-
+            uint16 index = block * UpdateMask::BLOCK_BITS + UpdateMask::GetFirstSetBit(bits);
             if (index == GAMEOBJECT_DYNAMIC)
             {
                 uint32 dynamicFlags = m_uint32Values[GAMEOBJECT_DYNAMIC];
@@ -2958,6 +2961,26 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
     data->append(fieldBuffer);
 }
 
+bool GameObject::IsValuesUpdateSharedBetweenViewers() const
+{
+    // quest activation and group loot rights are per target, gm state is part of the viewer class
+    switch (GetGoType())
+    {
+        case GAMEOBJECT_TYPE_CHEST:
+            if (GetGOInfo()->chest.usegrouplootrules && (HasLootRecipient() || IsUpdateFieldPending(GAMEOBJECT_FLAGS, GameObjectUpdateFieldFlags)))
+                return false;
+            [[fallthrough]];
+        case GAMEOBJECT_TYPE_QUESTGIVER:
+        case GAMEOBJECT_TYPE_GOOBER:
+        case GAMEOBJECT_TYPE_GENERIC:
+            return !IsUpdateFieldPending(GAMEOBJECT_DYNAMIC, GameObjectUpdateFieldFlags);
+        default:
+            break;
+    }
+
+    return true;
+}
+
 std::vector<uint32> const* GameObject::GetPauseTimes() const
 {
     if (GameObjectType::Transport const* transport = dynamic_cast<GameObjectType::Transport const*>(m_goTypeImpl.get()))
@@ -121,6 +121,7 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
         ~GameObject();
 
         void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const override;
+        bool IsValuesUpdateSharedBetweenViewers() const override;
 
         void AddToWorld() override;
         void RemoveFromWorld() override;
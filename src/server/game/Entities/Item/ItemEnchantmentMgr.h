@@ -33,6 +33,8 @@ struct ItemRandomEnchantmentId
 
     ItemRandomEnchantmentType Type = ItemRandomEnchantmentType::Property;
     uint32 Id = 0;
+
+    bool operator==(ItemRandomEnchantmentId const& right) const = default;
 };
 
 TC_GAME_API void LoadRandomEnchantmentsTable();
@@ -99,6 +99,10 @@ WorldObject::~WorldObject()
         }
         ResetMap();
     }
+
+    // deleted while still linked to a grid cell
+    if (_spatialArray)
+        _spatialArray->Remove(this);
 }
 
 void WorldObject::Update(uint32 diff)
@@ -258,13 +262,17 @@ void Object::SendUpdateToSet()
 void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player* target) const
 {
     ByteBuffer buf(500);
+    BuildValuesUpdateBlock(buf, target);
 
-    buf << uint8(UPDATETYPE_VALUES);
-    buf << GetPackGUID();
+    data->AddUpdateBlock(buf);
+}
 
-    BuildValuesUpdate(UPDATETYPE_VALUES, &buf, target);
+void Object::BuildValuesUpdateBlock(ByteBuffer& data, Player* target) const
+{
+    data << uint8(UPDATETYPE_VALUES);
+    data << GetPackGUID();
 
-    data->AddUpdateBlock(buf);
+    BuildValuesUpdate(UPDATETYPE_VALUES, &data, target);
 }
 
 void Object::BuildOutOfRangeUpdateBlock(UpdateData* data) const
@@ -677,20 +685,53 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
     ASSERT(flags);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    std::array<UpdateMask::BlockType, UPDATE_MASK_MAX_BLOCKS> blocks;
+    uint32 blockCount = BuildValuesUpdateMask(updateType, flags, visibleFlag, m_valuesCount, blocks.data());
+    for (uint32 block = 0; block < blockCount; ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
-        {
-            updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
-        }
+        updateMask.SetBlock(block, blocks[block]);
+        for (UpdateMask::BlockType bits = blocks[block]; bits; bits &= bits - 1)
+            fieldBuffer << m_uint32Values[block * UpdateMask::BLOCK_BITS + UpdateMask::GetFirstSetBit(bits)];
     }
 
     updateMask.AppendToPacket(data);
     data->append(fieldBuffer);
 }
 
+uint32 Object::BuildValuesUpdateMask(uint8 updateType, uint32 const* flags, uint32 visibleFlag, uint32 valuesCount, UpdateMask::BlockType* blocks, uint32 forcedFlags /*= 0*/) const
+{
+    UpdateFieldFlagMasks const& flagMasks = UpdateFieldFlagMasks::Get(flags);
+    uint32 blockCount = UpdateMask::GetBlockCount(valuesCount);
+
+    std::array<UpdateMask::BlockType, UPDATE_MASK_MAX_BLOCKS> forced;
+    flagMasks.Select(visibleFlag, blocks, blockCount);
+    flagMasks.Select(_fieldNotifyFlags | forcedFlags, forced.data(), blockCount);
+
+    if (updateType == UPDATETYPE_VALUES)
+    {
+        for (uint32 block = 0; block < blockCount; ++block)
+            blocks[block] = (blocks[block] & _changesMask.GetBlock(block)) | forced[block];
+    }
+    else
+    {
+        // create blocks contain every field that is set
+        for (uint32 block = 0; block < blockCount; ++block)
+        {
+            UpdateMask::BlockType setFields = 0;
+            uint32 firstIndex = block * UpdateMask::BLOCK_BITS;
+            uint32 endIndex = std::min<uint32>(firstIndex + UpdateMask::BLOCK_BITS, valuesCount);
+            for (uint32 index = firstIndex; index < endIndex; ++index)
+                if (m_uint32Values[index])
+                    setFields |= UpdateMask::GetBlockFlag(index);
+
+            blocks[block] = (blocks[block] & setFields) | forced[block];
+        }
+    }
+
+    blocks[blockCount - 1] &= UpdateMask::GetLastBlockMask(valuesCount);
+    return blockCount;
+}
+
 void Object::AddToObjectUpdateIfNeeded()
 {
     if (m_inWorld && !m_objectUpdated)
@@ -710,7 +751,7 @@ void Object::ClearUpdateMask(bool remove)
     }
 }
 
-void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) const
+void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map, ValuesUpdateBlockCache* cache /*= nullptr*/) const
 {
     UpdateDataMapType::iterator iter = data_map.find(player);
 
@@ -721,7 +762,27 @@ void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) cons
         iter = p.first;
     }
 
-    BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+    if (!cache)
+    {
+        BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+        return;
+    }
+
+    // viewers sharing visibility flags (and gm state, used by some fields) receive identical blocks
+    uint32* flags = nullptr;
+    uint32 viewerClass = GetUpdateFieldData(player, flags);
+    if (player->IsGameMaster())
+        viewerClass |= UPDATE_VIEWER_CLASS_GAMEMASTER;
+
+    ByteBuffer const* block = cache->Find(viewerClass);
+    if (!block)
+    {
+        ByteBuffer& newBlock = cache->Add(viewerClass);
+        BuildValuesUpdateBlock(newBlock, player);
+        block = &newBlock;
+    }
+
+    iter->second.AddUpdateBlock(*block);
 }
 
 uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
@@ -1130,7 +1191,7 @@ WorldObject::WorldObject(bool isWorldObject) : Object(), WorldLocation(), LastUs
 m_movementInfo(), m_name(""), m_isActive(false), m_isFarVisible(false), m_isWorldObject(isWorldObject), m_zoneScript(nullptr),
 m_transport(nullptr), m_zoneId(0), m_areaId(0), m_staticFloorZ(VMAP_INVALID_HEIGHT), m_outdoors(true), m_liquidStatus(LIQUID_MAP_NO_WATER),
 m_wmoGroupID(0), m_currMap(nullptr), m_InstanceId(0), _dbPhase(0), m_notifyflags(0), _heartbeatTimer(HEARTBEAT_INTERVAL),
-m_aiAnimKitId(0), m_movementAnimKitId(0), m_meleeAnimKitId(0)
+_spatialArray(nullptr), _spatialIndex(0), m_aiAnimKitId(0), m_movementAnimKitId(0), m_meleeAnimKitId(0)
 {
     m_serverSideVisibility.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE | GHOST_VISIBILITY_GHOST);
     m_serverSideVisibilityDetect.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE);
@@ -1368,6 +1429,22 @@ bool WorldObject::IsWithinDistInMap(WorldObject const* obj, float dist2compare,
 {
     return obj && IsInMap(obj) && IsInPhase(obj) && _IsWithinDist(obj, dist2compare, is3D, incOwnRadius, incTargetRadius);
 }
+
+bool WorldObject::GetGridSearchArea(GridSpatialSearchArea& area, float dist2compare, bool is3D /*= true*/, bool incOwnRadius /*= true*/, bool incTargetRadius /*= true*/) const
+{
+    // _IsWithinDist compares transport offsets or gameobject model bounds instead
+    if (GetTransport() || GetTypeId() == TYPEID_GAMEOBJECT)
+        return false;
+
+    area.X = GetPositionX();
+    area.Y = GetPositionY();
+    area.Z = GetPositionZ();
+    area.Range = dist2compare;
+    area.OwnReach = incOwnRadius ? GetCombatReach() : 0.0f;
+    area.Is3D = is3D;
+    area.IncludeTargetReach = incTargetRadius;
+    return true;
+}
 Position WorldObject::GetHitSpherePointFor(Position const& dest) const
 {
     G3D::Vector3 vThis(GetPositionX(), GetPositionY(), GetPositionZ() + GetCollisionHeight());
@@ -3608,8 +3685,9 @@ struct WorldObjectChangeAccumulator
 {
     UpdateDataMapType& i_updateDatas;
     WorldObject& i_object;
+    ValuesUpdateBlockCache* i_cache;
     GuidSet plr_list;
-    WorldObjectChangeAccumulator(WorldObject &obj, UpdateDataMapType &d) : i_updateDatas(d), i_object(obj) { }
+    WorldObjectChangeAccumulator(WorldObject &obj, UpdateDataMapType &d, ValuesUpdateBlockCache* cache) : i_updateDatas(d), i_object(obj), i_cache(cache) { }
     void Visit(PlayerMapType &m)
     {
         Player* source = nullptr;
@@ -3666,7 +3744,7 @@ struct WorldObjectChangeAccumulator
         // Only send update once to a player
         if (plr_list.find(player->GetGUID()) == plr_list.end() && player->HaveAtClient(&i_object))
         {
-            i_object.BuildFieldsUpdate(player, i_updateDatas);
+            i_object.BuildFieldsUpdate(player, i_updateDatas, i_cache);
             plr_list.insert(player->GetGUID());
         }
     }
@@ -3676,7 +3754,8 @@ struct WorldObjectChangeAccumulator
 
 void WorldObject::BuildUpdate(UpdateDataMapType& data_map)
 {
-    WorldObjectChangeAccumulator notifier(*this, data_map);
+    ValuesUpdateBlockCache cache;
+    WorldObjectChangeAccumulator notifier(*this, data_map, IsValuesUpdateSharedBetweenViewers() ? &cache : nullptr);
     //we must build packets for all visible players
     Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
 
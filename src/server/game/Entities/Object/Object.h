@@ -23,6 +23,7 @@
 #include "EventProcessor.h"
 #include "GridReference.h"
 #include "GridRefManager.h"
+#include "GridSpatialArray.h"
 #include "ModelIgnoreFlags.h"
 #include "MovementInfo.h"
 #include "ObjectDefines.h"
@@ -53,6 +54,7 @@ class TempSummon;
 class TransportBase;
 class Unit;
 class UpdateData;
+class ValuesUpdateBlockCache;
 class WorldObject;
 class WorldPacket;
 class ZoneScript;
@@ -178,7 +180,7 @@ class TC_GAME_API Object
         bool IsDestroyedObject() const { return m_isDestroyedObject; }
         void SetDestroyedObject(bool destroyed) { m_isDestroyedObject = destroyed; }
         virtual void BuildUpdate(UpdateDataMapType&) { }
-        void BuildFieldsUpdate(Player*, UpdateDataMapType &) const;
+        void BuildFieldsUpdate(Player*, UpdateDataMapType &, ValuesUpdateBlockCache* cache = nullptr) const;
 
         void SetFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags |= flag; }
         void RemoveFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags &= uint16(~flag); }
@@ -226,6 +228,17 @@ class TC_GAME_API Object
 
         void BuildMovementUpdate(ByteBuffer* data, CreateObjectBits flags) const;
         virtual void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const;
+        void BuildValuesUpdateBlock(ByteBuffer& data, Player* target) const;
+
+        // writes the fields BuildValuesUpdate has to send to a viewer with visibleFlag into blocks (UPDATE_MASK_MAX_BLOCKS large):
+        // visible fields that changed (or are set, for create blocks) and all fields flagged with field notify or forcedFlags
+        // returns number of blocks written
+        uint32 BuildValuesUpdateMask(uint8 updateType, uint32 const* flags, uint32 visibleFlag, uint32 valuesCount, UpdateMask::BlockType* blocks, uint32 forcedFlags = 0) const;
+
+        // true if BuildValuesUpdate output for the pending changes only depends on the viewer class
+        // computed by BuildFieldsUpdate, allowing the block to be built once and copied to every viewer
+        virtual bool IsValuesUpdateSharedBetweenViewers() const { return true; }
+        bool IsUpdateFieldPending(uint16 index, uint32 const* flags) const { return (_fieldNotifyFlags & flags[index]) || _changesMask.GetBit(index); }
 
         uint16 m_objectType;
 
@@ -271,8 +284,8 @@ class GridObject
         virtual ~GridObject() { }
 
         bool IsInGrid() const { return _gridRef.isValid(); }
-        void AddToGrid(GridRefManager<T>& m) { ASSERT(!IsInGrid()); _gridRef.link(&m, (T*)this); }
-        void RemoveFromGrid() { ASSERT(IsInGrid()); _gridRef.unlink(); }
+        void AddToGrid(GridRefManager<T>& m) { ASSERT(!IsInGrid()); _gridRef.link(&m, (T*)this); m.GetSpatialArray().Add((T*)this); }
+        void RemoveFromGrid() { ASSERT(IsInGrid()); _gridRef.getTarget()->GetSpatialArray().Remove((T*)this); _gridRef.unlink(); }
     private:
         GridReference<T> _gridRef;
 };
@@ -331,6 +344,13 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
         Position GetRandomNearPosition(float radius);
         void GetContactPoint(WorldObject const* obj, float &x, float &y, float &z, float distance2d = CONTACT_DISTANCE) const;
 
+        // hide Position::Relocate to keep the position array of the grid cell in sync
+        void Relocate(float x, float y) { Position::Relocate(x, y); UpdateSpatialPosition(); }
+        void Relocate(float x, float y, float z) { Position::Relocate(x, y, z); UpdateSpatialPosition(); }
+        void Relocate(float x, float y, float z, float orientation) { Position::Relocate(x, y, z, orientation); UpdateSpatialPosition(); }
+        void Relocate(Position const& pos) { Position::Relocate(pos); UpdateSpatialPosition(); }
+        void Relocate(Position const* pos) { Position::Relocate(pos); UpdateSpatialPosition(); }
+
         virtual float GetCombatReach() const { return 0.0f; } // overridden (only) in Unit
         void UpdateGroundPositionZ(float x, float y, float &z) const;
         void UpdateAllowedPositionZ(float x, float y, float &z, float* groundZ = nullptr) const;
@@ -382,6 +402,8 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
         // use only if you will sure about placing both object at same map
         bool IsWithinDist(WorldObject const* obj, float dist2compare, bool is3D = true) const;
         bool IsWithinDistInMap(WorldObject const* obj, float dist2compare, bool is3D = true, bool incOwnRadius = true, bool incTargetRadius = true) const;
+        // area matching IsWithinDistInMap for a grid position array prefilter, false if positions can't be compared directly (transports, gameobject model size)
+        bool GetGridSearchArea(GridSpatialSearchArea& area, float dist2compare, bool is3D = true, bool incOwnRadius = true, bool incTargetRadius = true) const;
         bool IsWithinLOS(float x, float y, float z, LineOfSightChecks checks = LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags ignoreFlags = VMAP::ModelIgnoreFlags::Nothing) const;
         bool IsWithinLOSInMap(WorldObject const* obj, LineOfSightChecks checks = LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags ignoreFlags = VMAP::ModelIgnoreFlags::Nothing) const;
         Position GetHitSpherePointFor(Position const& dest) const;
@@ -611,7 +633,13 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
         virtual bool IsAlwaysDetectableFor(WorldObject const* /*seer*/) const { return false; }
 
         virtual void Heartbeat() { }
+
+        void UpdateSpatialCombatReach(float combatReach) { if (_spatialArray) _spatialArray->SetCombatReach(_spatialIndex, combatReach); }
     private:
+        friend class GridSpatialArray;
+
+        void UpdateSpatialPosition() { if (_spatialArray) _spatialArray->SetPosition(_spatialIndex, GetPositionX(), GetPositionY(), GetPositionZ()); }
+
         Map* m_currMap;                                   // current object's Map location
 
         uint32 m_InstanceId;                              // in map copy with instance id
@@ -625,6 +653,9 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
 
         Milliseconds _heartbeatTimer;
 
+        GridSpatialArray* _spatialArray;                  // position array of the grid cell container the object is linked to
+        uint32 _spatialIndex;
+
         virtual bool _IsWithinDist(WorldObject const* obj, float dist2compare, bool is3D, bool incOwnRadius = true, bool incTargetRadius = true) const;
 
         bool CanNeverSee(WorldObject const* obj) const;
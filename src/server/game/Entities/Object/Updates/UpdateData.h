@@ -22,6 +22,7 @@
 #include "ByteBuffer.h"
 #include "ObjectGuid.h"
 #include <set>
+#include <vector>
 
 class WorldPacket;
 
@@ -61,4 +62,31 @@ class UpdateData
         UpdateData(UpdateData const& right) = delete;
         UpdateData& operator=(UpdateData const& right) = delete;
 };
+
+// viewer class bit set for game masters, above every UpdatefieldFlags value
+#define UPDATE_VIEWER_CLASS_GAMEMASTER 0x80000000
+
+// Values blocks of one object built during a single BuildUpdate call, one per viewer class
+// (visibility flags of the update fields plus anything else the serialized values depend on)
+class ValuesUpdateBlockCache
+{
+    public:
+        ByteBuffer const* Find(uint32 viewerClass) const
+        {
+            for (std::pair<uint32, ByteBuffer> const& block : _blocks)
+                if (block.first == viewerClass)
+                    return &block.second;
+
+            return nullptr;
+        }
+
+        ByteBuffer& Add(uint32 viewerClass)
+        {
+            _blocks.emplace_back(viewerClass, ByteBuffer(500));
+            return _blocks.back().second;
+        }
+
+    private:
+        std::vector<std::pair<uint32, ByteBuffer>> _blocks;
+};
 #endif
@@ -0,0 +1,43 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UpdateMask.h"
+#include "UpdateFieldFlags.h"
+
+UpdateFieldFlagMasks const& UpdateFieldFlagMasks::Get(uint32 const* flags)
+{
+    static UpdateFieldFlagMasks const itemMasks(ItemUpdateFieldFlags, CONTAINER_END);
+    static UpdateFieldFlagMasks const unitMasks(UnitUpdateFieldFlags, PLAYER_END);
+    static UpdateFieldFlagMasks const gameObjectMasks(GameObjectUpdateFieldFlags, GAMEOBJECT_END);
+    static UpdateFieldFlagMasks const dynamicObjectMasks(DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END);
+    static UpdateFieldFlagMasks const corpseMasks(CorpseUpdateFieldFlags, CORPSE_END);
+    static UpdateFieldFlagMasks const areaTriggerMasks(AreaTriggerUpdateFieldFlags, AREATRIGGER_END);
+
+    if (flags == ItemUpdateFieldFlags)
+        return itemMasks;
+    if (flags == UnitUpdateFieldFlags)
+        return unitMasks;
+    if (flags == GameObjectUpdateFieldFlags)
+        return gameObjectMasks;
+    if (flags == DynamicObjectUpdateFieldFlags)
+        return dynamicObjectMasks;
+    if (flags == CorpseUpdateFieldFlags)
+        return corpseMasks;
+
+    ASSERT(flags == AreaTriggerUpdateFieldFlags, "Unknown update field flags table");
+    return areaTriggerMasks;
+}
@@ -21,43 +21,137 @@
 #include "UpdateFields.h"
 #include "Errors.h"
 #include "ByteBuffer.h"
+#include <bit>
+#include <memory>
+#include <vector>
 
 class UpdateMask
 {
 public:
-    UpdateMask() : _bits(nullptr), _fieldCount(0) { }
+    /// Type of a block of packed field bits, bit N of block B is field B * BLOCK_BITS + N
+    using BlockType = uint64;
+
+    enum BlockCount
+    {
+        BLOCK_BITS = sizeof(BlockType) * 8,
+    };
+
+    UpdateMask() : _blocks(nullptr), _blockCount(0) { }
 
     void SetBit(uint32 index)
     {
-        _bits[index] = 1;
+        _blocks[GetBlockIndex(index)] |= GetBlockFlag(index);
     }
 
     void UnsetBit(uint32 index)
     {
-        _bits[index] = 0;
+        _blocks[GetBlockIndex(index)] &= ~GetBlockFlag(index);
     }
 
     bool GetBit(uint32 index) const
     {
-        return _bits[index] != 0;
+        return (_blocks[GetBlockIndex(index)] & GetBlockFlag(index)) != 0;
     }
 
+    BlockType GetBlock(uint32 blockIndex) const
+    {
+        return _blocks[blockIndex];
+    }
+
+    uint32 GetBlockCount() const { return _blockCount; }
+
     void SetCount(uint32 valuesCount)
     {
-        _bits = std::make_unique<uint8[]>(valuesCount);
-        std::uninitialized_fill_n(&_bits[0], valuesCount, 0);
-        _fieldCount = valuesCount;
+        _blockCount = GetBlockCount(valuesCount);
+        _blocks = std::make_unique<BlockType[]>(_blockCount);
+        std::uninitialized_fill_n(&_blocks[0], _blockCount, 0);
     }
 
     void Clear()
     {
-        if (_bits)
-            std::fill_n(&_bits[0], _fieldCount, 0);
+        if (_blocks)
+            std::fill_n(&_blocks[0], _blockCount, 0);
+    }
+
+    static constexpr uint32 GetBlockCount(uint32 fieldCount)
+    {
+        return (fieldCount + BLOCK_BITS - 1) / BLOCK_BITS;
+    }
+
+    static constexpr uint32 GetBlockIndex(uint32 index)
+    {
+        return index / BLOCK_BITS;
+    }
+
+    static constexpr BlockType GetBlockFlag(uint32 index)
+    {
+        return BlockType(1) << (index % BLOCK_BITS);
+    }
+
+    /// Bits of the last block that belong to fields below fieldCount
+    static constexpr BlockType GetLastBlockMask(uint32 fieldCount)
+    {
+        return fieldCount % BLOCK_BITS ? GetBlockFlag(fieldCount) - 1 : ~BlockType(0);
+    }
+
+    /// Index of the lowest set bit of a non zero block
+    static uint32 GetFirstSetBit(BlockType block)
+    {
+        return std::countr_zero(block);
+    }
+
+private:
+    std::unique_ptr<BlockType[]> _blocks;
+    uint32 _blockCount;
+};
+
+// enough blocks for the largest update field table
+#define UPDATE_MASK_MAX_BLOCKS UpdateMask::GetBlockCount(PLAYER_END)
+
+/// Fields of an update field flags table (see UpdateFieldFlags.h) packed separately for every flag,
+/// allows selecting fields visible to a viewer one block at a time instead of testing each field's flags
+class TC_GAME_API UpdateFieldFlagMasks
+{
+public:
+    enum FlagCount
+    {
+        FLAG_BITS = 9   // UF_FLAG_PUBLIC .. UF_FLAG_DYNAMIC
+    };
+
+    UpdateFieldFlagMasks(uint32 const* flags, uint32 fieldCount) : _blockCount(UpdateMask::GetBlockCount(fieldCount)),
+        _masks(std::size_t(_blockCount) * FLAG_BITS, 0)
+    {
+        for (uint32 index = 0; index < fieldCount; ++index)
+            for (uint32 flag = 0; flag < FLAG_BITS; ++flag)
+                if (flags[index] & (1u << flag))
+                    _masks[flag * _blockCount + UpdateMask::GetBlockIndex(index)] |= UpdateMask::GetBlockFlag(index);
+    }
+
+    /// Writes blockCount blocks with bits set for fields having any of fieldFlags
+    void Select(uint32 fieldFlags, UpdateMask::BlockType* blocks, uint32 blockCount) const
+    {
+        ASSERT(blockCount <= _blockCount);
+
+        std::fill_n(blocks, blockCount, 0);
+        for (; fieldFlags; fieldFlags &= fieldFlags - 1)
+        {
+            uint32 flag = UpdateMask::GetFirstSetBit(fieldFlags);
+            if (flag >= FLAG_BITS)
+                break;
+
+            // plain loop over contiguous blocks, vectorized by the compiler
+            UpdateMask::BlockType const* mask = &_masks[flag * _blockCount];
+            for (uint32 block = 0; block < blockCount; ++block)
+                blocks[block] |= mask[block];
+        }
     }
 
+    /// Masks of one of the tables declared in UpdateFieldFlags.h
+    static UpdateFieldFlagMasks const& Get(uint32 const* flags);
+
 private:
-    std::unique_ptr<uint8[]> _bits;
-    uint32 _fieldCount;
+    uint32 _blockCount;
+    std::vector<UpdateMask::BlockType> _masks;  // FLAG_BITS rows of _blockCount blocks
 };
 
 class UpdateMaskPacketBuilder
@@ -69,11 +163,13 @@ public:
     enum UpdateMaskCount
     {
         CLIENT_UPDATE_MASK_BITS = sizeof(ClientUpdateMaskType) * 8,
+        CLIENT_BLOCKS_PER_MASK_BLOCK = UpdateMask::BLOCK_BITS / CLIENT_UPDATE_MASK_BITS
     };
 
     explicit UpdateMaskPacketBuilder(uint32 valuesCount) : _lastSetBit(0)
     {
-        std::size_t blockCount = CalculateBlockCount(valuesCount);
+        // room for whole UpdateMask blocks so SetBlock never writes past the end
+        std::size_t blockCount = UpdateMask::GetBlockCount(valuesCount) * CLIENT_BLOCKS_PER_MASK_BLOCK;
         _mask = std::make_unique<ClientUpdateMaskType[]>(blockCount);
         std::uninitialized_fill_n(&_mask[0], blockCount, 0);
     }
@@ -84,6 +180,18 @@ public:
         _lastSetBit = bit;
     }
 
+    /// Sets all bits of an UpdateMask block, blocks must be set in ascending order
+    void SetBlock(uint32 blockIndex, UpdateMask::BlockType block)
+    {
+        if (!block)
+            return;
+
+        for (uint32 i = 0; i < CLIENT_BLOCKS_PER_MASK_BLOCK; ++i)
+            _mask[blockIndex * CLIENT_BLOCKS_PER_MASK_BLOCK + i] = ClientUpdateMaskType(block >> (i * CLIENT_UPDATE_MASK_BITS));
+
+        _lastSetBit = blockIndex * UpdateMask::BLOCK_BITS + UpdateMask::BLOCK_BITS - 1 - std::countl_zero(block);
+    }
+
     void AppendToPacket(ByteBuffer* data)
     {
         uint8 blockCount = CalculateBlockCount(_lastSetBit + 1);
@@ -112,6 +112,8 @@ struct CUFProfile
 
     std::bitset<CUF_BOOL_OPTIONS_COUNT> BoolOptions;
 
+    bool operator==(CUFProfile const& right) const = default;
+
     // More fields can be added to BoolOptions without changing DB schema (up to 32, currently 27)
 };
 
@@ -1765,7 +1765,7 @@ void Player::SetObjectScale(float scale)
 {
     Unit::SetObjectScale(scale);
     SetFloatValue(UNIT_FIELD_BOUNDINGRADIUS, scale * DEFAULT_PLAYER_BOUNDING_RADIUS);
-    SetFloatValue(UNIT_FIELD_COMBATREACH, scale * DEFAULT_PLAYER_COMBAT_REACH);
+    SetCombatReach(scale * DEFAULT_PLAYER_COMBAT_REACH);
     if (IsInWorld())
         SendMovementSetCollisionHeight(GetCollisionHeight(), UPDATE_COLLISION_HEIGHT_SCALE);
 }
@@ -3931,11 +3931,11 @@ void Player::DeleteFromDB(ObjectGuid playerguid, uint32 accountId, bool updateRe
                 playerguid.ToString().c_str(), charDelete_method);
 
             if (trans->GetSize() > 0)
-                CharacterDatabase.CommitTransaction(trans);
+                CharacterDatabase.CommitTransaction(trans, DB_QUEUE_PRIORITY_NORMAL, accountId);
             return;
     }
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, DB_QUEUE_PRIORITY_NORMAL, accountId);
 
     if (updateRealmChars)
         sWorld->UpdateRealmCharCount(accountId);
@@ -5875,6 +5875,11 @@ void Player::SendDirectMessage(WorldPacket const* data) const
     m_session->SendPacket(data);
 }
 
+void Player::SendDirectMessage(std::shared_ptr<WorldPacket const> const& data) const
+{
+    m_session->SendPacket(data);
+}
+
 void Player::SendCinematicStart(uint32 cinematicId)
 {
     WorldPackets::Misc::TriggerCinematic packet;
@@ -18787,7 +18792,24 @@ void Player::SaveToDB(bool create /*=false*/)
 
     SaveToDB(trans, create);
 
-    CharacterDatabase.CommitTransaction(trans);
+    // keyed by account so the character list sent after logout sees this save
+    GetSession()->AddTransactionCallback(CharacterDatabase.AsyncCommitTransaction(trans, DB_QUEUE_PRIORITY_NORMAL, GetSession()->GetAccountId())).AfterComplete([session = GetSession(), guid = GetGUID()](bool success)
+    {
+        // the database no longer holds the rows the differential save compares against
+        if (!success)
+            if (Player* player = session->GetPlayer())
+                if (player->GetGUID() == guid)
+                    player->ResetSavedRows();
+    });
+}
+
+void Player::ResetSavedRows()
+{
+    _savedAuras.Reset();
+    _savedGlyphs.Reset();
+    _savedVoidStorage.Reset();
+    _savedCUFProfiles.Reset();
+    _savedBGData.Reset();
 }
 
 void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create /* = false */)
@@ -19196,12 +19218,89 @@ void Player::_SaveActions(CharacterDatabaseTransaction& trans)
     }
 }
 
-void Player::_SaveAuras(CharacterDatabaseTransaction& trans)
+namespace
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
-    stmt->setUInt32(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+/// Compares the statements makeRow creates for two sets of rows, so a column missed by the row comparison shows up as well
+template<class Key, class Row, class MakeRow>
+bool IsSameRowStatements(std::map<Key, Row> const& left, std::map<Key, Row> const& right, MakeRow&& makeRow)
+{
+    if (left.size() != right.size())
+        return false;
+
+    for (auto leftItr = left.begin(), rightItr = right.begin(); leftItr != left.end(); ++leftItr, ++rightItr)
+    {
+        if (leftItr->first < rightItr->first || rightItr->first < leftItr->first)
+            return false;
+
+        std::unique_ptr<CharacterDatabasePreparedStatement> leftStmt(makeRow(leftItr->first, leftItr->second));
+        std::unique_ptr<CharacterDatabasePreparedStatement> rightStmt(makeRow(rightItr->first, rightItr->second));
+        if (!leftStmt->IsSameStatement(*rightStmt))
+            return false;
+    }
 
+    return true;
+}
+
+/// Returns the rows of a table that changed since the previous save of the player
+/// Nothing is returned if the whole table has to be written: on the first save, with PlayerSave.Differential disabled or while verifying it
+/// While verifying, the rows the differential saves would have left in the database are compared with the rows of the full save
+template<class Key, class Row, class MakeRow>
+Optional<typename Trinity::ChangeTracker<Key, Row>::Changes> GetChangedRows(Player const* player, char const* table,
+    Trinity::ChangeTracker<Key, Row>& tracker, std::map<Key, Row> rows, MakeRow&& makeRow)
+{
+    using Tracker = Trinity::ChangeTracker<Key, Row>;
+
+    bool const differential = tracker.IsTracking() && sWorld->getBoolConfig(CONFIG_PLAYER_SAVE_DIFFERENTIAL);
+    bool const verify = differential && sWorld->getBoolConfig(CONFIG_PLAYER_SAVE_DIFFERENTIAL_VERIFY);
+
+    typename Tracker::Changes changes = tracker.Save(std::move(rows), verify);
+    if (!differential)
+        return {};
+
+    if (verify)
+    {
+        if (!IsSameRowStatements(tracker.GetWritten(), tracker.GetSaved(), makeRow))
+        {
+            TC_LOG_ERROR("entities.player", "Player::SaveToDB: Differential save of %s for player %s does not match the full save.",
+                table, player->GetGUID().ToString().c_str());
+            // start over from the full save so a single mismatch is not reported on every save
+            typename Tracker::RowMap saved = tracker.GetSaved();
+            tracker.Reset();
+            tracker.Save(std::move(saved), true);
+        }
+
+        TC_LOG_DEBUG("entities.player", "Player::SaveToDB: Differential save of %s for player %s would write " SZFMTD " of " SZFMTD " rows.",
+            table, player->GetGUID().ToString().c_str(), changes.GetCount(), tracker.GetSaved().size());
+        return {};
+    }
+
+    return changes;
+}
+
+/// Deletes rows that were removed, then writes the new ones so statements for the same table stay together
+/// Tables written with REPLACE do not need updated rows to be deleted first
+template<class Key, class Row, class DeleteRow, class MakeRow>
+void WriteChangedRows(CharacterDatabaseTransaction& trans, typename Trinity::ChangeTracker<Key, Row>::Changes const& changes,
+    std::map<Key, Row> const& rows, bool deleteUpdated, DeleteRow&& deleteRow, MakeRow&& makeRow)
+{
+    for (Key const& key : changes.Deleted)
+        deleteRow(key);
+
+    if (deleteUpdated)
+        for (Key const& key : changes.Updated)
+            deleteRow(key);
+
+    for (Key const& key : changes.Updated)
+        trans->Append(makeRow(key, rows.at(key)));
+
+    for (Key const& key : changes.Inserted)
+        trans->Append(makeRow(key, rows.at(key)));
+}
+}
+
+void Player::_SaveAuras(CharacterDatabaseTransaction& trans)
+{
+    std::map<AuraSaveKey, AuraSaveData> rows;
     for (AuraMap::const_iterator itr = m_ownedAuras.begin(); itr != m_ownedAuras.end(); ++itr)
     {
         if (!itr->second->CanBeSaved())
@@ -19209,49 +19308,83 @@ void Player::_SaveAuras(CharacterDatabaseTransaction& trans)
 
         Aura* aura = itr->second;
 
-        int32 damage[MAX_SPELL_EFFECTS];
-        int32 baseDamage[MAX_SPELL_EFFECTS];
+        AuraSaveData data;
         uint8 effMask = 0;
-        uint8 recalculateMask = 0;
+        data.RecalculateMask = 0;
         for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
         {
             if (AuraEffect const* effect = aura->GetEffect(i))
             {
-                baseDamage[i] = effect->GetBaseAmount();
-                damage[i] = effect->GetAmount();
+                data.BaseAmount[i] = effect->GetBaseAmount();
+                data.Amount[i] = effect->GetAmount();
                 effMask |= 1 << i;
                 if (effect->CanBeRecalculated())
-                    recalculateMask |= 1 << i;
+                    data.RecalculateMask |= 1 << i;
             }
             else
             {
-                baseDamage[i] = 0;
-                damage[i] = 0;
+                data.BaseAmount[i] = 0;
+                data.Amount[i] = 0;
             }
         }
 
+        data.StackCount = aura->GetStackAmount();
+        data.MaxDuration = aura->GetMaxDuration();
+        data.Duration = aura->GetDuration();
+        data.Charges = aura->GetCharges();
+        data.CritChance = aura->GetCritChance();
+        data.ApplyResilience = aura->CanApplyResilience();
+        rows.emplace(AuraSaveKey(aura->GetCasterGUID().GetRawValue(), aura->GetCastItemGUID().GetRawValue(), aura->GetId(), effMask), data);
+    }
+
+    auto deleteAura = [&](AuraSaveKey const& key)
+    {
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA_BY_KEY);
+        stmt->setUInt32(0, GetGUID().GetCounter());
+        stmt->setUInt64(1, std::get<0>(key));
+        stmt->setUInt64(2, std::get<1>(key));
+        stmt->setUInt32(3, std::get<2>(key));
+        stmt->setUInt8(4, std::get<3>(key));
+        trans->Append(stmt);
+    };
+
+    auto makeAura = [&](AuraSaveKey const& key, AuraSaveData const& data)
+    {
         uint8 index = 0;
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_AURA);
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_AURA);
         stmt->setUInt32(index++, GetGUID().GetCounter());
-        stmt->setUInt64(index++, itr->second->GetCasterGUID().GetRawValue());
-        stmt->setUInt64(index++, itr->second->GetCastItemGUID().GetRawValue());
-        stmt->setUInt32(index++, itr->second->GetId());
-        stmt->setUInt8(index++, effMask);
-        stmt->setUInt8(index++, recalculateMask);
-        stmt->setUInt8(index++, itr->second->GetStackAmount());
-        stmt->setInt32(index++, damage[0]);
-        stmt->setInt32(index++, damage[1]);
-        stmt->setInt32(index++, damage[2]);
-        stmt->setInt32(index++, baseDamage[0]);
-        stmt->setInt32(index++, baseDamage[1]);
-        stmt->setInt32(index++, baseDamage[2]);
-        stmt->setInt32(index++, itr->second->GetMaxDuration());
-        stmt->setInt32(index++, itr->second->GetDuration());
-        stmt->setUInt8(index++, itr->second->GetCharges());
-        stmt->setFloat(index++, itr->second->GetCritChance());
-        stmt->setBool(index++, itr->second->CanApplyResilience());
-        trans->Append(stmt);
+        stmt->setUInt64(index++, std::get<0>(key));
+        stmt->setUInt64(index++, std::get<1>(key));
+        stmt->setUInt32(index++, std::get<2>(key));
+        stmt->setUInt8(index++, std::get<3>(key));
+        stmt->setUInt8(index++, data.RecalculateMask);
+        stmt->setUInt8(index++, data.StackCount);
+        stmt->setInt32(index++, data.Amount[0]);
+        stmt->setInt32(index++, data.Amount[1]);
+        stmt->setInt32(index++, data.Amount[2]);
+        stmt->setInt32(index++, data.BaseAmount[0]);
+        stmt->setInt32(index++, data.BaseAmount[1]);
+        stmt->setInt32(index++, data.BaseAmount[2]);
+        stmt->setInt32(index++, data.MaxDuration);
+        stmt->setInt32(index++, data.Duration);
+        stmt->setUInt8(index++, data.Charges);
+        stmt->setFloat(index++, data.CritChance);
+        stmt->setBool(index++, data.ApplyResilience);
+        return stmt;
+    };
+
+    if (auto changes = GetChangedRows(this, "auras", _savedAuras, std::move(rows), makeAura))
+    {
+        WriteChangedRows(trans, *changes, _savedAuras.GetSaved(), false, deleteAura, makeAura);
+        return;
     }
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
+    stmt->setUInt32(0, GetGUID().GetCounter());
+    trans->Append(stmt);
+
+    for (auto const& [key, data] : _savedAuras.GetSaved())
+        trans->Append(makeAura(key, data));
 }
 
 void Player::_SaveInventory(CharacterDatabaseTransaction& trans)
@@ -19398,71 +19531,103 @@ void Player::_SaveInventory(CharacterDatabaseTransaction& trans)
 
 void Player::_SaveVoidStorage(CharacterDatabaseTransaction& trans)
 {
-    CharacterDatabasePreparedStatement* stmt = nullptr;
     uint32 lowGuid = GetGUID().GetCounter();
 
-    for (size_t i = 0; i < _voidStorageItems.size(); ++i)
+    std::map<uint8, VoidStorageItem> rows;
+    for (uint8 i = 0; i < _voidStorageItems.size(); ++i)
+        if (_voidStorageItems[i])
+            rows.emplace(i, *_voidStorageItems[i]);
+
+    auto deleteItem = [&](uint8 slot)
+    {
+        // DELETE FROM void_storage WHERE slot = ? AND playerGuid = ?
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_VOID_STORAGE_ITEM_BY_SLOT);
+        stmt->setUInt8(0, slot);
+        stmt->setUInt32(1, lowGuid);
+        trans->Append(stmt);
+    };
+
+    auto makeItem = [&](uint8 slot, VoidStorageItem const& item)
+    {
+        // REPLACE INTO character_inventory (itemId, playerGuid, itemEntry, slot, creatorGuid) VALUES (?, ?, ?, ?, ?)
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CHAR_VOID_STORAGE_ITEM);
+        stmt->setUInt64(0, item.ItemId);
+        stmt->setUInt32(1, lowGuid);
+        stmt->setUInt32(2, item.ItemEntry);
+        stmt->setUInt8(3, slot);
+        stmt->setUInt32(4, item.CreatorGuid.GetCounter());
+        stmt->setUInt8(5, uint8(item.ItemRandomPropertyId.Type));
+        stmt->setUInt32(6, item.ItemRandomPropertyId.Id);
+        stmt->setUInt32(7, item.ItemSuffixFactor);
+        return stmt;
+    };
+
+    if (auto changes = GetChangedRows(this, "void storage", _savedVoidStorage, std::move(rows), makeItem))
+    {
+        WriteChangedRows(trans, *changes, _savedVoidStorage.GetSaved(), false, deleteItem, makeItem);
+        return;
+    }
+
+    for (uint8 i = 0; i < _voidStorageItems.size(); ++i)
     {
         if (!_voidStorageItems[i]) // unused item
-        {
-            // DELETE FROM void_storage WHERE slot = ? AND playerGuid = ?
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_VOID_STORAGE_ITEM_BY_SLOT);
-            stmt->setUInt8(0, i);
-            stmt->setUInt32(1, lowGuid);
-        }
+            deleteItem(i);
         else
-        {
-            // REPLACE INTO character_inventory (itemId, playerGuid, itemEntry, slot, creatorGuid) VALUES (?, ?, ?, ?, ?)
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CHAR_VOID_STORAGE_ITEM);
-            stmt->setUInt64(0, _voidStorageItems[i]->ItemId);
-            stmt->setUInt32(1, lowGuid);
-            stmt->setUInt32(2, _voidStorageItems[i]->ItemEntry);
-            stmt->setUInt8(3, i);
-            stmt->setUInt32(4, _voidStorageItems[i]->CreatorGuid.GetCounter());
-            stmt->setUInt8(5, uint8(_voidStorageItems[i]->ItemRandomPropertyId.Type));
-            stmt->setUInt32(6, _voidStorageItems[i]->ItemRandomPropertyId.Id);
-            stmt->setUInt32(7, _voidStorageItems[i]->ItemSuffixFactor);
-        }
-
-        trans->Append(stmt);
+            trans->Append(makeItem(i, *_voidStorageItems[i]));
     }
 }
 
 void Player::_SaveCUFProfiles(CharacterDatabaseTransaction& trans)
 {
-    CharacterDatabasePreparedStatement* stmt = nullptr;
     uint32 lowGuid = GetGUID().GetCounter();
 
+    std::map<uint8, CUFProfile> rows;
+    for (uint8 i = 0; i < MAX_CUF_PROFILES; ++i)
+        if (_CUFProfiles[i])
+            rows.emplace(i, *_CUFProfiles[i]);
+
+    auto deleteProfile = [&](uint8 id)
+    {
+        // DELETE FROM character_cuf_profiles WHERE guid = ? and id = ?
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_CUF_PROFILES);
+        stmt->setUInt32(0, lowGuid);
+        stmt->setUInt8(1, id);
+        trans->Append(stmt);
+    };
+
+    auto makeProfile = [&](uint8 id, CUFProfile const& profile)
+    {
+        // REPLACE INTO character_cuf_profiles (guid, id, name, frameHeight, frameWidth, sortBy, healthText, boolOptions, unk146, unk147, unk148, unk150, unk152, unk154) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CHAR_CUF_PROFILES);
+        stmt->setUInt32(0, lowGuid);
+        stmt->setUInt8(1, id);
+        stmt->setString(2, profile.ProfileName);
+        stmt->setUInt16(3, profile.FrameHeight);
+        stmt->setUInt16(4, profile.FrameWidth);
+        stmt->setUInt8(5, profile.SortBy);
+        stmt->setUInt8(6, profile.HealthText);
+        stmt->setUInt32(7, profile.BoolOptions.to_ulong()); // 27 of 32 fields used, fits in an int
+        stmt->setUInt8(8, profile.TopPoint);
+        stmt->setUInt8(9, profile.BottomPoint);
+        stmt->setUInt8(10, profile.LeftPoint);
+        stmt->setUInt16(11, profile.TopOffset);
+        stmt->setUInt16(12, profile.BottomOffset);
+        stmt->setUInt16(13, profile.LeftOffset);
+        return stmt;
+    };
+
+    if (auto changes = GetChangedRows(this, "CUF profiles", _savedCUFProfiles, std::move(rows), makeProfile))
+    {
+        WriteChangedRows(trans, *changes, _savedCUFProfiles.GetSaved(), false, deleteProfile, makeProfile);
+        return;
+    }
+
     for (uint8 i = 0; i < MAX_CUF_PROFILES; ++i)
     {
         if (!_CUFProfiles[i]) // unused profile
-        {
-            // DELETE FROM character_cuf_profiles WHERE guid = ? and id = ?
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_CUF_PROFILES);
-            stmt->setUInt32(0, lowGuid);
-            stmt->setUInt8(1, i);
-        }
+            deleteProfile(i);
         else
-        {
-            // REPLACE INTO character_cuf_profiles (guid, id, name, frameHeight, frameWidth, sortBy, healthText, boolOptions, unk146, unk147, unk148, unk150, unk152, unk154) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CHAR_CUF_PROFILES);
-            stmt->setUInt32(0, lowGuid);
-            stmt->setUInt8(1, i);
-            stmt->setString(2, _CUFProfiles[i]->ProfileName);
-            stmt->setUInt16(3, _CUFProfiles[i]->FrameHeight);
-            stmt->setUInt16(4, _CUFProfiles[i]->FrameWidth);
-            stmt->setUInt8(5, _CUFProfiles[i]->SortBy);
-            stmt->setUInt8(6, _CUFProfiles[i]->HealthText);
-            stmt->setUInt32(7, _CUFProfiles[i]->BoolOptions.to_ulong()); // 27 of 32 fields used, fits in an int
-            stmt->setUInt8(8, _CUFProfiles[i]->TopPoint);
-            stmt->setUInt8(9, _CUFProfiles[i]->BottomPoint);
-            stmt->setUInt8(10, _CUFProfiles[i]->LeftPoint);
-            stmt->setUInt16(11, _CUFProfiles[i]->TopOffset);
-            stmt->setUInt16(12, _CUFProfiles[i]->BottomOffset);
-            stmt->setUInt16(13, _CUFProfiles[i]->LeftOffset);
-        }
-
-        trans->Append(stmt);
+            trans->Append(makeProfile(i, *_CUFProfiles[i]));
     }
 }
 
@@ -26097,23 +26262,44 @@ void Player::_SaveEquipmentSets(CharacterDatabaseTransaction& trans)
 
 void Player::_SaveBGData(CharacterDatabaseTransaction& trans)
 {
+    BGSaveData data;
+    data.InstanceId = m_bgData.bgInstanceID;
+    data.Team = m_bgData.bgTeam;
+    data.JoinX = m_bgData.joinPos.GetPositionX();
+    data.JoinY = m_bgData.joinPos.GetPositionY();
+    data.JoinZ = m_bgData.joinPos.GetPositionZ();
+    data.JoinO = m_bgData.joinPos.GetOrientation();
+    data.JoinMapId = m_bgData.joinPos.GetMapId();
+    data.TaxiPath = { m_bgData.taxiPath[0], m_bgData.taxiPath[1] };
+    data.MountSpell = m_bgData.mountSpell;
+
+    auto makeBGData = [&](uint8 /*key*/, BGSaveData const& row)
+    {
+        /* guid, bgInstanceID, bgTeam, x, y, z, o, map, taxi[0], taxi[1], mountSpell */
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PLAYER_BGDATA);
+        stmt->setUInt32(0, GetGUID().GetCounter());
+        stmt->setUInt32(1, row.InstanceId);
+        stmt->setUInt16(2, row.Team);
+        stmt->setFloat (3, row.JoinX);
+        stmt->setFloat (4, row.JoinY);
+        stmt->setFloat (5, row.JoinZ);
+        stmt->setFloat (6, row.JoinO);
+        stmt->setUInt16(7, row.JoinMapId);
+        stmt->setUInt16(8, row.TaxiPath[0]);
+        stmt->setUInt16(9, row.TaxiPath[1]);
+        stmt->setUInt16(10, row.MountSpell);
+        return stmt;
+    };
+
+    // single row, written again as a whole if anything changed
+    if (auto changes = GetChangedRows(this, "battleground data", _savedBGData, { { 0, data } }, makeBGData))
+        if (changes->IsEmpty())
+            return;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_BGDATA);
     stmt->setUInt32(0, GetGUID().GetCounter());
     trans->Append(stmt);
-    /* guid, bgInstanceID, bgTeam, x, y, z, o, map, taxi[0], taxi[1], mountSpell */
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PLAYER_BGDATA);
-    stmt->setUInt32(0, GetGUID().GetCounter());
-    stmt->setUInt32(1, m_bgData.bgInstanceID);
-    stmt->setUInt16(2, m_bgData.bgTeam);
-    stmt->setFloat (3, m_bgData.joinPos.GetPositionX());
-    stmt->setFloat (4, m_bgData.joinPos.GetPositionY());
-    stmt->setFloat (5, m_bgData.joinPos.GetPositionZ());
-    stmt->setFloat (6, m_bgData.joinPos.GetOrientation());
-    stmt->setUInt16(7, m_bgData.joinPos.GetMapId());
-    stmt->setUInt16(8, m_bgData.taxiPath[0]);
-    stmt->setUInt16(9, m_bgData.taxiPath[1]);
-    stmt->setUInt16(10, m_bgData.mountSpell);
-    trans->Append(stmt);
+    trans->Append(makeBGData(0, data));
 }
 
 void Player::DeleteEquipmentSet(uint64 setGuid)
@@ -26185,27 +26371,51 @@ void Player::_LoadGlyphs(PreparedQueryResult result)
     while (result->NextRow());
 }
 
-void Player::_SaveGlyphs(CharacterDatabaseTransaction& trans) const
+void Player::_SaveGlyphs(CharacterDatabaseTransaction& trans)
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_GLYPHS);
-    stmt->setUInt32(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+    std::map<uint8, GlyphSaveData> rows;
+    for (uint8 spec = 0; spec < GetSpecsCount(); ++spec)
+    {
+        GlyphSaveData& glyphs = rows[spec];
+        for (uint8 i = 0; i < MAX_GLYPH_SLOT_INDEX; ++i)
+            glyphs[i] = GetGlyph(spec, i);
+    }
 
+    auto deleteGlyphs = [&](uint8 spec)
+    {
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_GLYPHS_BY_TALENT_GROUP);
+        stmt->setUInt32(0, GetGUID().GetCounter());
+        stmt->setUInt8(1, spec);
+        trans->Append(stmt);
+    };
 
-    for (uint8 spec = 0; spec < GetSpecsCount(); ++spec)
+    auto makeGlyphs = [&](uint8 spec, GlyphSaveData const& glyphs)
     {
         uint8 index = 0;
 
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_GLYPHS);
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_GLYPHS);
         stmt->setUInt32(index++, GetGUID().GetCounter());
 
         stmt->setUInt8(index++, spec);
 
         for (uint8 i = 0; i < MAX_GLYPH_SLOT_INDEX; ++i)
-            stmt->setUInt16(index++, uint16(GetGlyph(spec, i)));
+            stmt->setUInt16(index++, uint16(glyphs[i]));
 
-        trans->Append(stmt);
+        return stmt;
+    };
+
+    if (auto changes = GetChangedRows(this, "glyphs", _savedGlyphs, std::move(rows), makeGlyphs))
+    {
+        WriteChangedRows(trans, *changes, _savedGlyphs.GetSaved(), true, deleteGlyphs, makeGlyphs);
+        return;
     }
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_GLYPHS);
+    stmt->setUInt32(0, GetGUID().GetCounter());
+    trans->Append(stmt);
+
+    for (auto const& [spec, glyphs] : _savedGlyphs.GetSaved())
+        trans->Append(makeGlyphs(spec, glyphs));
 }
 
 void Player::_LoadTalents(PreparedQueryResult result)
@@ -27377,221 +27587,65 @@ void Player::ValidateMovementInfo(MovementInfo* mi)
 
 void Player::ReadMovementInfo(WorldPacket& data, MovementInfo* mi, Movement::ExtraMovementStatusElement* extras /*= nullptr*/)
 {
-    MovementStatusElements const* sequence = GetMovementStatusElementsSequence(static_cast<OpcodeClient>(data.GetOpcode()));
-    if (!sequence)
+    Movement::MovementStatusReader reader = Movement::GetMovementStatusReader(data.GetOpcode());
+    if (!reader)
     {
         TC_LOG_ERROR("network", "Player::ReadMovementInfo: No movement sequence found for opcode %s", GetOpcodeNameForLogging(static_cast<OpcodeClient>(data.GetOpcode())).c_str());
         return;
     }
 
-    bool hasMovementFlags = false;
-    bool hasMovementFlags2 = false;
-    bool hasTimestamp = false;
-    bool hasOrientation = false;
-    bool hasTransportData = false;
-    bool hasTransportTime2 = false;
-    bool hasTransportVehicleId = false;
-    bool hasPitch = false;
-    bool hasFallData = false;
-    bool hasFallDirection = false;
-    bool hasSplineElevation = false;
-
-    ObjectGuid guid;
-    ObjectGuid tguid;
-
-    for (; *sequence != MSEEnd; ++sequence)
-    {
-        MovementStatusElements const& element = *sequence;
-
-        switch (element)
-        {
-            case MSEHasGuidByte0:
-            case MSEHasGuidByte1:
-            case MSEHasGuidByte2:
-            case MSEHasGuidByte3:
-            case MSEHasGuidByte4:
-            case MSEHasGuidByte5:
-            case MSEHasGuidByte6:
-            case MSEHasGuidByte7:
-                guid[element - MSEHasGuidByte0] = data.ReadBit();
-                break;
-            case MSEHasTransportGuidByte0:
-            case MSEHasTransportGuidByte1:
-            case MSEHasTransportGuidByte2:
-            case MSEHasTransportGuidByte3:
-            case MSEHasTransportGuidByte4:
-            case MSEHasTransportGuidByte5:
-            case MSEHasTransportGuidByte6:
-            case MSEHasTransportGuidByte7:
-                if (hasTransportData)
-                    tguid[element - MSEHasTransportGuidByte0] = data.ReadBit();
-                break;
-            case MSEGuidByte0:
-            case MSEGuidByte1:
-            case MSEGuidByte2:
-            case MSEGuidByte3:
-            case MSEGuidByte4:
-            case MSEGuidByte5:
-            case MSEGuidByte6:
-            case MSEGuidByte7:
-                data.ReadByteSeq(guid[element - MSEGuidByte0]);
-                break;
-            case MSETransportGuidByte0:
-            case MSETransportGuidByte1:
-            case MSETransportGuidByte2:
-            case MSETransportGuidByte3:
-            case MSETransportGuidByte4:
-            case MSETransportGuidByte5:
-            case MSETransportGuidByte6:
-            case MSETransportGuidByte7:
-                if (hasTransportData)
-                    data.ReadByteSeq(tguid[element - MSETransportGuidByte0]);
-                break;
-            case MSEHasMovementFlags:
-                hasMovementFlags = !data.ReadBit();
-                break;
-            case MSEHasMovementFlags2:
-                hasMovementFlags2 = !data.ReadBit();
-                break;
-            case MSEHasTimestamp:
-                hasTimestamp = !data.ReadBit();
-                break;
-            case MSEHasOrientation:
-                hasOrientation = !data.ReadBit();
-                break;
-            case MSEHasTransportData:
-                hasTransportData = data.ReadBit();
-                break;
-            case MSEHasTransportTime2:
-                if (hasTransportData)
-                    hasTransportTime2 = data.ReadBit();
-                break;
-            case MSEHasVehicleId:
-                if (hasTransportData)
-                    hasTransportVehicleId = data.ReadBit();
-                break;
-            case MSEHasPitch:
-                hasPitch = !data.ReadBit();
-                break;
-            case MSEHasFallData:
-                hasFallData = data.ReadBit();
-                break;
-            case MSEHasFallDirection:
-                if (hasFallData)
-                    hasFallDirection = data.ReadBit();
-                break;
-            case MSEHasSplineElevation:
-                hasSplineElevation = !data.ReadBit();
-                break;
-            case MSEHasSpline:
-                data.ReadBit();
-                break;
-            case MSEHasHeightChangeFailed:
-                data.ReadBit();
-                break;
-            case MSEMovementFlags:
-                if (hasMovementFlags)
-                    mi->flags = data.ReadBits(30);
-                break;
-            case MSEMovementFlags2:
-                if (hasMovementFlags2)
-                    mi->flags2 = data.ReadBits(12);
-                break;
-            case MSETimestamp:
-                if (hasTimestamp)
-                    data >> mi->time;
-                break;
-            case MSEPositionX:
-                data >> mi->pos.m_positionX;
-                break;
-            case MSEPositionY:
-                data >> mi->pos.m_positionY;
-                break;
-            case MSEPositionZ:
-                data >> mi->pos.m_positionZ;
-                break;
-            case MSEOrientation:
-                if (hasOrientation)
-                    mi->pos.SetOrientation(data.read<float>());
-                break;
-            case MSETransportPositionX:
-                if (hasTransportData)
-                    data >> mi->transport.pos.m_positionX;
-                break;
-            case MSETransportPositionY:
-                if (hasTransportData)
-                    data >> mi->transport.pos.m_positionY;
-                break;
-            case MSETransportPositionZ:
-                if (hasTransportData)
-                    data >> mi->transport.pos.m_positionZ;
-                break;
-            case MSETransportOrientation:
-                if (hasTransportData)
-                    mi->transport.pos.SetOrientation(data.read<float>());
-                break;
-            case MSETransportSeat:
-                if (hasTransportData)
-                    data >> mi->transport.seat;
-                break;
-            case MSETransportTime:
-                if (hasTransportData)
-                    data >> mi->transport.time;
-                break;
-            case MSETransportTime2:
-                if (hasTransportData && hasTransportTime2)
-                    data >> mi->transport.time2;
-                break;
-            case MSETransportVehicleId:
-                if (hasTransportData && hasTransportVehicleId)
-                    data >> mi->transport.vehicleId;
-                break;
-            case MSEPitch:
-                if (hasPitch)
-                    mi->pitch = G3D::wrap(data.read<float>(), float(-M_PI), float(M_PI));
-                break;
-            case MSEFallTime:
-                if (hasFallData)
-                    data >> mi->jump.fallTime;
-                break;
-            case MSEFallVerticalSpeed:
-                if (hasFallData)
-                    data >> mi->jump.zspeed;
-                break;
-            case MSEFallCosAngle:
-                if (hasFallData && hasFallDirection)
-                    data >> mi->jump.cosAngle;
-                break;
-            case MSEFallSinAngle:
-                if (hasFallData && hasFallDirection)
-                    data >> mi->jump.sinAngle;
-                break;
-            case MSEFallHorizontalSpeed:
-                if (hasFallData && hasFallDirection)
-                    data >> mi->jump.xyspeed;
-                break;
-            case MSESplineElevation:
-                if (hasSplineElevation)
-                    data >> mi->splineElevation;
-                break;
-            case MSECounter:
-                data >> mi->movementCounter;
-                break;
-            case MSEZeroBit:
-            case MSEOneBit:
-                data.ReadBit();
-                break;
-            case MSEExtraElement:
-                extras->ReadNextElement(data);
-                break;
-            default:
-                ASSERT(Movement::PrintInvalidSequenceElement(element, __FUNCTION__));
-                break;
-        }
-    }
-
-    mi->guid = guid;
-    mi->transport.guid = tguid;
+    // elements missing from the sequence or from the packet keep their previous value
+    Movement::MovementStatus status;
+    status.Flags = mi->flags;
+    status.Flags2 = mi->flags2;
+    status.Time = mi->time;
+    status.PositionX = mi->pos.GetPositionX();
+    status.PositionY = mi->pos.GetPositionY();
+    status.PositionZ = mi->pos.GetPositionZ();
+    status.Orientation = mi->pos.GetOrientation();
+    status.TransportPositionX = mi->transport.pos.GetPositionX();
+    status.TransportPositionY = mi->transport.pos.GetPositionY();
+    status.TransportPositionZ = mi->transport.pos.GetPositionZ();
+    status.TransportOrientation = mi->transport.pos.GetOrientation();
+    status.TransportSeat = mi->transport.seat;
+    status.TransportTime = mi->transport.time;
+    status.TransportTime2 = mi->transport.time2;
+    status.TransportVehicleId = mi->transport.vehicleId;
+    status.Pitch = mi->pitch;
+    status.FallTime = mi->jump.fallTime;
+    status.FallVerticalSpeed = mi->jump.zspeed;
+    status.FallCosAngle = mi->jump.cosAngle;
+    status.FallSinAngle = mi->jump.sinAngle;
+    status.FallHorizontalSpeed = mi->jump.xyspeed;
+    status.SplineElevation = mi->splineElevation;
+    status.Counter = mi->movementCounter;
+
+    reader(data, status, extras);
+
+    mi->guid = ObjectGuid(Movement::MovementStatus::GuidFromBytes(status.Guid));
+    mi->flags = status.Flags;
+    mi->flags2 = status.Flags2;
+    mi->time = status.Time;
+    mi->pos.Relocate(status.PositionX, status.PositionY, status.PositionZ);
+    if (status.HasOrientation)
+        mi->pos.SetOrientation(status.Orientation);
+    mi->transport.guid = ObjectGuid(Movement::MovementStatus::GuidFromBytes(status.TransportGuid));
+    mi->transport.pos.Relocate(status.TransportPositionX, status.TransportPositionY, status.TransportPositionZ);
+    if (status.HasTransportData)
+        mi->transport.pos.SetOrientation(status.TransportOrientation);
+    mi->transport.seat = status.TransportSeat;
+    mi->transport.time = status.TransportTime;
+    mi->transport.time2 = status.TransportTime2;
+    mi->transport.vehicleId = status.TransportVehicleId;
+    if (status.HasPitch)
+        mi->pitch = G3D::wrap(status.Pitch, float(-M_PI), float(M_PI));
+    mi->jump.fallTime = status.FallTime;
+    mi->jump.zspeed = status.FallVerticalSpeed;
+    mi->jump.cosAngle = status.FallCosAngle;
+    mi->jump.sinAngle = status.FallSinAngle;
+    mi->jump.xyspeed = status.FallHorizontalSpeed;
+    mi->splineElevation = status.SplineElevation;
+    mi->movementCounter = status.Counter;
 
     ValidateMovementInfo(mi);
 }
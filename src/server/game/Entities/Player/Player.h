@@ -19,6 +19,7 @@
 #define _PLAYER_H
 
 #include "Unit.h"
+#include "ChangeTracker.h"
 #include "CUFProfile.h"
 #include "DatabaseEnvFwd.h"
 #include "DBCEnums.h"
@@ -976,6 +977,45 @@ struct VoidStorageItem
     ObjectGuid CreatorGuid;
     ItemRandomEnchantmentId ItemRandomPropertyId;
     uint32 ItemSuffixFactor;
+
+    bool operator==(VoidStorageItem const& right) const = default;
+};
+
+/// Primary key of character_aura without the owner guid
+typedef std::tuple<uint64 /*casterGuid*/, uint64 /*itemGuid*/, uint32 /*spell*/, uint8 /*effectMask*/> AuraSaveKey;
+
+/// Remaining columns of character_aura, compared by the differential save
+struct AuraSaveData
+{
+    uint8 RecalculateMask;
+    uint8 StackCount;
+    std::array<int32, MAX_SPELL_EFFECTS> Amount;
+    std::array<int32, MAX_SPELL_EFFECTS> BaseAmount;
+    int32 MaxDuration;
+    int32 Duration;
+    uint8 Charges;
+    float CritChance;
+    bool ApplyResilience;
+
+    bool operator==(AuraSaveData const& right) const = default;
+};
+
+typedef std::array<uint32, MAX_GLYPH_SLOT_INDEX> GlyphSaveData;
+
+/// Columns of character_battleground_data, compared by the differential save
+struct BGSaveData
+{
+    uint32 InstanceId;
+    uint32 Team;
+    float JoinX;
+    float JoinY;
+    float JoinZ;
+    float JoinO;
+    uint32 JoinMapId;
+    std::array<uint32, 2> TaxiPath;
+    uint32 MountSpell;
+
+    bool operator==(BGSaveData const& right) const = default;
 };
 
 struct ResurrectionData
@@ -1513,6 +1553,8 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
 
         void SaveToDB(bool create = false);
         void SaveToDB(CharacterDatabaseTransaction trans, bool create = false);
+        // makes the next save write every row of differentially saved tables, after a failed commit
+        void ResetSavedRows();
         void SaveInventoryAndGoldToDB(CharacterDatabaseTransaction& trans);                    // fast save function for item/money cheating preventing
         void SaveGoldToDB(CharacterDatabaseTransaction& trans) const;
 
@@ -2084,6 +2126,7 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         void SendInitWorldStates(uint32 zone, uint32 area);
         void SendUpdateWorldState(uint32 variable, uint32 value, bool hidden = false) const;
         void SendDirectMessage(WorldPacket const* data) const;
+        void SendDirectMessage(std::shared_ptr<WorldPacket const> const& data) const;
 
         void SendAurasForTarget(Unit* target) const;
 
@@ -2524,7 +2567,7 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         void _SaveSpells(CharacterDatabaseTransaction& trans);
         void _SaveEquipmentSets(CharacterDatabaseTransaction& trans);
         void _SaveBGData(CharacterDatabaseTransaction& trans);
-        void _SaveGlyphs(CharacterDatabaseTransaction& trans) const;
+        void _SaveGlyphs(CharacterDatabaseTransaction& trans);
         void _SaveTalents(CharacterDatabaseTransaction& trans);
         void _SaveStats(CharacterDatabaseTransaction& trans) const;
         void _SaveInstanceTimeRestrictions(CharacterDatabaseTransaction& trans);
@@ -2704,6 +2747,13 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
 
         std::array<std::unique_ptr<CUFProfile>, MAX_CUF_PROFILES> _CUFProfiles;
 
+        // rows written by the previous save of tables that are otherwise rewritten completely, see PlayerSave.Differential
+        Trinity::ChangeTracker<AuraSaveKey, AuraSaveData> _savedAuras;
+        Trinity::ChangeTracker<uint8 /*talentGroup*/, GlyphSaveData> _savedGlyphs;
+        Trinity::ChangeTracker<uint8 /*slot*/, VoidStorageItem> _savedVoidStorage;
+        Trinity::ChangeTracker<uint8 /*id*/, CUFProfile> _savedCUFProfiles;
+        Trinity::ChangeTracker<uint8, BGSaveData> _savedBGData;
+
         SpellInfo const* m_lastSoulburnSpell;
 
     private:
@@ -709,9 +709,11 @@ void Transport::BuildUpdate(UpdateDataMapType& data_map)
     if (players.isEmpty())
         return;
 
+    ValuesUpdateBlockCache cache;
+    ValuesUpdateBlockCache* sharedCache = IsValuesUpdateSharedBetweenViewers() ? &cache : nullptr;
     for (MapReference const& playerReference : players)
         if (playerReference.GetSource()->IsInPhase(this))
-            BuildFieldsUpdate(playerReference.GetSource(), data_map);
+            BuildFieldsUpdate(playerReference.GetSource(), data_map, sharedCache);
 
     ClearUpdateMask(true);
 }
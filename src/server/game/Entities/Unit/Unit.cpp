@@ -13023,227 +13023,62 @@ void Unit::NearTeleportTo(Position const& pos, bool casting /*= false*/)
 
 void Unit::WriteMovementInfo(WorldPacket& data, Movement::ExtraMovementStatusElement* extras /*= nullptr*/, uint32* movementCounter /*= nullptr*/)
 {
-    MovementInfo const& mi = m_movementInfo;
-
-    bool hasMovementFlags = GetUnitMovementFlags() != 0;
-    bool hasMovementFlags2 = GetExtraUnitMovementFlags() != 0;
-    bool hasTimestamp = true;
-    bool hasOrientation = !G3D::fuzzyEq(GetOrientation(), 0.0f);
-    bool hasTransportData = GetTransGUID() != 0;
-    bool hasSpline = IsSplineEnabled();
-
-    bool hasTransportTime2 = hasTransportData && m_movementInfo.transport.time2 != 0;
-    bool hasTransportVehicleId = hasTransportData && m_movementInfo.transport.vehicleId != 0;
-    bool hasPitch = HasUnitMovementFlag(MovementFlags(MOVEMENTFLAG_SWIMMING | MOVEMENTFLAG_FLYING)) || HasExtraUnitMovementFlag(MOVEMENTFLAG2_ALWAYS_ALLOW_PITCHING);
-    bool hasFallDirection = HasUnitMovementFlag(MOVEMENTFLAG_FALLING);
-    bool hasFallData = hasFallDirection || m_movementInfo.jump.fallTime != 0;
-    bool hasSplineElevation = HasUnitMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION);
-
-    MovementStatusElements const* sequence = GetMovementStatusElementsSequence(static_cast<OpcodeClient>(data.GetOpcode()));
-    if (!sequence)
+    Movement::MovementStatusWriter writer = Movement::GetMovementStatusWriter(data.GetOpcode());
+    if (!writer)
     {
         TC_LOG_ERROR("network", "Unit::WriteMovementInfo: No movement sequence found for opcode %s", GetOpcodeNameForLogging(static_cast<OpcodeClient>(data.GetOpcode())).c_str());
         return;
     }
 
-    ObjectGuid guid = GetGUID();
-    ObjectGuid tguid = hasTransportData ? GetTransGUID() : ObjectGuid::Empty;
-
-    for (; *sequence != MSEEnd; ++sequence)
-    {
-        MovementStatusElements const& element = *sequence;
-
-        switch (element)
-        {
-            case MSEHasGuidByte0:
-            case MSEHasGuidByte1:
-            case MSEHasGuidByte2:
-            case MSEHasGuidByte3:
-            case MSEHasGuidByte4:
-            case MSEHasGuidByte5:
-            case MSEHasGuidByte6:
-            case MSEHasGuidByte7:
-                data.WriteBit(guid[element - MSEHasGuidByte0]);
-                break;
-            case MSEHasTransportGuidByte0:
-            case MSEHasTransportGuidByte1:
-            case MSEHasTransportGuidByte2:
-            case MSEHasTransportGuidByte3:
-            case MSEHasTransportGuidByte4:
-            case MSEHasTransportGuidByte5:
-            case MSEHasTransportGuidByte6:
-            case MSEHasTransportGuidByte7:
-                if (hasTransportData)
-                    data.WriteBit(tguid[element - MSEHasTransportGuidByte0]);
-                break;
-            case MSEGuidByte0:
-            case MSEGuidByte1:
-            case MSEGuidByte2:
-            case MSEGuidByte3:
-            case MSEGuidByte4:
-            case MSEGuidByte5:
-            case MSEGuidByte6:
-            case MSEGuidByte7:
-                data.WriteByteSeq(guid[element - MSEGuidByte0]);
-                break;
-            case MSETransportGuidByte0:
-            case MSETransportGuidByte1:
-            case MSETransportGuidByte2:
-            case MSETransportGuidByte3:
-            case MSETransportGuidByte4:
-            case MSETransportGuidByte5:
-            case MSETransportGuidByte6:
-            case MSETransportGuidByte7:
-                if (hasTransportData)
-                    data.WriteByteSeq(tguid[element - MSETransportGuidByte0]);
-                break;
-            case MSEHasMovementFlags:
-                data.WriteBit(!hasMovementFlags);
-                break;
-            case MSEHasMovementFlags2:
-                data.WriteBit(!hasMovementFlags2);
-                break;
-            case MSEHasTimestamp:
-                data.WriteBit(!hasTimestamp);
-                break;
-            case MSEHasOrientation:
-                data.WriteBit(!hasOrientation);
-                break;
-            case MSEHasTransportData:
-                data.WriteBit(hasTransportData);
-                break;
-            case MSEHasTransportTime2:
-                if (hasTransportData)
-                    data.WriteBit(hasTransportTime2);
-                break;
-            case MSEHasVehicleId:
-                if (hasTransportData)
-                    data.WriteBit(hasTransportVehicleId);
-                break;
-            case MSEHasPitch:
-                data.WriteBit(!hasPitch);
-                break;
-            case MSEHasFallData:
-                data.WriteBit(hasFallData);
-                break;
-            case MSEHasFallDirection:
-                if (hasFallData)
-                    data.WriteBit(hasFallDirection);
-                break;
-            case MSEHasSplineElevation:
-                data.WriteBit(!hasSplineElevation);
-                break;
-            case MSEHasSpline:
-                data.WriteBit(hasSpline);
-                break;
-            case MSEHasHeightChangeFailed:
-                data.WriteBit(mi.HasHeightChangeFailed());
-                break;
-            case MSEMovementFlags:
-                if (hasMovementFlags)
-                    data.WriteBits(GetUnitMovementFlags(), 30);
-                break;
-            case MSEMovementFlags2:
-                if (hasMovementFlags2)
-                    data.WriteBits(GetExtraUnitMovementFlags(), 12);
-                break;
-            case MSETimestamp:
-                if (hasTimestamp)
-                    data << mi.time;
-                break;
-            case MSEPositionX:
-                data << GetPositionX();
-                break;
-            case MSEPositionY:
-                data << GetPositionY();
-                break;
-            case MSEPositionZ:
-                data << GetPositionZ();
-                break;
-            case MSEOrientation:
-                if (hasOrientation)
-                    data << GetOrientation();
-                break;
-            case MSETransportPositionX:
-                if (hasTransportData)
-                    data << GetTransOffsetX();
-                break;
-            case MSETransportPositionY:
-                if (hasTransportData)
-                    data << GetTransOffsetY();
-                break;
-            case MSETransportPositionZ:
-                if (hasTransportData)
-                    data << GetTransOffsetZ();
-                break;
-            case MSETransportOrientation:
-                if (hasTransportData)
-                    data << GetTransOffsetO();
-                break;
-            case MSETransportSeat:
-                if (hasTransportData)
-                    data << GetTransSeat();
-                break;
-            case MSETransportTime:
-                if (hasTransportData)
-                    data << GetTransTime();
-                break;
-            case MSETransportTime2:
-                if (hasTransportData && hasTransportTime2)
-                    data << mi.transport.time2;
-                break;
-            case MSETransportVehicleId:
-                if (hasTransportData && hasTransportVehicleId)
-                    data << mi.transport.vehicleId;
-                break;
-            case MSEPitch:
-                if (hasPitch)
-                    data << mi.pitch;
-                break;
-            case MSEFallTime:
-                if (hasFallData)
-                    data << mi.jump.fallTime;
-                break;
-            case MSEFallVerticalSpeed:
-                if (hasFallData)
-                    data << mi.jump.zspeed;
-                break;
-            case MSEFallCosAngle:
-                if (hasFallData && hasFallDirection)
-                    data << mi.jump.cosAngle;
-                break;
-            case MSEFallSinAngle:
-                if (hasFallData && hasFallDirection)
-                    data << mi.jump.sinAngle;
-                break;
-            case MSEFallHorizontalSpeed:
-                if (hasFallData && hasFallDirection)
-                    data << mi.jump.xyspeed;
-                break;
-            case MSESplineElevation:
-                if (hasSplineElevation)
-                    data << mi.splineElevation;
-                break;
-            case MSECounter:
-                data << uint32(movementCounter ? *movementCounter : 0);
-                break;
-            case MSEZeroBit:
-                data.WriteBit(0);
-                break;
-            case MSEOneBit:
-                data.WriteBit(1);
-                break;
-            case MSEFlushBits:
-                data.FlushBits();
-                break;
-            case MSEExtraElement:
-                extras->WriteNextElement(data);
-                break;
-            default:
-                ASSERT(Movement::PrintInvalidSequenceElement(element, __FUNCTION__));
-                break;
-        }
-    }
+    MovementInfo const& mi = m_movementInfo;
+    ObjectGuid transportGuid = GetTransGUID();
+
+    Movement::MovementStatus status;
+    status.HasMovementFlags = GetUnitMovementFlags() != 0;
+    status.HasMovementFlags2 = GetExtraUnitMovementFlags() != 0;
+    status.HasTimestamp = true;
+    status.HasOrientation = !G3D::fuzzyEq(GetOrientation(), 0.0f);
+    status.HasTransportData = !transportGuid.IsEmpty();
+    status.HasSpline = IsSplineEnabled();
+    status.HasTransportTime2 = status.HasTransportData && mi.transport.time2 != 0;
+    status.HasTransportVehicleId = status.HasTransportData && mi.transport.vehicleId != 0;
+    status.HasPitch = HasUnitMovementFlag(MovementFlags(MOVEMENTFLAG_SWIMMING | MOVEMENTFLAG_FLYING)) || HasExtraUnitMovementFlag(MOVEMENTFLAG2_ALWAYS_ALLOW_PITCHING);
+    status.HasFallDirection = HasUnitMovementFlag(MOVEMENTFLAG_FALLING);
+    status.HasFallData = status.HasFallDirection || mi.jump.fallTime != 0;
+    status.HasSplineElevation = HasUnitMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION);
+    status.HeightChangeFailed = mi.HasHeightChangeFailed();
+
+    status.Guid = Movement::MovementStatus::GuidToBytes(GetGUID().GetRawValue());
+    status.Flags = GetUnitMovementFlags();
+    status.Flags2 = GetExtraUnitMovementFlags();
+    status.Time = mi.time;
+    status.PositionX = GetPositionX();
+    status.PositionY = GetPositionY();
+    status.PositionZ = GetPositionZ();
+    status.Orientation = GetOrientation();
+    if (status.HasTransportData)
+    {
+        status.TransportGuid = Movement::MovementStatus::GuidToBytes(transportGuid.GetRawValue());
+        status.TransportPositionX = GetTransOffsetX();
+        status.TransportPositionY = GetTransOffsetY();
+        status.TransportPositionZ = GetTransOffsetZ();
+        status.TransportOrientation = GetTransOffsetO();
+        status.TransportSeat = GetTransSeat();
+        status.TransportTime = GetTransTime();
+        status.TransportTime2 = mi.transport.time2;
+        status.TransportVehicleId = mi.transport.vehicleId;
+    }
+
+    status.Pitch = mi.pitch;
+    status.FallTime = mi.jump.fallTime;
+    status.FallVerticalSpeed = mi.jump.zspeed;
+    status.FallCosAngle = mi.jump.cosAngle;
+    status.FallSinAngle = mi.jump.sinAngle;
+    status.FallHorizontalSpeed = mi.jump.xyspeed;
+    status.SplineElevation = mi.splineElevation;
+    status.Counter = movementCounter ? *movementCounter : 0;
+
+    writer(data, status, extras);
 }
 
 void Unit::SendTeleportPacket(Position const& pos)
@@ -13952,16 +13787,19 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
     if (IsCreature())
         visibleFlag |= UF_FLAG_UNIT_ALL;
 
+    // special info fields are always sent when visible
+    std::array<UpdateMask::BlockType, UPDATE_MASK_MAX_BLOCKS> blocks;
+    uint32 blockCount = BuildValuesUpdateMask(updateType, flags, visibleFlag, valCount, blocks.data(), visibleFlag & UF_FLAG_SPECIAL_INFO);
+    if (HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK))
+        blocks[UpdateMask::GetBlockIndex(UNIT_FIELD_AURASTATE)] |= UpdateMask::GetBlockFlag(UNIT_FIELD_AURASTATE);
+
     Creature const* creature = ToCreature();
-    for (uint16 index = 0; index < valCount; ++index)
+    for (uint32 block = 0; block < blockCount; ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((flags[index] & visibleFlag) & UF_FLAG_SPECIAL_INFO) ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-            (index == UNIT_FIELD_AURASTATE && HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK)))
+        updateMask.SetBlock(block, blocks[block]);
+        for (UpdateMask::BlockType bits = blocks[block]; bits; bits &= bits - 1)
         {
-            updateMask.SetBit(index);
-
+            uint16 index = block * UpdateMask::BLOCK_BITS + UpdateMask::GetFirstSetBit(bits);
             if (index == UNIT_NPC_FLAGS)
             {
                 uint32 appendValue = m_uint32Values[UNIT_NPC_FLAGS];
@@ -14089,6 +13927,27 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
     data->append(fieldBuffer);
 }
 
+bool Unit::IsValuesUpdateSharedBetweenViewers() const
+{
+    // aura state is rebuilt for every target
+    if (HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK) || IsUpdateFieldPending(UNIT_FIELD_AURASTATE, UnitUpdateFieldFlags))
+        return false;
+
+    // tap and loot state are per target
+    if (IsUpdateFieldPending(UNIT_DYNAMIC_FLAGS, UnitUpdateFieldFlags))
+        return false;
+
+    if (IsUpdateFieldPending(UNIT_NPC_FLAGS, UnitUpdateFieldFlags) && HasFlag(UNIT_NPC_FLAGS, UNIT_NPC_FLAG_SPELLCLICK | UNIT_NPC_FLAG_TRAINER_CLASS))
+        return false;
+
+    if (IsControlledByPlayer() && sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GROUP))
+        if (IsUpdateFieldPending(UNIT_FIELD_BYTES_2, UnitUpdateFieldFlags) || IsUpdateFieldPending(UNIT_FIELD_FACTIONTEMPLATE, UnitUpdateFieldFlags))
+            return false;
+
+    // UNIT_FIELD_FLAGS and UNIT_FIELD_DISPLAYID only depend on gm state which is part of the viewer class
+    return true;
+}
+
 void Unit::DestroyForPlayer(Player* target, bool /*onDeath = false*/) const
 {
     if (Battleground* bg = target->GetBattleground())
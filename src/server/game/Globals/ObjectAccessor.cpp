@@ -39,6 +39,7 @@ void HashMapHolder<T>::Insert(T* o)
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
     GetContainer()[o->GetGUID()] = o;
+    GetIndex().Insert(o->GetGUID(), o);
 }
 
 template<class T>
@@ -47,15 +48,13 @@ void HashMapHolder<T>::Remove(T* o)
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
     GetContainer().erase(o->GetGUID());
+    GetIndex().Erase(o->GetGUID());
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    std::shared_lock<std::shared_mutex> lock(*GetLock());
-
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+    return GetIndex().Find(guid, nullptr);
 }
 
 template<class T>
@@ -65,6 +64,21 @@ auto HashMapHolder<T>::GetContainer() -> MapType&
     return _objectMap;
 }
 
+template<class T>
+void HashMapHolder<T>::ReclaimRetired()
+{
+    std::unique_lock<std::shared_mutex> lock(*GetLock());
+
+    GetIndex().ReclaimRetired();
+}
+
+template<class T>
+auto HashMapHolder<T>::GetIndex() -> IndexType&
+{
+    static IndexType _objectIndex;
+    return _objectIndex;
+}
+
 template<class T>
 std::shared_mutex* HashMapHolder<T>::GetLock()
 {
@@ -269,6 +283,11 @@ Player* ObjectAccessor::FindConnectedPlayerByName(std::string const& name)
     return PlayerNameMapHolder::Find(name);
 }
 
+void ObjectAccessor::ReclaimRetiredPlayerContainers()
+{
+    HashMapHolder<Player>::ReclaimRetired();
+}
+
 void ObjectAccessor::SaveAllPlayers()
 {
     std::shared_lock<std::shared_mutex> lock(*HashMapHolder<Player>::GetLock());
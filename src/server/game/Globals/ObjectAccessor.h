@@ -19,6 +19,7 @@
 #define TRINITY_OBJECTACCESSOR_H
 
 #include "ObjectGuid.h"
+#include "RcuMap.h"
 #include <shared_mutex>
 #include <unordered_map>
 
@@ -44,16 +45,27 @@ class TC_GAME_API HashMapHolder
 
 public:
     typedef std::unordered_map<ObjectGuid, T*> MapType;
+    typedef Trinity::Containers::RcuMap<ObjectGuid, T*> IndexType;
 
     static void Insert(T* o);
 
     static void Remove(T* o);
 
+    // lock free, readers never touch the lock or any shared cache line written by other readers
     static T* Find(ObjectGuid guid);
 
+    // iterating requires holding GetLock()
     static MapType& GetContainer();
 
+    // serializes Insert/Remove and protects iteration of GetContainer()
     static std::shared_mutex* GetLock();
+
+    // frees index nodes replaced by Insert/Remove that no thread inside Find can still reach
+    static void ReclaimRetired();
+
+private:
+    // copy of GetContainer() for lock free lookups
+    static IndexType& GetIndex();
 };
 
 namespace ObjectAccessor
@@ -105,6 +117,9 @@ namespace ObjectAccessor
     void RemoveObject(Player* player);
 
     TC_GAME_API void SaveAllPlayers();
+
+    // frees memory of player lookups that was kept for readers, Insert/Remove also do it on their own
+    TC_GAME_API void ReclaimRetiredPlayerContainers();
 };
 
 #endif
@@ -2033,8 +2033,9 @@ void ObjectMgr::LoadCreatures()
 {
     uint32 oldMSTime = getMSTime();
 
+    // streamed, the table is never held in client memory next to the parsed spawns
     //                                               0              1   2    3           4           5           6            7        8             9              10
-    QueryResult result = WorldDatabase.Query("SELECT creature.guid, id, map, position_x, position_y, position_z, orientation, modelid, equipment_id, spawntimesecs, wander_distance, "
+    QueryResult result = WorldDatabase.StreamQuery("SELECT creature.guid, id, map, position_x, position_y, position_z, orientation, modelid, equipment_id, spawntimesecs, wander_distance, "
     //   11               12         13       14            15         16          17           18                19                    20                    21
         "currentwaypoint, curhealth, curmana, MovementType, spawnMask, eventEntry, poolSpawnId, creature.npcflag, creature.unit_flags, creature.dynamicflags, creature.phaseUseFlags, "
     //   22                23                   24                       25
@@ -2059,14 +2060,11 @@ void ObjectMgr::LoadCreatures()
 
     PhaseShift phaseShift;
 
-    _creatureDataStore.reserve(result->GetRowCount());
-
     do
     {
         Field* fields = result->Fetch();
 
-        ObjectGuid::LowType guid = fields[0].GetUInt32();
-        uint32 entry        = fields[1].GetUInt32();
+        auto [guid, entry, mapId, x, y, z, orientation] = Trinity::GetFields<ObjectGuid::LowType, uint32, uint16, float, float, float, float>(fields);
 
         CreatureTemplate const* cInfo = GetCreatureTemplate(entry);
         if (!cInfo)
@@ -2078,8 +2076,8 @@ void ObjectMgr::LoadCreatures()
         CreatureData& data = _creatureDataStore[guid];
         data.spawnId        = guid;
         data.id             = entry;
-        data.mapId = fields[2].GetUInt16();
-        data.spawnPoint.Relocate(fields[3].GetFloat(), fields[4].GetFloat(), fields[5].GetFloat(), fields[6].GetFloat());
+        data.mapId          = mapId;
+        data.spawnPoint.Relocate(x, y, z, orientation);
         data.displayid      = fields[7].GetUInt32();
         data.equipmentId    = fields[8].GetInt8();
         data.spawntimesecs  = fields[9].GetUInt32();
@@ -2098,7 +2096,7 @@ void ObjectMgr::LoadCreatures()
         data.phaseId        = fields[22].GetUInt32();
         data.phaseGroup     = fields[23].GetUInt32();
         data.terrainSwapMap = fields[24].GetInt32();
-        data.scriptId = GetScriptId(fields[25].GetString());
+        data.scriptId = GetScriptId(fields[25].GetStringView());
         data.spawnGroupData = GetDefaultSpawnGroup();
 
         MapEntry const* mapEntry = sMapStore.LookupEntry(data.mapId);
@@ -2290,7 +2288,7 @@ void ObjectMgr::LoadGameObjects()
     uint32 oldMSTime = getMSTime();
 
     //                                               0                1   2    3           4           5           6
-    QueryResult result = WorldDatabase.Query("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
+    QueryResult result = WorldDatabase.StreamQuery("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
     //   7          8          9          10         11             12            13     14         15          16
         "rotation0, rotation1, rotation2, rotation3, spawntimesecs, animprogress, state, spawnMask, eventEntry, poolSpawnId, "
     //   17             18       19          20              21
@@ -2314,14 +2312,11 @@ void ObjectMgr::LoadGameObjects()
 
     PhaseShift phaseShift;
 
-    _gameObjectDataStore.reserve(result->GetRowCount());
-
     do
     {
         Field* fields = result->Fetch();
 
-        ObjectGuid::LowType guid = fields[0].GetUInt32();
-        uint32 entry        = fields[1].GetUInt32();
+        auto [guid, entry, mapId, x, y, z, orientation] = Trinity::GetFields<ObjectGuid::LowType, uint32, uint16, float, float, float, float>(fields);
 
         GameObjectTemplate const* gInfo = GetGameObjectTemplate(entry);
         if (!gInfo)
@@ -2353,8 +2348,8 @@ void ObjectMgr::LoadGameObjects()
 
         data.spawnId        = guid;
         data.id             = entry;
-        data.mapId          = fields[2].GetUInt16();
-        data.spawnPoint.Relocate(fields[3].GetFloat(), fields[4].GetFloat(), fields[5].GetFloat(), fields[6].GetFloat());
+        data.mapId          = mapId;
+        data.spawnPoint.Relocate(x, y, z, orientation);
         data.rotation.x     = fields[7].GetFloat();
         data.rotation.y     = fields[8].GetFloat();
         data.rotation.z     = fields[9].GetFloat();
@@ -2445,7 +2440,7 @@ void ObjectMgr::LoadGameObjects()
             }
         }
 
-        data.scriptId = GetScriptId(fields[21].GetString());
+        data.scriptId = GetScriptId(fields[21].GetStringView());
 
         if (data.rotation.x < -1.0f || data.rotation.x > 1.0f)
         {
@@ -9318,7 +9313,7 @@ std::string const& ObjectMgr::GetScriptName(uint32 id) const
 }
 
 
-uint32 ObjectMgr::GetScriptId(std::string const& name)
+uint32 ObjectMgr::GetScriptId(std::string_view name)
 {
     // use binary search to find the script name in the sorted vector
     // assume "" is the first element
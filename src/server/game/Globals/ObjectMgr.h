@@ -38,6 +38,7 @@
 #include "VehicleDefines.h"
 #include <iterator>
 #include <map>
+#include <string_view>
 #include <unordered_map>
 
 class Item;
@@ -1536,7 +1537,7 @@ class TC_GAME_API ObjectMgr
         void LoadScriptNames();
         ScriptNameContainer const& GetAllScriptNames() const;
         std::string const& GetScriptName(uint32 id) const;
-        uint32 GetScriptId(std::string const& name);
+        uint32 GetScriptId(std::string_view name);
 
         SpellClickInfoMapBounds GetSpellClickInfoMapBounds(uint32 creature_id) const
         {
@@ -18,6 +18,7 @@
 #ifndef _GRIDREFMANAGER
 #define _GRIDREFMANAGER
 
+#include "GridSpatialArray.h"
 #include "RefManager.h"
 
 template<class OBJECT>
@@ -34,5 +35,12 @@ class GridRefManager : public RefManager<GridRefManager<OBJECT>, OBJECT>
 
         iterator begin() { return iterator(getFirst()); }
         iterator end() { return iterator(nullptr); }
+
+        // only filled for world object containers, see GridObject
+        GridSpatialArray& GetSpatialArray() { return _spatialArray; }
+        GridSpatialArray const& GetSpatialArray() const { return _spatialArray; }
+
+    private:
+        GridSpatialArray _spatialArray;
 };
 #endif
@@ -0,0 +1,78 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridSpatialArray.h"
+#include "Errors.h"
+#include "Object.h"
+#include <cstring>
+
+GridSpatialArray::~GridSpatialArray()
+{
+    // container destroyed with objects still linked (grid unload invalidating references), they must not touch it anymore
+    for (WorldObject* object : _objects)
+        object->_spatialArray = nullptr;
+}
+
+void GridSpatialArray::Add(WorldObject* object)
+{
+    ASSERT(!object->_spatialArray);
+
+    if (_objects.size() == _capacity)
+        Grow();
+
+    uint32 index = GetSize();
+    _objects.push_back(object);
+    SetPosition(index, object->GetPositionX(), object->GetPositionY(), object->GetPositionZ());
+    SetCombatReach(index, object->GetCombatReach());
+
+    object->_spatialArray = this;
+    object->_spatialIndex = index;
+}
+
+void GridSpatialArray::Remove(WorldObject* object)
+{
+    ASSERT(object->_spatialArray == this);
+
+    // move last entry into the freed slot
+    uint32 index = object->_spatialIndex;
+    uint32 last = GetSize() - 1;
+    if (index != last)
+    {
+        WorldObject* moved = _objects[last];
+        _objects[index] = moved;
+        for (uint8 column = 0; column < MAX_COLUMNS; ++column)
+            GetColumn(Column(column))[index] = GetColumn(Column(column))[last];
+
+        moved->_spatialIndex = index;
+    }
+
+    _objects.pop_back();
+    object->_spatialArray = nullptr;
+}
+
+void GridSpatialArray::Grow()
+{
+    uint32 capacity = std::max<uint32>(_capacity * 2, 4);
+    std::unique_ptr<float[]> columns = std::make_unique<float[]>(capacity * MAX_COLUMNS);
+    for (uint8 column = 0; column < MAX_COLUMNS; ++column)
+        if (uint32 size = GetSize())
+            std::memcpy(columns.get() + column * capacity, GetColumn(Column(column)), size * sizeof(float));
+
+    _columns = std::move(columns);
+    _capacity = capacity;
+    _objects.reserve(capacity);
+}
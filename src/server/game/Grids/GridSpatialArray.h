@@ -0,0 +1,124 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_GRIDSPATIALARRAY_H
+#define TRINITY_GRIDSPATIALARRAY_H
+
+#include "Define.h"
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <vector>
+
+class WorldObject;
+
+/// Sphere or circle filled by WorldObject::GetGridSearchArea, mirrors the distance test of WorldObject::_IsWithinDist
+struct GridSpatialSearchArea
+{
+    float X = 0.0f;
+    float Y = 0.0f;
+    float Z = 0.0f;
+    float Range = 0.0f;             // distance to compare
+    float OwnReach = 0.0f;          // combat reach of the searcher, 0 if not included
+    bool Is3D = true;
+    bool IncludeTargetReach = true;
+};
+
+/// Positions and combat reach of all objects linked to one grid cell container, stored column wise
+/// Kept in sync by GridObject::AddToGrid/RemoveFromGrid, WorldObject::Relocate and Unit::SetCombatReach
+class TC_GAME_API GridSpatialArray
+{
+    public:
+        // objects tested before the matches are handed to the visitor
+        static constexpr uint32 CHUNK_SIZE = 64;
+        // added to the compared distance so float rounding never filters an object the full check would accept
+        static constexpr float SEARCH_TOLERANCE = 0.01f;
+
+        GridSpatialArray() : _capacity(0) { }
+        ~GridSpatialArray();
+
+        GridSpatialArray(GridSpatialArray const&) = delete;
+        GridSpatialArray& operator=(GridSpatialArray const&) = delete;
+
+        void Add(WorldObject* object);
+        void Remove(WorldObject* object);
+
+        void SetPosition(uint32 index, float x, float y, float z)
+        {
+            GetColumn(COLUMN_X)[index] = x;
+            GetColumn(COLUMN_Y)[index] = y;
+            GetColumn(COLUMN_Z)[index] = z;
+        }
+
+        void SetCombatReach(uint32 index, float combatReach) { GetColumn(COLUMN_COMBAT_REACH)[index] = combatReach; }
+
+        uint32 GetSize() const { return uint32(_objects.size()); }
+
+        // calls visit for every object possibly inside area, the caller still has to run its exact distance check
+        // visit must not add or remove objects of this container
+        template<class Visitor>
+        void ForEachInRange(GridSpatialSearchArea const& area, Visitor&& visit) const
+        {
+            float const* x = GetColumn(COLUMN_X);
+            float const* y = GetColumn(COLUMN_Y);
+            float const* z = GetColumn(COLUMN_Z);
+            float const* combatReach = GetColumn(COLUMN_COMBAT_REACH);
+            float const zFactor = area.Is3D ? 1.0f : 0.0f;
+            float const reachFactor = area.IncludeTargetReach ? 1.0f : 0.0f;
+            float const range = area.Range + area.OwnReach + SEARCH_TOLERANCE;
+
+            uint32 const size = GetSize();
+            for (uint32 chunk = 0; chunk < size; chunk += CHUNK_SIZE)
+            {
+                uint32 const chunkSize = std::min(CHUNK_SIZE, size - chunk);
+                uint64 matches = 0;
+                for (uint32 i = 0; i < chunkSize; ++i)
+                {
+                    uint32 const index = chunk + i;
+                    float const dx = x[index] - area.X;
+                    float const dy = y[index] - area.Y;
+                    float const dz = (z[index] - area.Z) * zFactor;
+                    float const maxDist = range + combatReach[index] * reachFactor;
+                    matches |= uint64(dx * dx + dy * dy + dz * dz <= maxDist * maxDist) << i;
+                }
+
+                for (; matches; matches &= matches - 1)
+                    visit(_objects[chunk + std::countr_zero(matches)]);
+            }
+        }
+
+    private:
+        enum Column
+        {
+            COLUMN_X,
+            COLUMN_Y,
+            COLUMN_Z,
+            COLUMN_COMBAT_REACH,
+            MAX_COLUMNS
+        };
+
+        float* GetColumn(Column column) { return _columns.get() + column * _capacity; }
+        float const* GetColumn(Column column) const { return _columns.get() + column * _capacity; }
+
+        void Grow();
+
+        std::vector<WorldObject*> _objects;
+        std::unique_ptr<float[]> _columns;  // MAX_COLUMNS columns of _capacity values, allocated on first Add
+        uint32 _capacity;
+};
+
+#endif
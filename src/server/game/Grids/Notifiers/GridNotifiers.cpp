@@ -404,8 +404,14 @@ template<class T>
 void ObjectUpdater::Visit(GridRefManager<T> &m)
 {
     for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        // objects of a cell are scattered on the heap, start loading the next one while this one updates
+        if (GridReference<T>* next = iter->next())
+            TC_PREFETCH(next->GetSource());
+
         if (iter->GetSource()->IsInWorld())
             iter->GetSource()->Update(i_timeDiff);
+    }
 }
 
 bool AnyDeadUnitObjectInRangeCheck::operator()(Player* u)
@@ -28,6 +28,8 @@
 #include "SpellInfo.h"
 #include "UnitAI.h"
 #include "UpdateData.h"
+#include "WorldPacket.h"
+#include <type_traits>
 
 namespace Trinity
 {
@@ -118,6 +120,7 @@ namespace Trinity
     {
         WorldObject const* i_source;
         WorldPacket const* i_message;
+        std::shared_ptr<WorldPacket const> i_sharedMessage; // copy of i_message made for the first receiver, shared by all sockets
         float i_distSq;
         uint32 team;
         Player const* skipped_receiver;
@@ -145,7 +148,10 @@ namespace Trinity
             if (!player->HaveAtClient(i_source))
                 return;
 
-            player->SendDirectMessage(i_message);
+            if (!i_sharedMessage)
+                i_sharedMessage = std::make_shared<WorldPacket const>(*i_message);
+
+            player->SendDirectMessage(i_sharedMessage);
         }
     };
 
@@ -153,6 +159,7 @@ namespace Trinity
     {
         Unit* i_source;
         WorldPacket* i_message;
+        std::shared_ptr<WorldPacket const> i_sharedMessage;
         float i_distSq;
 
         MessageDistDelivererToHostile(Unit* src, WorldPacket* msg, float dist)
@@ -171,7 +178,10 @@ namespace Trinity
             if (player == i_source || !player->HaveAtClient(i_source) || player->IsFriendlyTo(i_source))
                 return;
 
-            player->SendDirectMessage(i_message);
+            if (!i_sharedMessage)
+                i_sharedMessage = std::make_shared<WorldPacket const>(*i_message);
+
+            player->SendDirectMessage(i_sharedMessage);
         }
     };
 
@@ -213,6 +223,31 @@ namespace Trinity
         }
     };
 
+    // Checks with a bool GetSearchArea(GridSpatialSearchArea&) const member accept only objects inside that area,
+    // searchers use it to filter the cell position array instead of walking every object of the cell
+    template<class Check, class = void>
+    struct HasGridSearchArea : std::false_type { };
+
+    template<class Check>
+    struct HasGridSearchArea<Check, std::void_t<decltype(std::declval<Check const&>().GetSearchArea(std::declval<GridSpatialSearchArea&>()))>> : std::true_type { };
+
+    template<class T, class Check, class Visitor>
+    void VisitCandidates(GridRefManager<T>& m, Check const& check, Visitor&& visit)
+    {
+        if constexpr (HasGridSearchArea<Check>::value)
+        {
+            GridSpatialSearchArea area;
+            if (check.GetSearchArea(area))
+            {
+                m.GetSpatialArray().ForEachInRange(area, [&visit](WorldObject* object) { visit(static_cast<T*>(object)); });
+                return;
+            }
+        }
+
+        for (typename GridRefManager<T>::iterator itr = m.begin(); itr != m.end(); ++itr)
+            visit(itr->GetSource());
+    }
+
     template<class Check>
     struct WorldObjectSearcher
     {
@@ -753,6 +788,7 @@ namespace Trinity
                 return false;
             }
             float GetLastRange() const { return i_range; }
+            bool GetSearchArea(GridSpatialSearchArea& area) const { return i_obj.GetGridSearchArea(area, i_range); }
         private:
             WorldObject const& i_obj;
             uint32 i_entry;
@@ -899,6 +935,7 @@ namespace Trinity
                 else
                     return false;
             }
+            bool GetSearchArea(GridSpatialSearchArea& area) const { return i_obj->GetGridSearchArea(area, i_range); }
         private:
             WorldObject const* i_obj;
             Unit const* i_funit;
@@ -1027,6 +1064,7 @@ namespace Trinity
 
                 return false;
             }
+            bool GetSearchArea(GridSpatialSearchArea& area) const { return i_obj->GetGridSearchArea(area, i_range); }
         private:
             WorldObject const* i_obj;
             float i_range;
@@ -1048,6 +1086,7 @@ namespace Trinity
 
                 return false;
             }
+            bool GetSearchArea(GridSpatialSearchArea& area) const { return i_obj->GetGridSearchArea(area, i_range); }
         private:
             WorldObject const* i_obj;
             Unit const* i_funit;
@@ -1307,6 +1346,7 @@ namespace Trinity
                 return true;
             }
             float GetLastRange() const { return i_range; }
+            bool GetSearchArea(GridSpatialSearchArea& area) const { return i_obj->GetGridSearchArea(area, i_range, true, false, false); }
         private:
             Creature* const i_obj;
             Unit* const i_enemy;
@@ -1338,6 +1378,7 @@ namespace Trinity
                 return false;
             }
             float GetLastRange() const { return i_range; }
+            bool GetSearchArea(GridSpatialSearchArea& area) const { return i_obj.GetGridSearchArea(area, i_range); }
         private:
             WorldObject const& i_obj;
             uint32 i_entry;
@@ -1363,6 +1404,8 @@ namespace Trinity
                 return true;
             }
 
+            bool GetSearchArea(GridSpatialSearchArea& area) const { return _obj->GetGridSearchArea(area, _range); }
+
         private:
             WorldObject const* _obj;
             float _range;
@@ -1407,6 +1450,7 @@ namespace Trinity
 
                 return false;
             }
+            bool GetSearchArea(GridSpatialSearchArea& area) const { return i_obj->GetGridSearchArea(area, i_range); }
         private:
             WorldObject const* i_obj;
             float i_range;
@@ -1440,6 +1484,7 @@ namespace Trinity
 
             return false;
         }
+        bool GetSearchArea(GridSpatialSearchArea& area) const { return m_pObject->GetGridSearchArea(area, m_fRange, false); }
     private:
         const WorldObject* m_pObject;
         uint32 m_uiEntry;
@@ -1458,6 +1503,8 @@ namespace Trinity
                 return false;
             }
 
+            bool GetSearchArea(GridSpatialSearchArea& area) const { return m_pObject->GetGridSearchArea(area, m_fRange, false); }
+
         private:
             const WorldObject* m_pObject;
             uint32 m_uiEntry;
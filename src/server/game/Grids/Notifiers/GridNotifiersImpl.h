@@ -185,14 +185,14 @@ void Trinity::WorldObjectLastSearcher<Check>::Visit(GameObjectMapType &m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_GAMEOBJECT))
         return;
 
-    for (GameObjectMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
+    VisitCandidates(m, i_check, [this](GameObject* object)
     {
-        if (!itr->GetSource()->IsInPhase(_searcher))
-            continue;
+        if (!object->IsInPhase(_searcher))
+            return;
 
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (i_check(object))
+            i_object = object;
+    });
 }
 
 template<class Check>
@@ -201,14 +201,14 @@ void Trinity::WorldObjectLastSearcher<Check>::Visit(PlayerMapType &m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_PLAYER))
         return;
 
-    for (PlayerMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
+    VisitCandidates(m, i_check, [this](Player* object)
     {
-        if (!itr->GetSource()->IsInPhase(_searcher))
-            continue;
+        if (!object->IsInPhase(_searcher))
+            return;
 
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (i_check(object))
+            i_object = object;
+    });
 }
 
 template<class Check>
@@ -217,14 +217,14 @@ void Trinity::WorldObjectLastSearcher<Check>::Visit(CreatureMapType &m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CREATURE))
         return;
 
-    for (CreatureMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
+    VisitCandidates(m, i_check, [this](Creature* object)
     {
-        if (!itr->GetSource()->IsInPhase(_searcher))
-            continue;
+        if (!object->IsInPhase(_searcher))
+            return;
 
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (i_check(object))
+            i_object = object;
+    });
 }
 
 template<class Check>
@@ -233,14 +233,14 @@ void Trinity::WorldObjectLastSearcher<Check>::Visit(CorpseMapType &m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CORPSE))
         return;
 
-    for (CorpseMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
+    VisitCandidates(m, i_check, [this](Corpse* object)
     {
-        if (!itr->GetSource()->IsInPhase(_searcher))
-            continue;
+        if (!object->IsInPhase(_searcher))
+            return;
 
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (i_check(object))
+            i_object = object;
+    });
 }
 
 template<class Check>
@@ -249,14 +249,14 @@ void Trinity::WorldObjectLastSearcher<Check>::Visit(DynamicObjectMapType &m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_DYNAMICOBJECT))
         return;
 
-    for (DynamicObjectMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
+    VisitCandidates(m, i_check, [this](DynamicObject* object)
     {
-        if (!itr->GetSource()->IsInPhase(_searcher))
-            continue;
+        if (!object->IsInPhase(_searcher))
+            return;
 
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (i_check(object))
+            i_object = object;
+    });
 }
 
 template<class Check>
@@ -265,14 +265,14 @@ void Trinity::WorldObjectLastSearcher<Check>::Visit(AreaTriggerMapType &m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_AREATRIGGER))
         return;
 
-    for (AreaTriggerMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
+    VisitCandidates(m, i_check, [this](AreaTrigger* object)
     {
-        if (!itr->GetSource()->IsInPhase(_searcher))
-            continue;
+        if (!object->IsInPhase(_searcher))
+            return;
 
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (i_check(object))
+            i_object = object;
+    });
 }
 
 template<class Check>
@@ -281,9 +281,11 @@ void Trinity::WorldObjectListSearcher<Check>::Visit(PlayerMapType &m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_PLAYER))
         return;
 
-    for (PlayerMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-        if (i_check(itr->GetSource()))
-            Insert(itr->GetSource());
+    VisitCandidates(m, i_check, [this](Player* object)
+    {
+        if (i_check(object))
+            Insert(object);
+    });
 }
 
 template<class Check>
@@ -292,9 +294,11 @@ void Trinity::WorldObjectListSearcher<Check>::Visit(CreatureMapType &m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CREATURE))
         return;
 
-    for (CreatureMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-        if (i_check(itr->GetSource()))
-            Insert(itr->GetSource());
+    VisitCandidates(m, i_check, [this](Creature* object)
+    {
+        if (i_check(object))
+            Insert(object);
+    });
 }
 
 template<class Check>
@@ -303,9 +307,11 @@ void Trinity::WorldObjectListSearcher<Check>::Visit(CorpseMapType &m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CORPSE))
         return;
 
-    for (CorpseMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-        if (i_check(itr->GetSource()))
-            Insert(itr->GetSource());
+    VisitCandidates(m, i_check, [this](Corpse* object)
+    {
+        if (i_check(object))
+            Insert(object);
+    });
 }
 
 template<class Check>
@@ -314,9 +320,11 @@ void Trinity::WorldObjectListSearcher<Check>::Visit(GameObjectMapType &m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_GAMEOBJECT))
         return;
 
-    for (GameObjectMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-        if (i_check(itr->GetSource()))
-            Insert(itr->GetSource());
+    VisitCandidates(m, i_check, [this](GameObject* object)
+    {
+        if (i_check(object))
+            Insert(object);
+    });
 }
 
 template<class Check>
@@ -325,9 +333,11 @@ void Trinity::WorldObjectListSearcher<Check>::Visit(DynamicObjectMapType &m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_DYNAMICOBJECT))
         return;
 
-    for (DynamicObjectMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-        if (i_check(itr->GetSource()))
-            Insert(itr->GetSource());
+    VisitCandidates(m, i_check, [this](DynamicObject* object)
+    {
+        if (i_check(object))
+            Insert(object);
+    });
 }
 
 template<class Check>
@@ -336,9 +346,11 @@ void Trinity::WorldObjectListSearcher<Check>::Visit(AreaTriggerMapType &m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_AREATRIGGER))
         return;
 
-    for (AreaTriggerMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-        if (i_check(itr->GetSource()))
-            Insert(itr->GetSource());
+    VisitCandidates(m, i_check, [this](AreaTrigger* object)
+    {
+        if (i_check(object))
+            Insert(object);
+    });
 }
 
 // Gameobject searchers
@@ -366,23 +378,25 @@ void Trinity::GameObjectSearcher<Check>::Visit(GameObjectMapType &m)
 template<class Check>
 void Trinity::GameObjectLastSearcher<Check>::Visit(GameObjectMapType &m)
 {
-    for (GameObjectMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
+    VisitCandidates(m, i_check, [this](GameObject* object)
     {
-        if (!itr->GetSource()->IsInPhase(_searcher))
-            continue;
+        if (!object->IsInPhase(_searcher))
+            return;
 
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (i_check(object))
+            i_object = object;
+    });
 }
 
 template<class Check>
 void Trinity::GameObjectListSearcher<Check>::Visit(GameObjectMapType &m)
 {
-    for (GameObjectMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-        if (itr->GetSource()->IsInPhase(_searcher))
-            if (i_check(itr->GetSource()))
-                Insert(itr->GetSource());
+    VisitCandidates(m, i_check, [this](GameObject* object)
+    {
+        if (object->IsInPhase(_searcher))
+            if (i_check(object))
+                Insert(object);
+    });
 }
 
 // Unit searchers
@@ -430,45 +444,49 @@ void Trinity::UnitSearcher<Check>::Visit(PlayerMapType &m)
 template<class Check>
 void Trinity::UnitLastSearcher<Check>::Visit(CreatureMapType &m)
 {
-    for (CreatureMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
+    VisitCandidates(m, i_check, [this](Creature* object)
     {
-        if (!itr->GetSource()->IsInPhase(_searcher))
-            continue;
+        if (!object->IsInPhase(_searcher))
+            return;
 
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (i_check(object))
+            i_object = object;
+    });
 }
 
 template<class Check>
 void Trinity::UnitLastSearcher<Check>::Visit(PlayerMapType &m)
 {
-    for (PlayerMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
+    VisitCandidates(m, i_check, [this](Player* object)
     {
-        if (!itr->GetSource()->IsInPhase(_searcher))
-            continue;
+        if (!object->IsInPhase(_searcher))
+            return;
 
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (i_check(object))
+            i_object = object;
+    });
 }
 
 template<class Check>
 void Trinity::UnitListSearcher<Check>::Visit(PlayerMapType &m)
 {
-    for (PlayerMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-        if (itr->GetSource()->IsInPhase(_searcher))
-            if (i_check(itr->GetSource()))
-                Insert(itr->GetSource());
+    VisitCandidates(m, i_check, [this](Player* object)
+    {
+        if (object->IsInPhase(_searcher))
+            if (i_check(object))
+                Insert(object);
+    });
 }
 
 template<class Check>
 void Trinity::UnitListSearcher<Check>::Visit(CreatureMapType &m)
 {
-    for (CreatureMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-        if (itr->GetSource()->IsInPhase(_searcher))
-            if (i_check(itr->GetSource()))
-                Insert(itr->GetSource());
+    VisitCandidates(m, i_check, [this](Creature* object)
+    {
+        if (object->IsInPhase(_searcher))
+            if (i_check(object))
+                Insert(object);
+    });
 }
 
 // Creature searchers
@@ -496,32 +514,36 @@ void Trinity::CreatureSearcher<Check>::Visit(CreatureMapType &m)
 template<class Check>
 void Trinity::CreatureLastSearcher<Check>::Visit(CreatureMapType &m)
 {
-    for (CreatureMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
+    VisitCandidates(m, i_check, [this](Creature* object)
     {
-        if (!itr->GetSource()->IsInPhase(_searcher))
-            continue;
+        if (!object->IsInPhase(_searcher))
+            return;
 
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (i_check(object))
+            i_object = object;
+    });
 }
 
 template<class Check>
 void Trinity::CreatureListSearcher<Check>::Visit(CreatureMapType &m)
 {
-    for (CreatureMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-        if (itr->GetSource()->IsInPhase(_searcher))
-            if (i_check(itr->GetSource()))
-                Insert(itr->GetSource());
+    VisitCandidates(m, i_check, [this](Creature* object)
+    {
+        if (object->IsInPhase(_searcher))
+            if (i_check(object))
+                Insert(object);
+    });
 }
 
 template<class Check>
 void Trinity::PlayerListSearcher<Check>::Visit(PlayerMapType &m)
 {
-    for (PlayerMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-        if (itr->GetSource()->IsInPhase(_searcher))
-            if (i_check(itr->GetSource()))
-                Insert(itr->GetSource());
+    VisitCandidates(m, i_check, [this](Player* object)
+    {
+        if (object->IsInPhase(_searcher))
+            if (i_check(object))
+                Insert(object);
+    });
 }
 
 template<class Check>
@@ -547,14 +569,14 @@ void Trinity::PlayerSearcher<Check>::Visit(PlayerMapType &m)
 template<class Check>
 void Trinity::PlayerLastSearcher<Check>::Visit(PlayerMapType& m)
 {
-    for (PlayerMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+    VisitCandidates(m, i_check, [this](Player* object)
     {
-        if (!itr->GetSource()->IsInPhase(_searcher))
-            continue;
+        if (!object->IsInPhase(_searcher))
+            return;
 
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (i_check(object))
+            i_object = object;
+    });
 }
 
 template<class Builder>
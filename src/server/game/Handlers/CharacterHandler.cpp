@@ -273,7 +273,7 @@ void WorldSession::HandleCharEnum(PreparedQueryResult result)
                     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ADD_AT_LOGIN_FLAG);
                     stmt->setUInt16(0, uint16(AT_LOGIN_CUSTOMIZE));
                     stmt->setUInt32(1, charInfo.Guid.GetCounter());
-                    CharacterDatabase.Execute(stmt);
+                    CharacterDatabase.Execute(stmt, DB_QUEUE_PRIORITY_NORMAL, GetAccountId());
                     charInfo.Flags2 = CHAR_CUSTOMIZE_FLAG_CUSTOMIZE;
                 }
             }
@@ -295,7 +295,7 @@ void WorldSession::HandleCharEnumOpcode(WorldPackets::Character::EnumCharacters&
 {
     // remove expired bans
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EXPIRED_BANS);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, DB_QUEUE_PRIORITY_NORMAL, GetAccountId());
 
     /// get all the data necessary for loading all characters (along with their pets) on the account
 
@@ -306,7 +306,8 @@ void WorldSession::HandleCharEnumOpcode(WorldPackets::Character::EnumCharacters&
 
     stmt->setUInt32(0, GetAccountId());
 
-    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSession::HandleCharEnum, this, std::placeholders::_1)));
+    // the account fence keeps the list behind character deletes, logout saves and the ban cleanup above
+    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt, DB_QUEUE_PRIORITY_INTERACTIVE, GetAccountId()).WithPreparedCallback(std::bind(&WorldSession::HandleCharEnum, this, std::placeholders::_1)));
 }
 
 void WorldSession::HandleCharCreateOpcode(WorldPacket& recvData)
@@ -636,7 +637,7 @@ void WorldSession::HandleCharCreateOpcode(WorldPacket& recvData)
 
             LoginDatabase.CommitTransaction(trans);
 
-            AddTransactionCallback(CharacterDatabase.AsyncCommitTransaction(characterTransaction)).AfterComplete([this, newChar = std::move(newChar)](bool success)
+            AddTransactionCallback(CharacterDatabase.AsyncCommitTransaction(characterTransaction, DB_QUEUE_PRIORITY_NORMAL, GetAccountId())).AfterComplete([this, newChar = std::move(newChar)](bool success)
             {
                 if (success)
                 {
@@ -1275,14 +1276,14 @@ void WorldSession::HandleCharRenameCallback(std::shared_ptr<CharacterRenameInfo>
     stmt->setUInt16(1, atLoginFlags);
     stmt->setUInt32(2, guidLow);
 
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, DB_QUEUE_PRIORITY_NORMAL, GetAccountId());
 
     // Removed declined name from db
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_DECLINED_NAME);
 
     stmt->setUInt32(0, guidLow);
 
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, DB_QUEUE_PRIORITY_NORMAL, GetAccountId());
 
     TC_LOG_INFO("entities.player.character", "Account: %d (IP: %s) Character:[%s] (%s) Changed name to: %s", GetAccountId(), GetRemoteAddress().c_str(), oldName.c_str(), renameInfo->Guid.ToString().c_str(), renameInfo->Name.c_str());
 
@@ -1362,7 +1363,7 @@ void WorldSession::HandleSetPlayerDeclinedNames(WorldPacket& recvData)
 
     trans->Append(stmt);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, DB_QUEUE_PRIORITY_NORMAL, GetAccountId());
 
     SendSetPlayerDeclinedNamesResult(DECLINED_NAMES_RESULT_SUCCESS, guid);
 }
@@ -1579,7 +1580,7 @@ void WorldSession::HandleCharCustomizeCallback(std::shared_ptr<CharacterCustomiz
         trans->Append(stmt);
     }
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, DB_QUEUE_PRIORITY_NORMAL, GetAccountId());
 
     sCharacterCache->UpdateCharacterData(customizeInfo->Guid, customizeInfo->Name, &customizeInfo->Gender);
 
@@ -2236,7 +2237,7 @@ void WorldSession::HandleCharFactionOrRaceChangeCallback(std::shared_ptr<Charact
         }
     }
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, DB_QUEUE_PRIORITY_NORMAL, GetAccountId());
 
     TC_LOG_DEBUG("entities.player", "%s (IP: %s) changed race from %u to %u", GetPlayerInfo().c_str(), GetRemoteAddress().c_str(), oldRace, factionChangeInfo->Race);
 
@@ -2382,5 +2383,5 @@ void WorldSession::HandleReorderCharacters(WorldPacket& recvData)
         trans->Append(stmt);
     }
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, DB_QUEUE_PRIORITY_NORMAL, GetAccountId());
 }
@@ -0,0 +1,57 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_CELL_SWEEP_H
+#define TRINITY_CELL_SWEEP_H
+
+#include "Define.h"
+#include <vector>
+
+namespace Trinity
+{
+/**
+ * Visits cells of a map in the given order, same as Map::Visit with a NoCreate cell for each of them.
+ * Cell ids are y * CellsPerMap + x. getLoadedGrid(gridX, gridY) returns the grid or nullptr if its objects are not loaded,
+ * getCell(grid, cellX, cellY) returns a cell of it and visitCell is called with every cell of a loaded grid.
+ * The cell visited next is prefetched while the current one is visited.
+ */
+template<uint32 CellsPerGrid, uint32 CellsPerMap, class GetLoadedGrid, class GetCell, class VisitCell>
+void SweepCells(std::vector<uint32> const& cells, GetLoadedGrid&& getLoadedGrid, GetCell&& getCell, VisitCell&& visitCell)
+{
+    for (std::size_t i = 0; i < cells.size(); ++i)
+    {
+        uint32 cellX = cells[i] % CellsPerMap;
+        uint32 cellY = cells[i] / CellsPerMap;
+        auto grid = getLoadedGrid(cellX / CellsPerGrid, cellY / CellsPerGrid);
+
+        if (i + 1 < cells.size())
+        {
+            uint32 nextCellX = cells[i + 1] % CellsPerMap;
+            uint32 nextCellY = cells[i + 1] / CellsPerMap;
+            if (auto nextGrid = getLoadedGrid(nextCellX / CellsPerGrid, nextCellY / CellsPerGrid))
+                TC_PREFETCH(&getCell(*nextGrid, nextCellX % CellsPerGrid, nextCellY % CellsPerGrid));
+        }
+
+        if (!grid)
+            continue;
+
+        visitCell(getCell(*grid, cellX % CellsPerGrid, cellY % CellsPerGrid));
+    }
+}
+}
+
+#endif // TRINITY_CELL_SWEEP_H
@@ -19,6 +19,7 @@
 #include "BattlefieldMgr.h"
 #include "Battleground.h"
 #include "CellImpl.h"
+#include "CellSweep.h"
 #include "Containers.h"
 #include "DatabaseEnv.h"
 #include "DBCStores.h"
@@ -55,6 +56,7 @@
 #include "WorldStateMgr.h"
 #include "WorldStatePackets.h"
 #include <boost/heap/fibonacci_heap.hpp>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -133,7 +135,7 @@ void Map::DeleteStateMachine()
 }
 
 Map::Map(uint32 id, time_t expiry, uint32 InstanceId, uint8 SpawnMode) :
-_creatureToMoveLock(false), _gameObjectsToMoveLock(false), _dynamicObjectsToMoveLock(false),
+_creatureToMoveLock(false), _gameObjectsToMoveLock(false), _dynamicObjectsToMoveLock(false), _skippedCellVisits(0), _regionUpdateInProgress(false),
 i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
 m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
 m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
@@ -351,12 +353,15 @@ void Map::DeleteFromWorld(Player* player)
 //But object data is not loaded here
 void Map::EnsureGridCreated(GridCoord const& p)
 {
+    if (getNGrid(p.x_coord, p.y_coord))
+        return;
+
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
     if (!getNGrid(p.x_coord, p.y_coord))
     {
         TC_LOG_DEBUG("maps", "Creating grid[%u, %u] for map %u instance %u", p.x_coord, p.y_coord, GetId(), i_InstanceId);
 
         NGridType* ngrid = new NGridType(p.x_coord * MAX_NUMBER_OF_GRIDS + p.y_coord, p.x_coord, p.y_coord, i_gridExpiry, sWorld->getBoolConfig(CONFIG_GRID_UNLOAD));
-        setNGrid(ngrid, p.x_coord, p.y_coord);
 
         // build a linkage between this map and NGridType
         buildNGridLinkage(ngrid);
@@ -368,6 +373,8 @@ void Map::EnsureGridCreated(GridCoord const& p)
         int gy = (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord;
 
         m_terrain->LoadMapAndVMap(gx, gy);
+
+        setNGrid(ngrid, p.x_coord, p.y_coord);
     }
 }
 
@@ -390,6 +397,8 @@ void Map::EnsureGridLoadedForActiveObject(const Cell &cell, WorldObject* object)
 //Create NGrid and load the object data in it
 bool Map::EnsureGridLoaded(const Cell &cell)
 {
+    // loading fills cells of the whole grid, some of them may belong to other regions
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
     EnsureGridCreated(GridCoord(cell.GridX(), cell.GridY()));
     NGridType *grid = getNGrid(cell.GridX(), cell.GridY());
 
@@ -488,6 +497,8 @@ void Map::InitializeObject(GameObject* obj)
 template<class T>
 bool Map::AddToMap(T* obj)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
+
     /// @todo Needs clean up. An object should not be added to map twice.
     if (obj->IsInWorld())
     {
@@ -575,7 +586,7 @@ bool Map::IsGridLoaded(const GridCoord &p) const
     return (getNGrid(p.x_coord, p.y_coord) && isGridObjectDataLoaded(p.x_coord, p.y_coord));
 }
 
-void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> &worldVisitor)
+void Map::MarkNearbyCellsOf(WorldObject* obj, std::vector<uint32>* touchedCells /*= nullptr*/)
 {
     // Check for valid position
     if (!obj->IsPositionValid())
@@ -588,22 +599,61 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::Obj
     {
         for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
         {
-            // marked cells are those that have been visited
+            // marked cells are those that have been collected
             // don't visit the same cell twice
             uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
+            if (touchedCells)
+                touchedCells->push_back(cell_id);
+
             if (isCellMarked(cell_id))
+            {
+                ++_skippedCellVisits;
                 continue;
+            }
 
             markCell(cell_id);
-            CellCoord pair(x, y);
-            Cell cell(pair);
-            cell.SetNoCreate();
-            Visit(cell, gridVisitor);
-            Visit(cell, worldVisitor);
+            _activeCells.push_back(cell_id);
         }
     }
 }
 
+void Map::MarkActiveCellsOf(Player* player, std::vector<uint32>* touchedCells /*= nullptr*/)
+{
+    MarkNearbyCellsOf(player, touchedCells);
+
+    // If player is using far sight or mind vision, visit that object too
+    if (WorldObject* viewPoint = player->GetViewpoint())
+        MarkNearbyCellsOf(viewPoint, touchedCells);
+
+    // Handle updates for creatures in combat with player and are more than 60 yards away
+    if (player->IsInCombat())
+        for (auto const& pair : player->GetCombatManager().GetPvECombatRefs())
+            if (Creature* unit = pair.second->GetOther(player)->ToCreature())
+                if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
+                    MarkNearbyCellsOf(unit, touchedCells);
+
+    // Update any creatures that own auras the player has applications of
+    for (std::pair<uint32, AuraApplication*> pair : player->GetAppliedAuras())
+        if (Unit* caster = pair.second->GetBase()->GetCaster())
+            if (caster->GetTypeId() != TYPEID_PLAYER && !caster->IsWithinDistInMap(player, GetVisibilityRange(), false))
+                MarkNearbyCellsOf(caster, touchedCells);
+}
+
+void Map::MarkActiveCellsOfActiveObjects()
+{
+    // non-player active objects, increasing iterator in the loop in case of object removal
+    for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
+    {
+        WorldObject* obj = *m_activeNonPlayersIter;
+        ++m_activeNonPlayersIter;
+
+        if (!obj || !obj->IsInWorld())
+            continue;
+
+        MarkNearbyCellsOf(obj);
+    }
+}
+
 void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 {
     // Nothing to do if no change
@@ -621,23 +671,29 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 
 void Map::Update(uint32 t_diff)
 {
+    _tickProfiler.BeginTick();
+
     _dynamicTree.update(t_diff);
     /// update worldsessions for existing players
-    for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
-        Player* player = m_mapRefIter->GetSource();
-        if (player && player->IsInWorld())
+        TickProfilerScope profile(_tickProfiler, TICK_PHASE_MAP_SESSIONS);
+        for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
         {
-            //player->Update(t_diff);
-            WorldSession* session = player->GetSession();
-            MapSessionFilter updater(session);
-            session->Update(t_diff, updater);
+            Player* player = m_mapRefIter->GetSource();
+            if (player && player->IsInWorld())
+            {
+                //player->Update(t_diff);
+                WorldSession* session = player->GetSession();
+                MapSessionFilter updater(session);
+                session->Update(t_diff, updater);
+            }
         }
     }
 
     /// process any due respawns
     if (_respawnCheckTimer <= t_diff)
     {
+        TickProfilerScope profile(_tickProfiler, TICK_PHASE_MAP_RESPAWNS);
         ProcessRespawns();
         UpdateSpawnGroupConditions();
         _respawnCheckTimer = sWorld->getIntConfig(CONFIG_RESPAWN_MINCHECKINTERVALMS);
@@ -646,14 +702,99 @@ void Map::Update(uint32 t_diff)
         _respawnCheckTimer -= t_diff;
 
     /// update active cells around players and active objects
-    resetMarkedCells();
+    {
+        TickProfilerScope profile(_tickProfiler, TICK_PHASE_MAP_OBJECTS);
+        resetMarkedCells();
+        _activeCells.clear();
+        _skippedCellVisits = 0;
 
-    Trinity::ObjectUpdater updater(t_diff);
-    // for creature
-    TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
-    // for pets
-    TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+        if (CanUpdateRegionsInParallel())
+            UpdateRegions(t_diff);
+        else
+            UpdateActiveCells(t_diff);
+    }
+
+    {
+        TickProfilerScope profile(_tickProfiler, TICK_PHASE_MAP_TRANSPORTS);
+        for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();)
+        {
+            WorldObject* obj = *_transportsUpdateIter;
+            ++_transportsUpdateIter;
+
+            obj->Update(t_diff);
+        }
+    }
+
+    {
+        TickProfilerScope profile(_tickProfiler, TICK_PHASE_MAP_SEND_OBJECT_UPDATES);
+        SendObjectUpdates();
+    }
 
+    ///- Process necessary scripts
+    if (!m_scriptSchedule.empty())
+    {
+        TickProfilerScope profile(_tickProfiler, TICK_PHASE_MAP_SCRIPT_QUEUE);
+        i_scriptLock = true;
+        ScriptsProcess();
+        i_scriptLock = false;
+    }
+
+    _weatherUpdateTimer.Update(t_diff);
+    if (_weatherUpdateTimer.Passed())
+    {
+        TickProfilerScope profile(_tickProfiler, TICK_PHASE_MAP_WEATHER);
+        for (auto&& zoneInfo : _zoneDynamicInfo)
+            if (zoneInfo.second.DefaultWeather && !zoneInfo.second.DefaultWeather->Update(_weatherUpdateTimer.GetInterval()))
+                zoneInfo.second.DefaultWeather.reset();
+
+        _weatherUpdateTimer.Reset();
+    }
+
+    {
+        TickProfilerScope profile(_tickProfiler, TICK_PHASE_MAP_MOVE_LISTS);
+        MoveAllCreaturesInMoveList();
+        MoveAllGameObjectsInMoveList();
+    }
+
+    if (!m_mapRefManager.isEmpty() || !m_activeNonPlayers.empty())
+    {
+        TickProfilerScope profile(_tickProfiler, TICK_PHASE_MAP_RELOCATION_NOTIFIES);
+        ProcessRelocationNotifies(t_diff);
+    }
+
+    {
+        TickProfilerScope profile(_tickProfiler, TICK_PHASE_MAP_SCRIPTS);
+        sScriptMgr->OnMapUpdate(this, t_diff);
+    }
+
+    _tickProfiler.EndTick();
+}
+
+#ifdef TRINITY_DEBUG
+namespace
+{
+    // records the objects Trinity::ObjectUpdater would update, without updating them
+    struct UpdatedObjectsRecorder
+    {
+        explicit UpdatedObjectsRecorder(std::vector<WorldObject*>& objects) : Objects(objects) { }
+
+        template<class T> void Visit(GridRefManager<T>& m)
+        {
+            for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
+                if (iter->GetSource()->IsInWorld())
+                    Objects.push_back(iter->GetSource());
+        }
+
+        void Visit(PlayerMapType&) { }
+        void Visit(CorpseMapType&) { }
+
+        std::vector<WorldObject*>& Objects;
+    };
+}
+#endif
+
+void Map::UpdateActiveCells(uint32 diff)
+{
     // the player iterator is stored in the map object
     // to make sure calls to Map::Remove don't invalidate it
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
@@ -664,98 +805,224 @@ void Map::Update(uint32 t_diff)
             continue;
 
         // update players at tick
-        player->Update(t_diff);
+        player->Update(diff);
+
+        MarkActiveCellsOf(player);
+    }
 
-        VisitNearbyCellsOf(player, grid_object_update, world_object_update);
+    MarkActiveCellsOfActiveObjects();
 
-        // If player is using far sight or mind vision, visit that object too
-        if (WorldObject* viewPoint = player->GetViewpoint())
-            VisitNearbyCellsOf(viewPoint, grid_object_update, world_object_update);
+    Trinity::ObjectUpdater updater(diff);
+    // for creature
+    TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
+    // for pets
+    TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+
+#ifdef TRINITY_DEBUG
+    // the sweep must update exactly the same objects in the same order as visiting every cell through Map::Visit
+    {
+        std::vector<WorldObject*> expected, swept;
+        UpdatedObjectsRecorder expectedRecorder(expected), sweptRecorder(swept);
+        TypeContainerVisitor<UpdatedObjectsRecorder, GridTypeMapContainer> expectedGridVisitor(expectedRecorder), sweptGridVisitor(sweptRecorder);
+        TypeContainerVisitor<UpdatedObjectsRecorder, WorldTypeMapContainer> expectedWorldVisitor(expectedRecorder), sweptWorldVisitor(sweptRecorder);
 
-        // Handle updates for creatures in combat with player and are more than 60 yards away
-        if (player->IsInCombat())
+        for (uint32 cellId : _activeCells)
         {
-            std::vector<Unit*> toVisit;
-            for (auto const& pair : player->GetCombatManager().GetPvECombatRefs())
-                if (Creature* unit = pair.second->GetOther(player)->ToCreature())
-                    if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
-                        toVisit.push_back(unit);
-            for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
+            CellCoord pair(cellId % TOTAL_NUMBER_OF_CELLS_PER_MAP, cellId / TOTAL_NUMBER_OF_CELLS_PER_MAP);
+            Cell cell(pair);
+            cell.SetNoCreate();
+            Visit(cell, expectedGridVisitor);
+            Visit(cell, expectedWorldVisitor);
         }
 
-        { // Update any creatures that own auras the player has applications of
-            std::unordered_set<Unit*> toVisit;
-            for (std::pair<uint32, AuraApplication*> pair : player->GetAppliedAuras())
-            {
-                if (Unit* caster = pair.second->GetBase()->GetCaster())
-                    if (caster->GetTypeId() != TYPEID_PLAYER && !caster->IsWithinDistInMap(player, GetVisibilityRange(), false))
-                        toVisit.insert(caster);
-            }
-            for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
-        }
+        SweepCells(_activeCells, sweptGridVisitor, sweptWorldVisitor);
 
-        { // Update any creatures that own auras the player has applications of
-            std::unordered_set<Unit*> toVisit;
-            for (std::pair<uint32, AuraApplication*> pair : player->GetAppliedAuras())
-            {
-                if (Unit* caster = pair.second->GetBase()->GetCaster())
-                    if (caster->GetTypeId() != TYPEID_PLAYER && !caster->IsWithinDistInMap(player, GetVisibilityRange(), false))
-                        toVisit.insert(caster);
-            }
-            for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
-        }
+        ASSERT(expected == swept, "Map %u instance %u: cell sweep visited " SZFMTD " objects, Map::Visit " SZFMTD, GetId(), GetInstanceId(), swept.size(), expected.size());
     }
+#endif
 
-    // non-player active objects, increasing iterator in the loop in case of object removal
-    for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
+    // every cell collected this tick is visited exactly once
+    SweepCells(_activeCells, grid_object_update, world_object_update);
+}
+
+template<class T>
+void Map::SweepCells(std::vector<uint32> const& cells, TypeContainerVisitor<T, GridTypeMapContainer>& gridVisitor, TypeContainerVisitor<T, WorldTypeMapContainer>& worldVisitor)
+{
+    // same as Map::Visit with a NoCreate cell, minus the repeated grid lookups
+    Trinity::SweepCells<MAX_NUMBER_OF_CELLS, TOTAL_NUMBER_OF_CELLS_PER_MAP>(cells,
+        [this](uint32 gridX, uint32 gridY) -> NGridType*
+        {
+            NGridType* grid = getNGrid(gridX, gridY);
+            if (!grid)
+                return nullptr;
+
+            // waits for a grid another region is loading
+            std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
+            return grid->isGridObjectDataLoaded() ? grid : nullptr;
+        },
+        [](NGridType& grid, uint32 cellX, uint32 cellY) -> GridType& { return grid.GetGridType(cellX, cellY); },
+        [&](GridType& cellObjects)
+        {
+            cellObjects.Visit(gridVisitor);
+            cellObjects.Visit(worldVisitor);
+        });
+}
+
+bool Map::CanUpdateRegionsInParallel() const
+{
+    if (!sWorld->getBoolConfig(CONFIG_MAP_UPDATE_REGIONS))
+        return false;
+
+    // regions are handed to map update workers, with a single worker there is nothing to gain
+    if (!sMapMgr->GetMapUpdater()->activated() || sWorld->getIntConfig(CONFIG_NUMTHREADS) < 2)
+        return false;
+
+    // instance and battleground scripts hold state shared by every region
+    if (Instanceable())
+        return false;
+
+    return m_mapRefManager.getSize() >= sWorld->getIntConfig(CONFIG_MAP_UPDATE_REGIONS_MIN_PLAYERS);
+}
+
+namespace
+{
+    // region currently updated by this thread, used to keep cell moves requested by parallel updates apart
+    thread_local MapUpdateRegion* CurrentUpdateRegion = nullptr;
+}
+
+void Map::UpdateRegions(uint32 diff)
+{
+    // every cell a player made active, the player links all of them through combat, threat and auras
+    std::vector<std::vector<uint32>> playerCells;
+
+    // sessions (updated before this by Map::Update) and players reach into groups, guilds, scripts and other
+    // global state, they stay serial and are updated in the same order as UpdateActiveCells
+    // only the cell sweep of creatures and objects is split into regions
+    for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
-        WorldObject* obj = *m_activeNonPlayersIter;
-        ++m_activeNonPlayersIter;
+        Player* player = m_mapRefIter->GetSource();
 
-        if (!obj || !obj->IsInWorld())
+        if (!player || !player->IsInWorld())
             continue;
 
-        VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
+        // update players at tick
+        player->Update(diff);
+
+        MarkActiveCellsOf(player, &playerCells.emplace_back());
     }
 
-    for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();)
+    MarkActiveCellsOfActiveObjects();
+
+    BuildUpdateRegions(playerCells, _activeCells);
+
+    if (_updateRegions.size() < 2)
     {
-        WorldObject* obj = *_transportsUpdateIter;
-        ++_transportsUpdateIter;
+        for (MapUpdateRegion& region : _updateRegions)
+            UpdateRegion(region, diff);
+    }
+    else
+    {
+        _regionUpdateInProgress = true;
+        sMapMgr->GetMapUpdater()->run_parallel(_updateRegions.size(), [this, diff](std::size_t index)
+        {
+            MapUpdateRegion& region = _updateRegions[index];
+            CurrentUpdateRegion = &region;
+            UpdateRegion(region, diff);
+            CurrentUpdateRegion = nullptr;
+        });
+        _regionUpdateInProgress = false;
+
+        // merge cross region effects in region order so the result does not depend on thread scheduling
+        for (MapUpdateRegion& region : _updateRegions)
+        {
+            for (Creature* creature : region.CreaturesToMove)
+                _creaturesToMove.push_back(creature);
+            for (GameObject* go : region.GameObjectsToMove)
+                _gameObjectsToMove.push_back(go);
+            for (DynamicObject* dynObj : region.DynamicObjectsToMove)
+                _dynamicObjectsToMove.push_back(dynObj);
+        }
 
-        obj->Update(t_diff);
+        // scripts started without delay during the parallel update were only queued, they reach into other regions
+        if (!m_scriptSchedule.empty())
+        {
+            i_scriptLock = true;
+            ScriptsProcess();
+            i_scriptLock = false;
+        }
     }
 
-    SendObjectUpdates();
+    _updateRegions.clear();
+}
 
-    ///- Process necessary scripts
-    if (!m_scriptSchedule.empty())
+void Map::BuildUpdateRegions(std::vector<std::vector<uint32>> const& playerCells, std::vector<uint32> const& cells)
+{
+    // union-find over the grids containing marked cells
+    std::unordered_map<uint32 /*gridId*/, uint32 /*parent gridId*/> parents;
+    auto findRoot = [&parents](uint32 gridId)
     {
-        i_scriptLock = true;
-        ScriptsProcess();
-        i_scriptLock = false;
-    }
+        uint32 root = gridId;
+        while (parents[root] != root)
+            root = parents[root];
 
-    _weatherUpdateTimer.Update(t_diff);
-    if (_weatherUpdateTimer.Passed())
+        while (parents[gridId] != root)
+            gridId = std::exchange(parents[gridId], root);
+
+        return root;
+    };
+
+    auto getGridId = [](uint32 cellId)
     {
-        for (auto&& zoneInfo : _zoneDynamicInfo)
-            if (zoneInfo.second.DefaultWeather && !zoneInfo.second.DefaultWeather->Update(_weatherUpdateTimer.GetInterval()))
-                zoneInfo.second.DefaultWeather.reset();
+        uint32 gridX = (cellId % TOTAL_NUMBER_OF_CELLS_PER_MAP) / MAX_NUMBER_OF_CELLS;
+        uint32 gridY = (cellId / TOTAL_NUMBER_OF_CELLS_PER_MAP) / MAX_NUMBER_OF_CELLS;
+        return gridY * MAX_NUMBER_OF_GRIDS + gridX;
+    };
 
-        _weatherUpdateTimer.Reset();
+    std::vector<uint32> grids;
+    for (uint32 cellId : cells)
+        if (parents.emplace(getGridId(cellId), getGridId(cellId)).second)
+            grids.push_back(getGridId(cellId));
+
+    // everything marked for the same player is updated by one region, even far combat partners and aura casters
+    for (std::vector<uint32> const& touchedCells : playerCells)
+        for (std::size_t i = 1; i < touchedCells.size(); ++i)
+            parents[findRoot(getGridId(touchedCells[i]))] = findRoot(getGridId(touchedCells[0]));
+
+    for (std::size_t i = 0; i < grids.size(); ++i)
+    {
+        for (std::size_t j = i + 1; j < grids.size(); ++j)
+        {
+            int32 dx = int32(grids[i] % MAX_NUMBER_OF_GRIDS) - int32(grids[j] % MAX_NUMBER_OF_GRIDS);
+            int32 dy = int32(grids[i] / MAX_NUMBER_OF_GRIDS) - int32(grids[j] / MAX_NUMBER_OF_GRIDS);
+            if (std::abs(dx) <= MAP_UPDATE_REGION_GRID_MARGIN && std::abs(dy) <= MAP_UPDATE_REGION_GRID_MARGIN)
+                parents[findRoot(grids[i])] = findRoot(grids[j]);
+        }
     }
 
-    MoveAllCreaturesInMoveList();
-    MoveAllGameObjectsInMoveList();
+    // number regions in order of first appearance so the layout is stable between ticks
+    std::unordered_map<uint32 /*root gridId*/, std::size_t> regionIndexes;
+    auto getRegion = [&](uint32 gridId) -> MapUpdateRegion&
+    {
+        auto itr = regionIndexes.emplace(findRoot(gridId), _updateRegions.size());
+        if (itr.second)
+            _updateRegions.emplace_back();
 
-    if (!m_mapRefManager.isEmpty() || !m_activeNonPlayers.empty())
-        ProcessRelocationNotifies(t_diff);
+        return _updateRegions[itr.first->second];
+    };
 
-    sScriptMgr->OnMapUpdate(this, t_diff);
+    for (uint32 cellId : cells)
+        getRegion(getGridId(cellId)).Cells.push_back(cellId);
+}
+
+void Map::UpdateRegion(MapUpdateRegion& region, uint32 diff)
+{
+    Trinity::ObjectUpdater updater(diff);
+    // for creature
+    TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
+    // for pets
+    TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+
+    SweepCells(region.Cells, grid_object_update, world_object_update);
 }
 
 struct ResetNotifier
@@ -874,6 +1141,8 @@ void Map::RemovePlayerFromMap(Player* player, bool remove)
 template<class T>
 void Map::RemoveFromMap(T *obj, bool remove)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
+
     bool const inWorld = obj->IsInWorld() && obj->GetTypeId() >= TYPEID_UNIT && obj->GetTypeId() <= TYPEID_GAMEOBJECT;
     obj->RemoveFromWorld();
 
@@ -1070,7 +1339,12 @@ void Map::AddCreatureToMoveList(Creature* c, float x, float y, float z, float an
         return;
 
     if (c->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _creaturesToMove.push_back(c);
+    {
+        if (CurrentUpdateRegion && _regionUpdateInProgress)
+            CurrentUpdateRegion->CreaturesToMove.push_back(c);
+        else
+            _creaturesToMove.push_back(c);
+    }
     c->SetNewCellPosition(x, y, z, ang);
 }
 
@@ -1089,7 +1363,12 @@ void Map::AddGameObjectToMoveList(GameObject* go, float x, float y, float z, flo
         return;
 
     if (go->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _gameObjectsToMove.push_back(go);
+    {
+        if (CurrentUpdateRegion && _regionUpdateInProgress)
+            CurrentUpdateRegion->GameObjectsToMove.push_back(go);
+        else
+            _gameObjectsToMove.push_back(go);
+    }
     go->SetNewCellPosition(x, y, z, ang);
 }
 
@@ -1108,7 +1387,12 @@ void Map::AddDynamicObjectToMoveList(DynamicObject* dynObj, float x, float y, fl
         return;
 
     if (dynObj->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _dynamicObjectsToMove.push_back(dynObj);
+    {
+        if (CurrentUpdateRegion && _regionUpdateInProgress)
+            CurrentUpdateRegion->DynamicObjectsToMove.push_back(dynObj);
+        else
+            _dynamicObjectsToMove.push_back(dynObj);
+    }
     dynObj->SetNewCellPosition(x, y, z, ang);
 }
 
@@ -1794,7 +2078,7 @@ inline void Map::setNGrid(NGridType *grid, uint32 x, uint32 y)
         TC_LOG_ERROR("maps", "map::setNGrid() Invalid grid coordinates found: %d, %d!", x, y);
         ABORT();
     }
-    i_grids[x][y] = grid;
+    i_grids[x][y].store(grid, std::memory_order_release);
 }
 
 void Map::SendObjectUpdates()
@@ -1926,6 +2210,8 @@ size_t Map::DespawnAll(SpawnObjectType type, ObjectGuid::LowType spawnId)
 
 bool Map::AddRespawnInfo(RespawnInfo const& info)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
+
     if (!info.spawnId)
     {
         TC_LOG_ERROR("maps", "Attempt to insert respawn info for zero spawn id (type %u)", uint32(info.type));
@@ -1992,6 +2278,8 @@ void Map::UnloadAllRespawnInfos() // delete everything from memory
 
 void Map::DeleteRespawnInfo(RespawnInfo* info, CharacterDatabaseTransaction dbTrans)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
+
     // Delete from all relevant containers to ensure consistency
     ASSERT(info);
 
@@ -2362,6 +2650,8 @@ void Map::DelayedUpdate(uint32 t_diff)
 
 void Map::AddObjectToRemoveList(WorldObject* obj)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
+
     ASSERT(obj->GetMapId() == GetId() && obj->GetInstanceId() == GetInstanceId());
 
     obj->SetDestroyedObject(true);
@@ -2373,6 +2663,8 @@ void Map::AddObjectToRemoveList(WorldObject* obj)
 
 void Map::AddObjectToSwitchList(WorldObject* obj, bool on)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
+
     ASSERT(obj->GetMapId() == GetId() && obj->GetInstanceId() == GetInstanceId());
     // i_objectsToSwitch is iterated only in Map::RemoveAllObjectsInRemoveList() and it uses
     // the contained objects only if GetTypeId() == TYPEID_UNIT , so we can return in all other cases
@@ -2516,6 +2808,8 @@ bool Map::ActiveObjectsNearGrid(NGridType const& ngrid) const
 
 void Map::AddToActive(WorldObject* obj)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
+
     AddToActiveHelper(obj);
 
     Optional<Position> respawnLocation;
@@ -2555,6 +2849,8 @@ void Map::AddToActive(WorldObject* obj)
 
 void Map::RemoveFromActive(WorldObject* obj)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
+
     RemoveFromActiveHelper(obj);
 
     Optional<Position> respawnLocation;
@@ -3160,26 +3456,31 @@ Player* Map::GetPlayer(ObjectGuid const& guid)
 
 AreaTrigger* Map::GetAreaTrigger(ObjectGuid const& guid)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
     return _objectsStore.Find<AreaTrigger>(guid);
 }
 
 Corpse* Map::GetCorpse(ObjectGuid const& guid)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
     return _objectsStore.Find<Corpse>(guid);
 }
 
 Creature* Map::GetCreature(ObjectGuid const& guid)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
     return _objectsStore.Find<Creature>(guid);
 }
 
 DynamicObject* Map::GetDynamicObject(ObjectGuid const& guid)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
     return _objectsStore.Find<DynamicObject>(guid);
 }
 
 Creature* Map::GetCreatureBySpawnId(ObjectGuid::LowType spawnId) const
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
     auto const bounds = GetCreatureBySpawnIdStore().equal_range(spawnId);
     if (bounds.first == bounds.second)
         return nullptr;
@@ -3194,6 +3495,7 @@ Creature* Map::GetCreatureBySpawnId(ObjectGuid::LowType spawnId) const
 
 GameObject* Map::GetGameObjectBySpawnId(ObjectGuid::LowType spawnId) const
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
     auto const bounds = GetGameObjectBySpawnIdStore().equal_range(spawnId);
     if (bounds.first == bounds.second)
         return nullptr;
@@ -3208,11 +3510,13 @@ GameObject* Map::GetGameObjectBySpawnId(ObjectGuid::LowType spawnId) const
 
 GameObject* Map::GetGameObject(ObjectGuid const& guid)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
     return _objectsStore.Find<GameObject>(guid);
 }
 
 Pet* Map::GetPet(ObjectGuid const& guid)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
     return _objectsStore.Find<Pet>(guid);
 }
 
@@ -3398,6 +3702,8 @@ void Map::DeleteCorpseData()
 
 void Map::AddCorpse(Corpse* corpse)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
+
     corpse->SetMap(this);
 
     _corpsesByCell[corpse->GetCellCoord().GetId()].insert(corpse);
@@ -3409,6 +3715,8 @@ void Map::AddCorpse(Corpse* corpse)
 
 void Map::RemoveCorpse(Corpse* corpse)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
+
     ASSERT(corpse);
 
     corpse->UpdateObjectVisibilityOnDestroy();
@@ -3660,6 +3968,8 @@ int32 Map::GetWorldStateValue(int32 worldStateId) const
 
 void Map::SetWorldStateValue(int32 worldStateId, int32 value, bool hidden)
 {
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
+
     auto [itr, inserted] = _worldStateValues.try_emplace(worldStateId, 0);
     int32 oldValue = itr->second;
     if (oldValue == value && !inserted)
@@ -31,17 +31,23 @@
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
 #include "SpawnData.h"
+#include "TickProfiler.h"
 #include "Timer.h"
 #include "WorldStateDefines.h"
 #include "Transaction.h"
 #include "Weather.h"
+#include <atomic>
 #include <bitset>
 #include <list>
 #include <memory>
+#include <mutex>
 
 class Battleground;
 class BattlegroundMap;
+class Creature;
 class CreatureGroup;
+class DynamicObject;
+class GameObject;
 class Group;
 class InstanceMap;
 class InstanceSave;
@@ -109,6 +115,20 @@ struct ZoneDynamicInfo
 #define MIN_UNLOAD_DELAY      1                             // immediate unload
 #define MAP_INVALID_ZONE      0xFFFFFFFF
 
+// grids closer than this (in grids, chebyshev distance) always end up in the same update region
+#define MAP_UPDATE_REGION_GRID_MARGIN 2
+
+// Group of active cells far enough from every other group to be updated on its own thread
+struct MapUpdateRegion
+{
+    std::vector<uint32> Cells;
+
+    // cell moves requested while the region was updated, merged in region order afterwards
+    std::vector<Creature*> CreaturesToMove;
+    std::vector<GameObject*> GameObjectsToMove;
+    std::vector<DynamicObject*> DynamicObjectsToMove;
+};
+
 typedef std::map<uint32/*leaderDBGUID*/, CreatureGroup*>        CreatureGroupHolderType;
 
 struct RespawnInfo; // forward declaration
@@ -188,7 +208,6 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         template<class T> bool AddToMap(T *);
         template<class T> void RemoveFromMap(T *, bool);
 
-        void VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> &worldVisitor);
         virtual void Update(uint32);
 
         float GetVisibilityRange() const { return m_VisibleDistance; }
@@ -308,6 +327,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         virtual EnterState CannotEnter(Player* /*player*/) { return CAN_ENTER; }
         char const* GetMapName() const;
 
+        TickProfiler const& GetTickProfiler() const { return _tickProfiler; }
+
         // have meaning only for instanced map (that have set real difficulty)
         Difficulty GetDifficulty() const { return Difficulty(GetSpawnMode()); }
         bool IsRegularDifficulty() const;
@@ -333,6 +354,10 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         bool isCellMarked(uint32 pCellId) { return marked_cells.test(pCellId); }
         void markCell(uint32 pCellId) { marked_cells.set(pCellId); }
 
+        // number of cells updated in the last tick and of repeated visits of them that were skipped
+        uint32 GetActiveCellCount() const { return uint32(_activeCells.size()); }
+        uint32 GetSkippedCellVisitCount() const { return _skippedCellVisits; }
+
         bool HavePlayers() const { return !m_mapRefManager.isEmpty(); }
         uint32 GetPlayersCountExceptGMs() const;
         bool ActiveObjectsNearGrid(NGridType const& ngrid) const;
@@ -486,6 +511,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         inline ObjectGuid::LowType GenerateLowGuid()
         {
             static_assert(ObjectGuidTraits<high>::MapSpecific, "Only map specific guid can be generated in Map context");
+            std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
             return GetGuidSequenceGenerator<high>().Generate();
         }
 
@@ -498,14 +524,26 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         void AddUpdateObject(Object* obj)
         {
+            std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
             _updateObjects.insert(obj);
         }
 
         void RemoveUpdateObject(Object* obj)
         {
+            std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
             _updateObjects.erase(obj);
         }
 
+        // Serializes access to map wide containers while regions of this map are updated in parallel, no-op otherwise
+        // Lookups in them take it too, callers iterating GetObjectsStore() or the spawn id stores must hold it meanwhile
+        std::unique_lock<std::recursive_mutex> AcquireRegionUpdateLock() const
+        {
+            if (!_regionUpdateInProgress)
+                return std::unique_lock<std::recursive_mutex>();
+
+            return std::unique_lock<std::recursive_mutex>(_regionUpdateLock);
+        }
+
     private:
         void SetTimer(uint32 t) { i_gridExpiry = t < MIN_GRID_DELAY ? MIN_GRID_DELAY : t; }
 
@@ -545,7 +583,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         NGridType* getNGrid(uint32 x, uint32 y) const
         {
             ASSERT(x < MAX_NUMBER_OF_GRIDS && y < MAX_NUMBER_OF_GRIDS, "x = %u, y = %u", x, y);
-            return i_grids[x][y];
+            return i_grids[x][y].load(std::memory_order_acquire);
         }
 
         bool isGridObjectDataLoaded(uint32 x, uint32 y) const { return getNGrid(x, y)->isGridObjectDataLoaded(); }
@@ -556,6 +594,26 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         void SendObjectUpdates();
 
+        // touchedCells receives every cell in range of obj, including cells already marked by someone else
+        void MarkNearbyCellsOf(WorldObject* obj, std::vector<uint32>* touchedCells = nullptr);
+        void MarkActiveCellsOf(Player* player, std::vector<uint32>* touchedCells = nullptr);
+        void MarkActiveCellsOfActiveObjects();
+        void UpdateActiveCells(uint32 diff);
+        template<class T>
+        void SweepCells(std::vector<uint32> const& cells, TypeContainerVisitor<T, GridTypeMapContainer>& gridVisitor, TypeContainerVisitor<T, WorldTypeMapContainer>& worldVisitor);
+        bool CanUpdateRegionsInParallel() const;
+        void UpdateRegions(uint32 diff);
+        void BuildUpdateRegions(std::vector<std::vector<uint32>> const& playerCells, std::vector<uint32> const& cells);
+        void UpdateRegion(MapUpdateRegion& region, uint32 diff);
+
+        // cells collected for update in the current tick, each one is listed once
+        std::vector<uint32> _activeCells;
+        uint32 _skippedCellVisits;
+
+        std::vector<MapUpdateRegion> _updateRegions;
+        bool _regionUpdateInProgress;
+        mutable std::recursive_mutex _regionUpdateLock;
+
     protected:
 
         MapEntry const* i_mapEntry;
@@ -595,7 +653,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         uint16 m_forceEnabledNavMeshFilterFlags;
         uint16 m_forceDisabledNavMeshFilterFlags;
 
-        NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+        // only published once fully created, regions updated in parallel look grids up without locking
+        std::atomic<NGridType*> i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
 
         //these functions used to process player/mob aggro reactions and
@@ -735,6 +794,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         ZoneDynamicInfoMap _zoneDynamicInfo;
         IntervalTimer _weatherUpdateTimer;
 
+        TickProfiler _tickProfiler;
+
         template<HighGuid high>
         inline ObjectGuidGeneratorBase& GetGuidSequenceGenerator()
         {
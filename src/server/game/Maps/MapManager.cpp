@@ -24,7 +24,9 @@
 #include "InstanceSaveMgr.h"
 #include "Log.h"
 #include "Map.h"
+#include "Metric.h"
 #include "ObjectMgr.h"
+#include "PathGenerator.h"
 #include "Player.h"
 #include "ScriptMgr.h"
 #include "World.h"
@@ -49,6 +51,8 @@ void MapManager::Initialize()
     // Start mtmaps if needed.
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    PathGenerator::StartPathfindingThreads(sWorld->getIntConfig(CONFIG_MAP_UPDATE_PATHFINDING_THREADS));
 }
 
 void MapManager::InitializeVisibilityDistanceInfo()
@@ -364,8 +368,17 @@ void MapManager::Update(uint32 diff)
     if (m_updater.activated())
         m_updater.wait();
 
+    uint32 activeCells = 0;
+    uint32 skippedCellVisits = 0;
     for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
+    {
         iter->second->DelayedUpdate(uint32(i_timer.GetCurrent()));
+        activeCells += iter->second->GetActiveCellCount();
+        skippedCellVisits += iter->second->GetSkippedCellVisitCount();
+    }
+
+    TC_METRIC_VALUE("map_active_cells", activeCells);
+    TC_METRIC_VALUE("map_skipped_cell_visits", skippedCellVisits);
 
     i_timer.SetCurrent(0);
 }
@@ -407,6 +420,8 @@ void MapManager::UnloadAll()
     if (m_updater.activated())
         m_updater.deactivate();
 
+    PathGenerator::StopPathfindingThreads();
+
     Map::DeleteStateMachine();
 }
 
@@ -43,6 +43,7 @@ void Map::ScriptsStart(std::map<uint32, std::multimap<uint32, ScriptInfo>> const
     ObjectGuid ownerGUID = (source && source->GetTypeId() == TYPEID_ITEM) ? ((Item*)source)->GetOwnerGUID() : ObjectGuid::Empty;
 
     ///- Schedule script execution for all scripts in the script map
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
     ScriptMap const* s2 = &(s->second);
     bool immedScript = false;
     for (ScriptMap::const_iterator iter = s2->begin(); iter != s2->end(); ++iter)
@@ -60,7 +61,8 @@ void Map::ScriptsStart(std::map<uint32, std::multimap<uint32, ScriptInfo>> const
         sMapMgr->IncreaseScheduledScriptsCount();
     }
     ///- If one of the effects should be immediate, launch the script execution
-    if (/*start &&*/ immedScript && !i_scriptLock)
+    ///- Regions updated in parallel only queue them, they are run once all regions are done
+    if (/*start &&*/ immedScript && !i_scriptLock && !_regionUpdateInProgress)
     {
         i_scriptLock = true;
         ScriptsProcess();
@@ -83,12 +85,13 @@ void Map::ScriptCommandStart(ScriptInfo const& script, uint32 delay, Object* sou
     sa.ownerGUID  = ownerGUID;
 
     sa.script = &script;
+    std::unique_lock<std::recursive_mutex> guard = AcquireRegionUpdateLock();
     m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(GameTime::GetGameTime() + delay), sa));
 
     sMapMgr->IncreaseScheduledScriptsCount();
 
-    ///- If effects should be immediate, launch the script execution
-    if (delay == 0 && !i_scriptLock)
+    ///- If effects should be immediate, launch the script execution, see ScriptsStart for parallel region updates
+    if (delay == 0 && !i_scriptLock && !_regionUpdateInProgress)
     {
         i_scriptLock = true;
         ScriptsProcess();
@@ -267,6 +270,7 @@ inline void Map::_ScriptProcessDoor(Object* source, Object* target, ScriptInfo c
 
 inline GameObject* Map::_FindGameObject(WorldObject* searchObject, ObjectGuid::LowType guid) const
 {
+    std::unique_lock<std::recursive_mutex> guard = searchObject->GetMap()->AcquireRegionUpdateLock();
     auto bounds = searchObject->GetMap()->GetGameObjectBySpawnIdStore().equal_range(guid);
     if (bounds.first == bounds.second)
         return nullptr;
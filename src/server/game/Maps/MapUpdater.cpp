@@ -17,11 +17,24 @@
 
 #include "MapUpdater.h"
 #include "Map.h"
+#include "Metric.h"
 
+#include <algorithm>
+#include <memory>
 #include <mutex>
+#include <limits>
+#include <numeric>
 
 
 class MapUpdateRequest
+{
+    public:
+        virtual ~MapUpdateRequest() { }
+
+        virtual void call() = 0;
+};
+
+class MapUpdateTask : public MapUpdateRequest
 {
     private:
 
@@ -31,42 +44,139 @@ class MapUpdateRequest
 
     public:
 
-        MapUpdateRequest(Map& m, MapUpdater& u, uint32 d)
+        MapUpdateTask(Map& m, MapUpdater& u, uint32 d)
             : m_map(m), m_updater(u), m_diff(d)
         {
         }
 
-        void call()
+        Map const& GetMap() const { return m_map; }
+
+        void call() override
         {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
             m_map.Update (m_diff);
+            m_updater.record_update_time(m_map, uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()));
             m_updater.update_finished();
         }
 };
 
-void MapUpdater::activate(size_t num_threads)
+class ParallelTaskBatch
 {
-    for (size_t i = 0; i < num_threads; ++i)
+    public:
+
+        ParallelTaskBatch(std::size_t count, std::function<void(std::size_t)>&& task)
+            : _task(std::move(task)), _count(count), _next(0), _finished(0)
+        {
+        }
+
+        // claims and runs tasks until none are left unclaimed
+        void Process()
+        {
+            std::size_t processed = 0;
+            for (std::size_t i = _next++; i < _count; i = _next++)
+            {
+                _task(i);
+                ++processed;
+            }
+
+            if (!processed)
+                return;
+
+            std::lock_guard<std::mutex> lock(_lock);
+            _finished += processed;
+            if (_finished == _count)
+                _condition.notify_all();
+        }
+
+        void Wait()
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            while (_finished < _count)
+                _condition.wait(lock);
+        }
+
+    private:
+
+        std::function<void(std::size_t)> _task;
+        std::size_t _count;
+        std::atomic<std::size_t> _next;
+        std::size_t _finished;
+        std::mutex _lock;
+        std::condition_variable _condition;
+};
+
+class ParallelTaskHelper : public MapUpdateRequest
+{
+    private:
+
+        std::shared_ptr<ParallelTaskBatch> m_batch;
+        MapUpdater& m_updater;
+
+    public:
+
+        ParallelTaskHelper(std::shared_ptr<ParallelTaskBatch> batch, MapUpdater& u)
+            : m_batch(std::move(batch)), m_updater(u)
+        {
+        }
+
+        void call() override
+        {
+            m_batch->Process();
+            m_updater.update_finished();
+        }
+};
+
+namespace
+{
+    // index of the MapUpdater worker owning the current thread, if any
+    thread_local size_t CurrentWorkerIndex = std::numeric_limits<size_t>::max();
+
+    // weight of the latest sample in the moving average of map update times
+    constexpr uint32 UPDATE_COST_SAMPLE_WEIGHT = 4; // 1/4
+
+    uint64 MakeMapKey(Map const& map)
     {
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+        return (uint64(map.GetId()) << 32) | map.GetInstanceId();
     }
 }
 
-void MapUpdater::deactivate()
+void MapUpdater::activate(size_t num_threads)
 {
-    _cancelationToken = true;
+    _activationTime = std::chrono::steady_clock::now();
 
-    wait();
+    for (size_t i = 0; i < num_threads; ++i)
+        _workers.push_back(std::make_unique<Worker>());
 
-    _queue.Cancel();
+    // start threads only after every worker exists, they steal from each other
+    for (size_t i = 0; i < num_threads; ++i)
+        _workers[i]->Thread = std::thread(&MapUpdater::WorkerThread, this, i);
+}
+
+void MapUpdater::deactivate()
+{
+    wait();
 
-    for (auto& thread : _workerThreads)
     {
-        thread.join();
+        std::lock_guard<std::mutex> lock(_sleepLock);
+        _cancelationToken = true;
     }
+
+    _workAvailable.notify_all();
+
+    for (std::unique_ptr<Worker>& worker : _workers)
+        worker->Thread.join();
+
+    for (std::unique_ptr<Worker>& worker : _workers)
+        for (MapUpdateRequest* request : worker->Queue)
+            delete request;
+
+    _workers.clear();
 }
 
 void MapUpdater::wait()
 {
+    dispatch_scheduled_updates();
+
     std::unique_lock<std::mutex> lock(_lock);
 
     while (pending_requests > 0)
@@ -81,12 +191,182 @@ void MapUpdater::schedule_update(Map& map, uint32 diff)
 
     ++pending_requests;
 
-    _queue.Push(new MapUpdateRequest(map, *this, diff));
+    _scheduledUpdates.push_back(new MapUpdateTask(map, *this, diff));
+}
+
+void MapUpdater::dispatch_scheduled_updates()
+{
+    std::vector<MapUpdateTask*> updates;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        std::swap(updates, _scheduledUpdates);
+    }
+
+    if (updates.empty())
+        return;
+
+    std::vector<uint32> costs(updates.size());
+    {
+        std::lock_guard<std::mutex> lock(_costLock);
+
+        // only keep history of maps that are still being updated
+        std::unordered_map<uint64, uint32> updateCosts;
+        for (size_t i = 0; i < updates.size(); ++i)
+        {
+            uint64 key = MakeMapKey(updates[i]->GetMap());
+            auto itr = _updateCosts.find(key);
+            if (itr != _updateCosts.end())
+            {
+                costs[i] = itr->second;
+                updateCosts[key] = itr->second;
+            }
+        }
+
+        std::swap(updateCosts, _updateCosts);
+    }
+
+    // longest processing time first, every map goes to the worker with the least predicted work
+    std::vector<size_t> order(updates.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::stable_sort(order.begin(), order.end(), [&costs](size_t left, size_t right) { return costs[left] > costs[right]; });
+
+    std::vector<uint64> workerLoads(_workers.size(), 0);
+    std::vector<std::vector<MapUpdateRequest*>> assignments(_workers.size());
+    for (size_t index : order)
+    {
+        size_t worker = std::distance(workerLoads.begin(), std::min_element(workerLoads.begin(), workerLoads.end()));
+        // never updated maps are assumed to be cheap but still have to spread between workers
+        workerLoads[worker] += std::max<uint32>(costs[index], 1);
+        assignments[worker].push_back(updates[index]);
+    }
+
+    for (size_t i = 0; i < _workers.size(); ++i)
+    {
+        std::lock_guard<std::mutex> lock(_workers[i]->QueueLock);
+        _workers[i]->Queue.insert(_workers[i]->Queue.end(), assignments[i].begin(), assignments[i].end());
+    }
+
+    // counted once queued and under the lock sleeping workers check it with, no wakeup is lost
+    {
+        std::lock_guard<std::mutex> lock(_sleepLock);
+        _queuedRequests += updates.size();
+    }
+
+    _workAvailable.notify_all();
+}
+
+void MapUpdater::push(size_t workerIndex, MapUpdateRequest* request)
+{
+    {
+        std::lock_guard<std::mutex> lock(_workers[workerIndex]->QueueLock);
+        _workers[workerIndex]->Queue.push_back(request);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_sleepLock);
+        ++_queuedRequests;
+    }
+
+    _workAvailable.notify_one();
+}
+
+MapUpdateRequest* MapUpdater::pop(size_t workerIndex)
+{
+    MapUpdateRequest* request = nullptr;
+    {
+        Worker& worker = *_workers[workerIndex];
+        std::lock_guard<std::mutex> lock(worker.QueueLock);
+        if (!worker.Queue.empty())
+        {
+            request = worker.Queue.front();
+            worker.Queue.pop_front();
+        }
+    }
+
+    // own queue is empty, steal the cheapest request of another worker
+    for (size_t i = 1; !request && i < _workers.size(); ++i)
+    {
+        Worker& victim = *_workers[(workerIndex + i) % _workers.size()];
+        std::lock_guard<std::mutex> lock(victim.QueueLock);
+        if (!victim.Queue.empty())
+        {
+            request = victim.Queue.back();
+            victim.Queue.pop_back();
+            ++_workers[workerIndex]->Steals;
+        }
+    }
+
+    if (!request)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(_sleepLock);
+    --_queuedRequests;
+    return request;
+}
+
+void MapUpdater::run_parallel(std::size_t count, std::function<void(std::size_t)> task)
+{
+    if (!count)
+        return;
+
+    std::shared_ptr<ParallelTaskBatch> batch = std::make_shared<ParallelTaskBatch>(count, std::move(task));
+
+    // helpers that get picked up after all work is claimed simply do nothing
+    // they are queued at the back of the calling worker so idle workers steal them first
+    std::size_t helpers = std::min(count - 1, _workers.size());
+    size_t workerIndex = CurrentWorkerIndex < _workers.size() ? CurrentWorkerIndex : 0;
+    for (std::size_t i = 0; i < helpers; ++i)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            ++pending_requests;
+        }
+
+        push(workerIndex, new ParallelTaskHelper(batch, *this));
+    }
+
+    batch->Process();
+    batch->Wait();
 }
 
 bool MapUpdater::activated()
 {
-    return _workerThreads.size() > 0;
+    return _workers.size() > 0;
+}
+
+std::vector<MapUpdaterWorkerStats> MapUpdater::get_worker_stats() const
+{
+    std::vector<MapUpdaterWorkerStats> stats;
+    stats.reserve(_workers.size());
+
+    uint64 elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _activationTime).count();
+    for (std::unique_ptr<Worker> const& worker : _workers)
+    {
+        MapUpdaterWorkerStats& workerStats = stats.emplace_back();
+        workerStats.BusyTime = worker->BusyTime;
+        workerStats.Requests = worker->Requests;
+        workerStats.Steals = worker->Steals;
+        workerStats.Utilization = elapsed ? float(double(workerStats.BusyTime) / double(elapsed)) : 0.0f;
+    }
+
+    return stats;
+}
+
+uint32 MapUpdater::get_predicted_update_time(Map const& map) const
+{
+    std::lock_guard<std::mutex> lock(_costLock);
+    auto itr = _updateCosts.find(MakeMapKey(map));
+    return itr != _updateCosts.end() ? itr->second : 0;
+}
+
+void MapUpdater::record_update_time(Map const& map, uint32 microseconds)
+{
+    TC_METRIC_HISTOGRAM("map_update_time", microseconds, 1000, 5000, 10000, 25000, 50000, 100000, 250000);
+
+    std::lock_guard<std::mutex> lock(_costLock);
+    auto itr = _updateCosts.try_emplace(MakeMapKey(map), microseconds);
+    if (!itr.second)
+        itr.first->second = itr.first->second - itr.first->second / UPDATE_COST_SAMPLE_WEIGHT + microseconds / UPDATE_COST_SAMPLE_WEIGHT;
 }
 
 void MapUpdater::update_finished()
@@ -98,19 +378,34 @@ void MapUpdater::update_finished()
     _condition.notify_all();
 }
 
-void MapUpdater::WorkerThread()
+void MapUpdater::WorkerThread(size_t workerIndex)
 {
+    CurrentWorkerIndex = workerIndex;
+    Worker& worker = *_workers[workerIndex];
+
     while (1)
     {
-        MapUpdateRequest* request = nullptr;
+        MapUpdateRequest* request = pop(workerIndex);
+        if (!request)
+        {
+            std::unique_lock<std::mutex> lock(_sleepLock);
 
-        _queue.WaitAndPop(request);
+            while (!_queuedRequests && !_cancelationToken)
+                _workAvailable.wait(lock);
 
-        if (_cancelationToken)
-            return;
+            if (_cancelationToken)
+                return;
+
+            continue;
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 
         request->call();
 
         delete request;
+
+        worker.BusyTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        ++worker.Requests;
     }
 }
@@ -19,25 +19,51 @@
 #define _MAP_UPDATER_H_INCLUDED
 
 #include "Define.h"
+#include <atomic>
+#include <chrono>
 #include <mutex>
 #include <thread>
 #include <condition_variable>
-#include "ProducerConsumerQueue.h"
+#include <deque>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 class MapUpdateRequest;
+class MapUpdateTask;
+class ParallelTaskHelper;
 class Map;
 
+struct MapUpdaterWorkerStats
+{
+    float Utilization;      // fraction of time spent running requests since activation
+    uint64 BusyTime;        // microseconds
+    uint64 Requests;
+    uint64 Steals;
+};
+
+// Work stealing pool updating maps. Each worker owns a deque filled by wait() with map updates
+// sorted by their predicted cost (moving average of previous Map::Update durations), longest first.
+// Workers pop their own deque from the front and steal from the back of other deques once theirs is empty.
 class TC_GAME_API MapUpdater
 {
     public:
 
-        MapUpdater() : _cancelationToken(false), pending_requests(0) {}
+        MapUpdater() : _cancelationToken(false), _queuedRequests(0), pending_requests(0) {}
         ~MapUpdater() { };
 
-        friend class MapUpdateRequest;
+        friend class MapUpdateTask;
+        friend class ParallelTaskHelper;
 
+        // queues the update, it is only handed to workers by the next wait() call
         void schedule_update(Map& map, uint32 diff);
 
+        // Runs task(0) .. task(count - 1) on the calling thread and any idle worker,
+        // returns once every task has finished. The caller always participates so
+        // this is safe to use from inside a map update running on a worker.
+        void run_parallel(std::size_t count, std::function<void(std::size_t)> task);
+
         void wait();
 
         void activate(size_t num_threads);
@@ -46,20 +72,54 @@ class TC_GAME_API MapUpdater
 
         bool activated();
 
+        std::vector<MapUpdaterWorkerStats> get_worker_stats() const;
+
+        // predicted duration of the next update of map in microseconds, 0 if it was never updated
+        uint32 get_predicted_update_time(Map const& map) const;
+
     private:
 
-        ProducerConsumerQueue<MapUpdateRequest*> _queue;
+        struct Worker
+        {
+            Worker() : BusyTime(0), Requests(0), Steals(0) { }
+
+            std::thread Thread;
+            std::mutex QueueLock;
+            std::deque<MapUpdateRequest*> Queue;
 
-        std::vector<std::thread> _workerThreads;
+            std::atomic<uint64> BusyTime;
+            std::atomic<uint64> Requests;
+            std::atomic<uint64> Steals;
+        };
+
+        std::vector<std::unique_ptr<Worker>> _workers;
         std::atomic<bool> _cancelationToken;
+        std::chrono::steady_clock::time_point _activationTime;
+
+        // map updates waiting for wait() to be distributed between workers
+        std::vector<MapUpdateTask*> _scheduledUpdates;
+
+        // moving average of Map::Update durations in microseconds, keyed by map id and instance id
+        mutable std::mutex _costLock;
+        std::unordered_map<uint64, uint32> _updateCosts;
+
+        std::mutex _sleepLock;
+        std::condition_variable _workAvailable;
+        size_t _queuedRequests;                             // guarded by _sleepLock
 
         std::mutex _lock;
         std::condition_variable _condition;
         size_t pending_requests;
 
+        void dispatch_scheduled_updates();
+        void push(size_t workerIndex, MapUpdateRequest* request);
+        MapUpdateRequest* pop(size_t workerIndex);
+
+        void record_update_time(Map const& map, uint32 microseconds);
+
         void update_finished();
 
-        void WorkerThread();
+        void WorkerThread(size_t workerIndex);
 };
 
 #endif //_MAP_UPDATER_H_INCLUDED
@@ -129,6 +129,7 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
     // the owner might be unable to move (rooted or casting), pause movement
     if (owner->HasUnitState(UNIT_STATE_NOT_MOVE) || owner->IsMovementPreventedByCasting())
     {
+        _pathGenerator->CancelPendingPath();
         owner->StopMoving();
         return true;
     }
@@ -139,12 +140,22 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
     {
         if (!target->isInAccessiblePlaceFor(creature))
         {
+            _pathGenerator->CancelPendingPath();
             creature->SetCannotReachTarget(true);
             creature->StopMoving();
             return true;
         }
     }
 
+    // the path requested by launchSpline is calculated on a pathfinding thread, wait for it
+    if (_pathGenerator->IsPathPending())
+    {
+        if (_pathGenerator->UpdatePendingPath())
+            moveAlongPath(owner, target, true);
+
+        return true;
+    }
+
     // ------------------------ Now we can finally perform the movement actions
 
     if (_positionCheckTimer.Passed())
@@ -243,12 +254,20 @@ void ChaseMovementGenerator::launchSpline(Unit* owner, Unit* target, Position& d
     if (owner->IsHovering())
         startPoint.m_positionZ = owner->GetFloorZ();
 
-    bool success = _pathGenerator->CalculatePath(startPoint, destination, owner->IsFlying());
+    bool success = _pathGenerator->CalculatePathAsync(startPoint, destination, owner->IsFlying());
+    if (_pathGenerator->IsPathPending())
+        return;
+
+    moveAlongPath(owner, target, success);
+}
+
+void ChaseMovementGenerator::moveAlongPath(Unit* owner, Unit* target, bool pathCalculated)
+{
     uint32 deniedPathResultTypes = PATHFIND_NOPATH | PATHFIND_INCOMPLETE;
     if ((!owner->IsFlying() || (target->IsInWater() && !owner->CanEnterWater())) && !owner->HasUnitState(UNIT_STATE_IGNORE_PATHFINDING)) // only flying and swimming units and units with pathfinding disabled may use shortcuts an
         deniedPathResultTypes |= PATHFIND_SHORTCUT;
 
-    bool cantReachTarget = !success || (_pathGenerator->GetPathType() & deniedPathResultTypes);
+    bool cantReachTarget = !pathCalculated || (_pathGenerator->GetPathType() & deniedPathResultTypes);
     if (cantReachTarget)
     {
         owner->ToCreature()->SetCannotReachTarget(true);
@@ -56,6 +56,7 @@ class ChaseMovementGenerator : public MovementGenerator, public AbstractPursuer
 
         ChaseMovementPositionCheckResult checkPosition(ChasePositionCheckOptions checkOptions, Unit* owner, Unit* target, Position const* destination = nullptr) const;
         void launchSpline(Unit* owner, Unit* target, Position& destination);
+        void moveAlongPath(Unit* owner, Unit* target, bool pathCalculated);
 };
 
 #endif
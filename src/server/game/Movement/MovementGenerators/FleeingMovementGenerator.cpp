@@ -83,12 +83,23 @@ bool FleeingMovementGenerator<T>::DoUpdate(T* owner, uint32 diff)
     if (owner->HasUnitState(UNIT_STATE_NOT_MOVE) || owner->IsMovementPreventedByCasting())
     {
         _interrupt = true;
+        if (_path)
+            _path->CancelPendingPath();
         owner->StopMoving();
         return true;
     }
     else
         _interrupt = false;
 
+    // the path requested by SetTargetLocation is calculated on a pathfinding thread, wait for it
+    if (_path && _path->IsPathPending())
+    {
+        if (_path->UpdatePendingPath())
+            MoveAlongPath(owner, true);
+
+        return true;
+    }
+
     _timer.Update(diff);
     if (!_interrupt && _timer.Passed() && owner->movespline->Finalized())
         SetTargetLocation(owner);
@@ -125,8 +136,17 @@ void FleeingMovementGenerator<T>::SetTargetLocation(T* owner)
         _path = new PathGenerator(owner);
 
     _path->SetPathLengthLimit(30.0f);
-    bool result = _path->CalculatePath(destination.GetPositionX(), destination.GetPositionY(), destination.GetPositionZ());
-    if (!result || (_path->GetPathType() & PATHFIND_NOPATH)
+    bool result = _path->CalculatePathAsync(destination.GetPositionX(), destination.GetPositionY(), destination.GetPositionZ());
+    if (_path->IsPathPending())
+        return;
+
+    MoveAlongPath(owner, result);
+}
+
+template<class T>
+void FleeingMovementGenerator<T>::MoveAlongPath(T* owner, bool pathCalculated)
+{
+    if (!pathCalculated || (_path->GetPathType() & PATHFIND_NOPATH)
         || (_path->GetPathType() & PATHFIND_SHORTCUT)
         || (_path->GetPathType() & PATHFIND_FARFROMPOLY))
     {
@@ -189,6 +209,8 @@ template bool FleeingMovementGenerator<Player>::DoUpdate(Player*, uint32);
 template bool FleeingMovementGenerator<Creature>::DoUpdate(Creature*, uint32);
 template void FleeingMovementGenerator<Player>::SetTargetLocation(Player*);
 template void FleeingMovementGenerator<Creature>::SetTargetLocation(Creature*);
+template void FleeingMovementGenerator<Player>::MoveAlongPath(Player*, bool);
+template void FleeingMovementGenerator<Creature>::MoveAlongPath(Creature*, bool);
 template void FleeingMovementGenerator<Player>::GetPoint(Player*, Position &);
 template void FleeingMovementGenerator<Creature>::GetPoint(Creature*, Position &);
 
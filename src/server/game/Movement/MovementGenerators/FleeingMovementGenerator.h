@@ -37,6 +37,7 @@ class FleeingMovementGenerator : public MovementGeneratorMedium< T, FleeingMovem
 
     private:
         void SetTargetLocation(T*);
+        void MoveAlongPath(T*, bool pathCalculated);
         void GetPoint(T*, Position &position);
 
         PathGenerator* _path;
@@ -0,0 +1,562 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MOVEMENT_STATUS_SERIALIZER_H
+#define _MOVEMENT_STATUS_SERIALIZER_H
+
+#include "ByteBuffer.h"
+#include <array>
+#include <utility>
+
+enum MovementStatusElements
+{
+    MSEHasGuidByte0,
+    MSEHasGuidByte1,
+    MSEHasGuidByte2,
+    MSEHasGuidByte3,
+    MSEHasGuidByte4,
+    MSEHasGuidByte5,
+    MSEHasGuidByte6,
+    MSEHasGuidByte7,
+    MSEHasMovementFlags,
+    MSEHasMovementFlags2,
+    MSEHasTimestamp,
+    MSEHasOrientation,
+    MSEHasTransportData,
+    MSEHasTransportGuidByte0,
+    MSEHasTransportGuidByte1,
+    MSEHasTransportGuidByte2,
+    MSEHasTransportGuidByte3,
+    MSEHasTransportGuidByte4,
+    MSEHasTransportGuidByte5,
+    MSEHasTransportGuidByte6,
+    MSEHasTransportGuidByte7,
+    MSEHasTransportTime2,
+    MSEHasVehicleId,
+    MSEHasPitch,
+    MSEHasFallData,
+    MSEHasFallDirection,
+    MSEHasSplineElevation,
+    MSEHasSpline,
+    MSEHasHeightChangeFailed,
+
+    MSEGuidByte0,
+    MSEGuidByte1,
+    MSEGuidByte2,
+    MSEGuidByte3,
+    MSEGuidByte4,
+    MSEGuidByte5,
+    MSEGuidByte6,
+    MSEGuidByte7,
+    MSEMovementFlags,
+    MSEMovementFlags2,
+    MSETimestamp,
+    MSEPositionX,
+    MSEPositionY,
+    MSEPositionZ,
+    MSEOrientation,
+    MSETransportGuidByte0,
+    MSETransportGuidByte1,
+    MSETransportGuidByte2,
+    MSETransportGuidByte3,
+    MSETransportGuidByte4,
+    MSETransportGuidByte5,
+    MSETransportGuidByte6,
+    MSETransportGuidByte7,
+    MSETransportPositionX,
+    MSETransportPositionY,
+    MSETransportPositionZ,
+    MSETransportOrientation,
+    MSETransportSeat,
+    MSETransportTime,
+    MSETransportTime2,
+    MSETransportVehicleId,
+    MSEPitch,
+    MSEFallTime,
+    MSEFallVerticalSpeed,
+    MSEFallCosAngle,
+    MSEFallSinAngle,
+    MSEFallHorizontalSpeed,
+    MSESplineElevation,
+
+    MSECounter,
+
+    // Special
+    MSEZeroBit,         // writes bit value 1 or skips read bit
+    MSEOneBit,          // writes bit value 0 or skips read bit
+    MSEFlushBits,       // flushes bits
+    MSEEnd,             // marks end of parsing
+    MSEExtraElement,    // Used to signalize reading into ExtraMovementStatusElement, element sequence inside it is declared as separate array
+                        // Allowed internal elements are: GUID markers (not transport), MSEExtraFloat, MSEExtraInt8
+    MSEExtraFloat,
+    MSEExtraInt8,
+    MSEExtraTwoBits,
+};
+
+namespace Movement
+{
+    // Values carried by a movement status block, decoupled from Unit and MovementInfo so serializers do not depend on entity code
+    struct MovementStatus
+    {
+        std::array<uint8, 8> Guid = { };
+        std::array<uint8, 8> TransportGuid = { };
+        uint32 Flags = 0;
+        uint16 Flags2 = 0;
+        uint32 Time = 0;
+        float PositionX = 0.0f;
+        float PositionY = 0.0f;
+        float PositionZ = 0.0f;
+        float Orientation = 0.0f;
+        float TransportPositionX = 0.0f;
+        float TransportPositionY = 0.0f;
+        float TransportPositionZ = 0.0f;
+        float TransportOrientation = 0.0f;
+        int8 TransportSeat = -1;
+        uint32 TransportTime = 0;
+        uint32 TransportTime2 = 0;
+        uint32 TransportVehicleId = 0;
+        float Pitch = 0.0f;
+        uint32 FallTime = 0;
+        float FallVerticalSpeed = 0.0f;
+        float FallCosAngle = 0.0f;
+        float FallSinAngle = 0.0f;
+        float FallHorizontalSpeed = 0.0f;
+        float SplineElevation = 0.0f;
+        uint32 Counter = 0;
+
+        bool HasMovementFlags = false;
+        bool HasMovementFlags2 = false;
+        bool HasTimestamp = false;
+        bool HasOrientation = false;
+        bool HasTransportData = false;
+        bool HasTransportTime2 = false;
+        bool HasTransportVehicleId = false;
+        bool HasPitch = false;
+        bool HasFallData = false;
+        bool HasFallDirection = false;
+        bool HasSplineElevation = false;
+        bool HasSpline = false;
+        bool HeightChangeFailed = false;
+
+        static std::array<uint8, 8> GuidToBytes(uint64 guid)
+        {
+            std::array<uint8, 8> bytes;
+            for (std::size_t i = 0; i < bytes.size(); ++i)
+                bytes[i] = uint8(guid >> (i * 8));
+            return bytes;
+        }
+
+        static uint64 GuidFromBytes(std::array<uint8, 8> const& bytes)
+        {
+            uint64 guid = 0;
+            for (std::size_t i = 0; i < bytes.size(); ++i)
+                guid |= uint64(bytes[i]) << (i * 8);
+            return guid;
+        }
+    };
+
+    template<MovementStatusElements Element>
+    constexpr bool IsGuidMaskElement = Element >= MSEHasGuidByte0 && Element <= MSEHasGuidByte7;
+
+    template<MovementStatusElements Element>
+    constexpr bool IsGuidByteElement = Element >= MSEGuidByte0 && Element <= MSEGuidByte7;
+
+    template<MovementStatusElements Element>
+    constexpr bool IsTransportGuidMaskElement = Element >= MSEHasTransportGuidByte0 && Element <= MSEHasTransportGuidByte7;
+
+    template<MovementStatusElements Element>
+    constexpr bool IsTransportGuidByteElement = Element >= MSETransportGuidByte0 && Element <= MSETransportGuidByte7;
+
+    template<MovementStatusElements Element>
+    constexpr bool IsUnsupportedElement = false;
+
+    /**
+     * Reads and writes the movement status block described by Sequence (an array terminated by MSEEnd).
+     * The sequence is unrolled at compile time, each element becomes straight line code and only the
+     * checks depending on packet contents (has transport, has fall data...) remain at runtime.
+     * Extras is the type handling MSEExtraElement, usually ExtraMovementStatusElement.
+     */
+    template<MovementStatusElements const* Sequence>
+    class MovementStatusSerializer
+    {
+    public:
+        static constexpr std::size_t Length = []()
+        {
+            std::size_t length = 0;
+            while (Sequence[length] != MSEEnd)
+                ++length;
+            return length;
+        }();
+
+        template<class Extras>
+        static void Read(ByteBuffer& data, MovementStatus& status, Extras* extras)
+        {
+            ReadElements(data, status, extras, std::make_index_sequence<Length>());
+        }
+
+        template<class Extras>
+        static void Write(ByteBuffer& data, MovementStatus const& status, Extras* extras)
+        {
+            WriteElements(data, status, extras, std::make_index_sequence<Length>());
+        }
+
+    private:
+        template<class Extras, std::size_t... Indexes>
+        static void ReadElements(ByteBuffer& data, MovementStatus& status, Extras* extras, std::index_sequence<Indexes...>)
+        {
+            (ReadElement<Sequence[Indexes]>(data, status, extras), ...);
+        }
+
+        template<class Extras, std::size_t... Indexes>
+        static void WriteElements(ByteBuffer& data, MovementStatus const& status, Extras* extras, std::index_sequence<Indexes...>)
+        {
+            (WriteElement<Sequence[Indexes]>(data, status, extras), ...);
+        }
+
+        template<MovementStatusElements Element, class Extras>
+        static void ReadElement(ByteBuffer& data, MovementStatus& status, Extras* extras)
+        {
+            if constexpr (IsGuidMaskElement<Element>)
+                status.Guid[Element - MSEHasGuidByte0] = data.ReadBit();
+            else if constexpr (IsTransportGuidMaskElement<Element>)
+            {
+                if (status.HasTransportData)
+                    status.TransportGuid[Element - MSEHasTransportGuidByte0] = data.ReadBit();
+            }
+            else if constexpr (IsGuidByteElement<Element>)
+                data.ReadByteSeq(status.Guid[Element - MSEGuidByte0]);
+            else if constexpr (IsTransportGuidByteElement<Element>)
+            {
+                if (status.HasTransportData)
+                    data.ReadByteSeq(status.TransportGuid[Element - MSETransportGuidByte0]);
+            }
+            else if constexpr (Element == MSEHasMovementFlags)
+                status.HasMovementFlags = !data.ReadBit();
+            else if constexpr (Element == MSEHasMovementFlags2)
+                status.HasMovementFlags2 = !data.ReadBit();
+            else if constexpr (Element == MSEHasTimestamp)
+                status.HasTimestamp = !data.ReadBit();
+            else if constexpr (Element == MSEHasOrientation)
+                status.HasOrientation = !data.ReadBit();
+            else if constexpr (Element == MSEHasTransportData)
+                status.HasTransportData = data.ReadBit();
+            else if constexpr (Element == MSEHasTransportTime2)
+            {
+                if (status.HasTransportData)
+                    status.HasTransportTime2 = data.ReadBit();
+            }
+            else if constexpr (Element == MSEHasVehicleId)
+            {
+                if (status.HasTransportData)
+                    status.HasTransportVehicleId = data.ReadBit();
+            }
+            else if constexpr (Element == MSEHasPitch)
+                status.HasPitch = !data.ReadBit();
+            else if constexpr (Element == MSEHasFallData)
+                status.HasFallData = data.ReadBit();
+            else if constexpr (Element == MSEHasFallDirection)
+            {
+                if (status.HasFallData)
+                    status.HasFallDirection = data.ReadBit();
+            }
+            else if constexpr (Element == MSEHasSplineElevation)
+                status.HasSplineElevation = !data.ReadBit();
+            else if constexpr (Element == MSEHasSpline)
+                status.HasSpline = data.ReadBit();
+            else if constexpr (Element == MSEHasHeightChangeFailed)
+                status.HeightChangeFailed = data.ReadBit();
+            else if constexpr (Element == MSEMovementFlags)
+            {
+                if (status.HasMovementFlags)
+                    status.Flags = data.ReadBits(30);
+            }
+            else if constexpr (Element == MSEMovementFlags2)
+            {
+                if (status.HasMovementFlags2)
+                    status.Flags2 = data.ReadBits(12);
+            }
+            else if constexpr (Element == MSETimestamp)
+            {
+                if (status.HasTimestamp)
+                    data >> status.Time;
+            }
+            else if constexpr (Element == MSEPositionX)
+                data >> status.PositionX;
+            else if constexpr (Element == MSEPositionY)
+                data >> status.PositionY;
+            else if constexpr (Element == MSEPositionZ)
+                data >> status.PositionZ;
+            else if constexpr (Element == MSEOrientation)
+            {
+                if (status.HasOrientation)
+                    status.Orientation = data.read<float>();
+            }
+            else if constexpr (Element == MSETransportPositionX)
+            {
+                if (status.HasTransportData)
+                    data >> status.TransportPositionX;
+            }
+            else if constexpr (Element == MSETransportPositionY)
+            {
+                if (status.HasTransportData)
+                    data >> status.TransportPositionY;
+            }
+            else if constexpr (Element == MSETransportPositionZ)
+            {
+                if (status.HasTransportData)
+                    data >> status.TransportPositionZ;
+            }
+            else if constexpr (Element == MSETransportOrientation)
+            {
+                if (status.HasTransportData)
+                    status.TransportOrientation = data.read<float>();
+            }
+            else if constexpr (Element == MSETransportSeat)
+            {
+                if (status.HasTransportData)
+                    data >> status.TransportSeat;
+            }
+            else if constexpr (Element == MSETransportTime)
+            {
+                if (status.HasTransportData)
+                    data >> status.TransportTime;
+            }
+            else if constexpr (Element == MSETransportTime2)
+            {
+                if (status.HasTransportData && status.HasTransportTime2)
+                    data >> status.TransportTime2;
+            }
+            else if constexpr (Element == MSETransportVehicleId)
+            {
+                if (status.HasTransportData && status.HasTransportVehicleId)
+                    data >> status.TransportVehicleId;
+            }
+            else if constexpr (Element == MSEPitch)
+            {
+                if (status.HasPitch)
+                    status.Pitch = data.read<float>();
+            }
+            else if constexpr (Element == MSEFallTime)
+            {
+                if (status.HasFallData)
+                    data >> status.FallTime;
+            }
+            else if constexpr (Element == MSEFallVerticalSpeed)
+            {
+                if (status.HasFallData)
+                    data >> status.FallVerticalSpeed;
+            }
+            else if constexpr (Element == MSEFallCosAngle)
+            {
+                if (status.HasFallData && status.HasFallDirection)
+                    data >> status.FallCosAngle;
+            }
+            else if constexpr (Element == MSEFallSinAngle)
+            {
+                if (status.HasFallData && status.HasFallDirection)
+                    data >> status.FallSinAngle;
+            }
+            else if constexpr (Element == MSEFallHorizontalSpeed)
+            {
+                if (status.HasFallData && status.HasFallDirection)
+                    data >> status.FallHorizontalSpeed;
+            }
+            else if constexpr (Element == MSESplineElevation)
+            {
+                if (status.HasSplineElevation)
+                    data >> status.SplineElevation;
+            }
+            else if constexpr (Element == MSECounter)
+                data >> status.Counter;
+            else if constexpr (Element == MSEZeroBit || Element == MSEOneBit)
+                data.ReadBit();
+            else if constexpr (Element == MSEExtraElement)
+                extras->ReadNextElement(data);
+            else
+                static_assert(IsUnsupportedElement<Element>, "Element cannot be read from a movement status block");
+        }
+
+        template<MovementStatusElements Element, class Extras>
+        static void WriteElement(ByteBuffer& data, MovementStatus const& status, Extras* extras)
+        {
+            if constexpr (IsGuidMaskElement<Element>)
+                data.WriteBit(status.Guid[Element - MSEHasGuidByte0]);
+            else if constexpr (IsTransportGuidMaskElement<Element>)
+            {
+                if (status.HasTransportData)
+                    data.WriteBit(status.TransportGuid[Element - MSEHasTransportGuidByte0]);
+            }
+            else if constexpr (IsGuidByteElement<Element>)
+                data.WriteByteSeq(status.Guid[Element - MSEGuidByte0]);
+            else if constexpr (IsTransportGuidByteElement<Element>)
+            {
+                if (status.HasTransportData)
+                    data.WriteByteSeq(status.TransportGuid[Element - MSETransportGuidByte0]);
+            }
+            else if constexpr (Element == MSEHasMovementFlags)
+                data.WriteBit(!status.HasMovementFlags);
+            else if constexpr (Element == MSEHasMovementFlags2)
+                data.WriteBit(!status.HasMovementFlags2);
+            else if constexpr (Element == MSEHasTimestamp)
+                data.WriteBit(!status.HasTimestamp);
+            else if constexpr (Element == MSEHasOrientation)
+                data.WriteBit(!status.HasOrientation);
+            else if constexpr (Element == MSEHasTransportData)
+                data.WriteBit(status.HasTransportData);
+            else if constexpr (Element == MSEHasTransportTime2)
+            {
+                if (status.HasTransportData)
+                    data.WriteBit(status.HasTransportTime2);
+            }
+            else if constexpr (Element == MSEHasVehicleId)
+            {
+                if (status.HasTransportData)
+                    data.WriteBit(status.HasTransportVehicleId);
+            }
+            else if constexpr (Element == MSEHasPitch)
+                data.WriteBit(!status.HasPitch);
+            else if constexpr (Element == MSEHasFallData)
+                data.WriteBit(status.HasFallData);
+            else if constexpr (Element == MSEHasFallDirection)
+            {
+                if (status.HasFallData)
+                    data.WriteBit(status.HasFallDirection);
+            }
+            else if constexpr (Element == MSEHasSplineElevation)
+                data.WriteBit(!status.HasSplineElevation);
+            else if constexpr (Element == MSEHasSpline)
+                data.WriteBit(status.HasSpline);
+            else if constexpr (Element == MSEHasHeightChangeFailed)
+                data.WriteBit(status.HeightChangeFailed);
+            else if constexpr (Element == MSEMovementFlags)
+            {
+                if (status.HasMovementFlags)
+                    data.WriteBits(status.Flags, 30);
+            }
+            else if constexpr (Element == MSEMovementFlags2)
+            {
+                if (status.HasMovementFlags2)
+                    data.WriteBits(status.Flags2, 12);
+            }
+            else if constexpr (Element == MSETimestamp)
+            {
+                if (status.HasTimestamp)
+                    data << status.Time;
+            }
+            else if constexpr (Element == MSEPositionX)
+                data << status.PositionX;
+            else if constexpr (Element == MSEPositionY)
+                data << status.PositionY;
+            else if constexpr (Element == MSEPositionZ)
+                data << status.PositionZ;
+            else if constexpr (Element == MSEOrientation)
+            {
+                if (status.HasOrientation)
+                    data << status.Orientation;
+            }
+            else if constexpr (Element == MSETransportPositionX)
+            {
+                if (status.HasTransportData)
+                    data << status.TransportPositionX;
+            }
+            else if constexpr (Element == MSETransportPositionY)
+            {
+                if (status.HasTransportData)
+                    data << status.TransportPositionY;
+            }
+            else if constexpr (Element == MSETransportPositionZ)
+            {
+                if (status.HasTransportData)
+                    data << status.TransportPositionZ;
+            }
+            else if constexpr (Element == MSETransportOrientation)
+            {
+                if (status.HasTransportData)
+                    data << status.TransportOrientation;
+            }
+            else if constexpr (Element == MSETransportSeat)
+            {
+                if (status.HasTransportData)
+                    data << status.TransportSeat;
+            }
+            else if constexpr (Element == MSETransportTime)
+            {
+                if (status.HasTransportData)
+                    data << status.TransportTime;
+            }
+            else if constexpr (Element == MSETransportTime2)
+            {
+                if (status.HasTransportData && status.HasTransportTime2)
+                    data << status.TransportTime2;
+            }
+            else if constexpr (Element == MSETransportVehicleId)
+            {
+                if (status.HasTransportData && status.HasTransportVehicleId)
+                    data << status.TransportVehicleId;
+            }
+            else if constexpr (Element == MSEPitch)
+            {
+                if (status.HasPitch)
+                    data << status.Pitch;
+            }
+            else if constexpr (Element == MSEFallTime)
+            {
+                if (status.HasFallData)
+                    data << status.FallTime;
+            }
+            else if constexpr (Element == MSEFallVerticalSpeed)
+            {
+                if (status.HasFallData)
+                    data << status.FallVerticalSpeed;
+            }
+            else if constexpr (Element == MSEFallCosAngle)
+            {
+                if (status.HasFallData && status.HasFallDirection)
+                    data << status.FallCosAngle;
+            }
+            else if constexpr (Element == MSEFallSinAngle)
+            {
+                if (status.HasFallData && status.HasFallDirection)
+                    data << status.FallSinAngle;
+            }
+            else if constexpr (Element == MSEFallHorizontalSpeed)
+            {
+                if (status.HasFallData && status.HasFallDirection)
+                    data << status.FallHorizontalSpeed;
+            }
+            else if constexpr (Element == MSESplineElevation)
+            {
+                if (status.HasSplineElevation)
+                    data << status.SplineElevation;
+            }
+            else if constexpr (Element == MSECounter)
+                data << status.Counter;
+            else if constexpr (Element == MSEZeroBit)
+                data.WriteBit(0);
+            else if constexpr (Element == MSEOneBit)
+                data.WriteBit(1);
+            else if constexpr (Element == MSEFlushBits)
+                data.FlushBits();
+            else if constexpr (Element == MSEExtraElement)
+                extras->WriteNextElement(data);
+            else
+                static_assert(IsUnsupportedElement<Element>, "Element cannot be written to a movement status block");
+        }
+    };
+}
+
+#endif
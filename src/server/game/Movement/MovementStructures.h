@@ -18,97 +18,12 @@
 #ifndef _MOVEMENT_STRUCTURES_H
 #define _MOVEMENT_STRUCTURES_H
 
+#include "MovementStatusSerializer.h"
 #include "Opcodes.h"
 #include "Object.h"
 
-class ByteBuffer;
 class Unit;
 
-enum MovementStatusElements
-{
-    MSEHasGuidByte0,
-    MSEHasGuidByte1,
-    MSEHasGuidByte2,
-    MSEHasGuidByte3,
-    MSEHasGuidByte4,
-    MSEHasGuidByte5,
-    MSEHasGuidByte6,
-    MSEHasGuidByte7,
-    MSEHasMovementFlags,
-    MSEHasMovementFlags2,
-    MSEHasTimestamp,
-    MSEHasOrientation,
-    MSEHasTransportData,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportTime2,
-    MSEHasVehicleId,
-    MSEHasPitch,
-    MSEHasFallData,
-    MSEHasFallDirection,
-    MSEHasSplineElevation,
-    MSEHasSpline,
-    MSEHasHeightChangeFailed,
-
-    MSEGuidByte0,
-    MSEGuidByte1,
-    MSEGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSEGuidByte7,
-    MSEMovementFlags,
-    MSEMovementFlags2,
-    MSETimestamp,
-    MSEPositionX,
-    MSEPositionY,
-    MSEPositionZ,
-    MSEOrientation,
-    MSETransportGuidByte0,
-    MSETransportGuidByte1,
-    MSETransportGuidByte2,
-    MSETransportGuidByte3,
-    MSETransportGuidByte4,
-    MSETransportGuidByte5,
-    MSETransportGuidByte6,
-    MSETransportGuidByte7,
-    MSETransportPositionX,
-    MSETransportPositionY,
-    MSETransportPositionZ,
-    MSETransportOrientation,
-    MSETransportSeat,
-    MSETransportTime,
-    MSETransportTime2,
-    MSETransportVehicleId,
-    MSEPitch,
-    MSEFallTime,
-    MSEFallVerticalSpeed,
-    MSEFallCosAngle,
-    MSEFallSinAngle,
-    MSEFallHorizontalSpeed,
-    MSESplineElevation,
-
-    MSECounter,
-
-    // Special
-    MSEZeroBit,         // writes bit value 1 or skips read bit
-    MSEOneBit,          // writes bit value 0 or skips read bit
-    MSEFlushBits,       // flushes bits
-    MSEEnd,             // marks end of parsing
-    MSEExtraElement,    // Used to signalize reading into ExtraMovementStatusElement, element sequence inside it is declared as separate array
-                        // Allowed internal elements are: GUID markers (not transport), MSEExtraFloat, MSEExtraInt8
-    MSEExtraFloat,
-    MSEExtraInt8,
-    MSEExtraTwoBits,
-};
-
 namespace Movement
 {
     class PacketSender;
@@ -153,8 +68,13 @@ namespace Movement
     };
 
     bool PrintInvalidSequenceElement(MovementStatusElements element, char const* function);
-}
 
-MovementStatusElements const* GetMovementStatusElementsSequence(uint32 opcode);
+    typedef void(*MovementStatusReader)(ByteBuffer& data, MovementStatus& status, ExtraMovementStatusElement* extras);
+    typedef void(*MovementStatusWriter)(ByteBuffer& data, MovementStatus const& status, ExtraMovementStatusElement* extras);
+
+    // nullptr if opcode carries no movement status block (readers only exist for opcodes sent by the client)
+    MovementStatusReader GetMovementStatusReader(uint32 opcode);
+    MovementStatusWriter GetMovementStatusWriter(uint32 opcode);
+}
 
 #endif
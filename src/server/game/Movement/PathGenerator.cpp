@@ -29,32 +29,49 @@
 #include "DetourNavMeshQuery.h"
 #include "Metric.h"
 #include "PhasingHandler.h"
+#include "ThreadPool.h"
+
+namespace
+{
+    std::unique_ptr<Trinity::ThreadPool> PathfindingThreads;
+}
 
 ////////////////// PathGenerator //////////////////
 PathGenerator::PathGenerator(WorldObject const* owner) :
     _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false),
     _forceDestination(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false),
-    _endPosition(G3D::Vector3::zero()), _source(owner), _navMesh(nullptr),
-    _navMeshQuery(nullptr)
+    _endPosition(G3D::Vector3::zero()), _source(owner), _sourceGuid(owner->GetGUID()), _navMeshMapId(0), _navMesh(nullptr),
+    _normalizePending(false), _pointPathPending(false), _asyncDone(false)
 {
     memset(_pathPolyRefs, 0, sizeof(_pathPolyRefs));
 
-    TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::PathGenerator for %u", _source->GetGUID().GetCounter());
+    TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::PathGenerator for %u", _sourceGuid.GetCounter());
 
     uint32 mapId = PhasingHandler::GetTerrainMapId(_source->GetPhaseShift(), _source->GetMapId(), _source->GetMap()->GetTerrain(), _source->GetPositionX(), _source->GetPositionY());
     if (DisableMgr::IsPathfindingEnabled(mapId))
     {
-        MMAP::MMapManager* mmap = MMAP::MMapFactory::createOrGetMMapManager();
-        _navMeshQuery = mmap->GetNavMeshQuery(mapId, _source->GetMapId(), _source->GetInstanceId());
-        _navMesh = _navMeshQuery ? _navMeshQuery->getAttachedNavMesh() : mmap->GetNavMesh(mapId);
+        _navMeshMapId = mapId;
+        _navMesh = MMAP::MMapFactory::createOrGetMMapManager()->GetNavMesh(mapId);
     }
 
     CreateFilter();
 }
 
+PathGenerator::PathGenerator(PathGenerator const& owner, MMAP::NavMeshQueryHandle navMeshQuery, AsyncSourceInfo const& sourceInfo) :
+    _polyLength(owner._polyLength), _type(owner._type), _useStraightPath(owner._useStraightPath),
+    _forceDestination(owner._forceDestination), _pointPathLimit(owner._pointPathLimit), _useRaycast(owner._useRaycast),
+    _startPosition(owner._startPosition), _endPosition(owner._endPosition), _actualEndPosition(owner._actualEndPosition),
+    _source(owner._source), _sourceGuid(owner._sourceGuid), _navMeshMapId(owner._navMeshMapId), _navMesh(owner._navMesh),
+    _navMeshQuery(std::move(navMeshQuery)), _filter(owner._filter), _asyncSource(sourceInfo),
+    _normalizePending(false), _pointPathPending(false), _asyncDone(false)
+{
+    // the previous poly path is reused if the new one starts on it
+    memcpy(_pathPolyRefs, owner._pathPolyRefs, sizeof(_pathPolyRefs));
+}
+
 PathGenerator::~PathGenerator()
 {
-    TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::~PathGenerator() for %u", _source->GetGUID().GetCounter());
+    TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::~PathGenerator() for %u", _sourceGuid.GetCounter());
 }
 
 bool PathGenerator::CalculatePath(float destX, float destY, float destZ, bool forceDest /*= false*/)
@@ -74,35 +91,232 @@ bool PathGenerator::CalculatePath(Position const& startPosition, Position const&
 
 bool PathGenerator::CalculatePath(G3D::Vector3 const& startPoint, G3D::Vector3 const& endPoint, bool forceDest /*= false*/)
 {
+    CancelPendingPath();
+
     if (!Trinity::IsValidMapCoord(startPoint.x, startPoint.y, startPoint.z) || !Trinity::IsValidMapCoord(endPoint.x, endPoint.y, endPoint.z))
         return false;
 
     TC_METRIC_EVENT("mmap_events", "CalculatePath", "");
 
+    if (!StartPath(startPoint, endPoint, forceDest))
+        return true;
+
+    {
+        // grids loaded by other threads may add tiles to the nav mesh meanwhile
+        std::shared_lock<std::shared_mutex> lock = _navMeshQuery.LockNavMesh();
+        BuildPolyPath(startPoint, endPoint);
+    }
+
+    // return the query to the pool
+    _navMeshQuery = {};
+    return true;
+}
+
+bool PathGenerator::CalculatePathAsync(float destX, float destY, float destZ, bool forceDest /*= false*/)
+{
+    return CalculatePathAsync(PositionToVector3(_source->GetPosition()), G3D::Vector3(destX, destY, destZ), forceDest);
+}
+
+bool PathGenerator::CalculatePathAsync(Position const& startPosition, Position const& destination, bool forceDest /*= false*/)
+{
+    return CalculatePathAsync(PositionToVector3(startPosition), PositionToVector3(destination), forceDest);
+}
+
+bool PathGenerator::CalculatePathAsync(G3D::Vector3 const& startPoint, G3D::Vector3 const& endPoint, bool forceDest /*= false*/)
+{
+    if (!PathfindingThreads)
+        return CalculatePath(startPoint, endPoint, forceDest);
+
+    CancelPendingPath();
+
+    if (!Trinity::IsValidMapCoord(startPoint.x, startPoint.y, startPoint.z) || !Trinity::IsValidMapCoord(endPoint.x, endPoint.y, endPoint.z))
+        return false;
+
+    TC_METRIC_EVENT("mmap_events", "CalculatePathAsync", "");
+
+    if (!StartPath(startPoint, endPoint, forceDest))
+        return true;
+
+    // everything BuildPolyPath needs from the source or the map has to be known before leaving the map thread
+    AsyncSourceInfo sourceInfo;
+    sourceInfo.AllowedPolyDist = GetAllowedPolyDist();
+    {
+        // same points BuildShortcut would produce
+        G3D::Vector3 start = GetStartPosition();
+        G3D::Vector3 end = GetEndPosition();
+        _source->UpdateAllowedPositionZ(start.x, start.y, start.z);
+        _source->UpdateAllowedPositionZ(end.x, end.y, end.z);
+        sourceInfo.ShortcutOverHole = CanShortcutOverHole(start, end);
+    }
+    sourceInfo.ShortcutFarFromPoly[0] = CanShortcutFarFromPoly(true);
+    sourceInfo.ShortcutFarFromPoly[1] = CanShortcutFarFromPoly(false);
+
+    _pendingPath.reset(new PathGenerator(*this, std::move(_navMeshQuery), sourceInfo));
+    PathfindingThreads->PostWork([path = _pendingPath]()
+    {
+        path->BuildPolyPathAsync();
+    });
+
+    return true;
+}
+
+bool PathGenerator::UpdatePendingPath()
+{
+    if (!_pendingPath || !_pendingPath->_asyncDone.load(std::memory_order_acquire))
+        return false;
+
+    std::shared_ptr<PathGenerator> path = std::move(_pendingPath);
+    memcpy(_pathPolyRefs, path->_pathPolyRefs, sizeof(_pathPolyRefs));
+    _polyLength = path->_polyLength;
+    _pathPoints = std::move(path->_pathPoints);
+    _type = path->_type;
+    _actualEndPosition = path->_actualEndPosition;
+
+    // the parts of building the path that read the terrain
+    if (path->_pointPathPending)
+        FinishPointPath();
+    else if (path->_normalizePending)
+        NormalizePath();
+
+    return true;
+}
+
+void PathGenerator::StartPathfindingThreads(uint32 numThreads)
+{
+    if (numThreads)
+        PathfindingThreads = std::make_unique<Trinity::ThreadPool>(numThreads);
+}
+
+void PathGenerator::StopPathfindingThreads()
+{
+    if (!PathfindingThreads)
+        return;
+
+    PathfindingThreads->Join();
+    PathfindingThreads = nullptr;
+}
+
+// sets up a new path and takes a nav mesh query for it
+// returns false if the nav mesh can't be used, a shortcut is built instead
+bool PathGenerator::StartPath(G3D::Vector3 const& startPoint, G3D::Vector3 const& endPoint, bool forceDest)
+{
     SetEndPosition(endPoint);
     SetStartPosition(startPoint);
 
     _forceDestination = forceDest;
 
-    TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::CalculatePath() for %u", _source->GetGUID().GetCounter());
+    TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::CalculatePath() for %u", _sourceGuid.GetCounter());
 
     // make sure navMesh works - we can run on map w/o mmap
     // check if the start and end point have a .mmtile loaded (can we pass via not loaded tile on the way?)
     const Unit* _sourceUnit = _source->ToUnit();
-    if (!_navMesh || !_navMeshQuery || (_sourceUnit && _sourceUnit->HasUnitState(UNIT_STATE_IGNORE_PATHFINDING)) ||
-        !HaveTile(startPoint) || !HaveTile(endPoint))
+    if (_navMesh && !(_sourceUnit && _sourceUnit->HasUnitState(UNIT_STATE_IGNORE_PATHFINDING)))
+        _navMeshQuery = MMAP::MMapFactory::createOrGetMMapManager()->AcquireNavMeshQuery(_navMeshMapId);
+
+    if (_navMeshQuery)
+    {
+        bool haveTiles;
+        {
+            std::shared_lock<std::shared_mutex> lock = _navMeshQuery.LockNavMesh();
+            haveTiles = HaveTile(startPoint) && HaveTile(endPoint);
+        }
+
+        if (!haveTiles)
+            _navMeshQuery = {};
+    }
+
+    if (!_navMeshQuery)
     {
         BuildShortcut();
         _type = PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH);
-        return true;
+        return false;
     }
 
     UpdateFilter();
+    return true;
+}
+
+void PathGenerator::BuildPolyPathAsync()
+{
+    {
+        // tiles can't be added to or removed from the nav mesh while searching it
+        std::shared_lock<std::shared_mutex> lock = _navMeshQuery.LockNavMesh();
+        BuildPolyPath(_startPosition, _endPosition);
+    }
+
+    _navMeshQuery = {};
+    _asyncDone.store(true, std::memory_order_release);
+}
+
+float PathGenerator::GetAllowedPolyDist() const
+{
+    if (_asyncSource)
+        return _asyncSource->AllowedPolyDist;
+
+    // we may need a better number here
+    float allowedPolyDist = 7.0f;
+    if (Unit const* unit = _source->ToUnit())
+        if (unit->IsHovering()) // some hovering units hover above the original 7.0f threshold so we have to take their hover offset into consideration
+            allowedPolyDist = std::max(allowedPolyDist, unit->GetHoverOffset());
+
+    return allowedPolyDist;
+}
+
+// can a shortcut be used if there is a hole in the mesh at the start or end point
+bool PathGenerator::CanShortcutOverHole(G3D::Vector3 const& start, G3D::Vector3 const& end) const
+{
+    if (_asyncSource)
+        return _asyncSource->ShortcutOverHole;
+
+    Creature const* creature = _source->ToCreature();
+    if (!creature)
+        return false;
+
+    if (creature->CanFly())
+        return true;
+
+    if (!creature->CanEnterWater())
+        return false;
+
+    // Check both start and end points, if they're both in water, then we can *safely* let the creature move
+    for (G3D::Vector3 const& point : { start, end })
+    {
+        ZLiquidStatus status = _source->GetMap()->GetLiquidStatus(_source->GetPhaseShift(), point.x, point.y, point.z, map_liquidHeaderTypeFlags::AllLiquids, nullptr, _source->GetCollisionHeight());
+        // One of the points is not in the water, cancel movement.
+        if (status == LIQUID_MAP_NO_WATER)
+            return false;
+    }
 
-    BuildPolyPath(startPoint, endPoint);
     return true;
 }
 
+// can a shortcut be used if the start (or end) point is far from the mesh
+bool PathGenerator::CanShortcutFarFromPoly(bool start) const
+{
+    if (_asyncSource)
+        return _asyncSource->ShortcutFarFromPoly[start ? 0 : 1];
+
+    Unit const* unit = _source->ToUnit();
+    if (!unit)
+        return false;
+
+    bool underWaterShortcut = unit->CanSwim();
+    // Allow to build a shortcut if the unit is falling and it's trying to move downwards towards a target (i.e. charging)
+    bool flyingShortcut = unit->CanFly() || (unit->IsFalling() && _endPosition.z < _startPosition.z);
+    if (underWaterShortcut == flyingShortcut)
+        return flyingShortcut;
+
+    G3D::Vector3 const& p = start ? _startPosition : _endPosition;
+    if (_source->GetMap()->IsUnderWater(_source->GetPhaseShift(), p.x, p.y, p.z))
+    {
+        TC_LOG_DEBUG("maps.mmaps", "++ BuildPolyPath :: underWater case");
+        return underWaterShortcut;
+    }
+
+    TC_LOG_DEBUG("maps.mmaps", "++ BuildPolyPath :: flying case");
+    return flyingShortcut;
+}
+
 dtPolyRef PathGenerator::GetPathPolyByPosition(dtPolyRef const* polyPath, uint32 polyPathSize, float const* point, float* distance) const
 {
     if (!polyPath || !polyPathSize)
@@ -189,25 +403,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
     {
         TC_LOG_DEBUG("maps.mmaps", "++ BuildPolyPath :: (startPoly == 0 || endPoly == 0)");
         BuildShortcut();
-        bool path = _source->GetTypeId() == TYPEID_UNIT && _source->ToCreature()->CanFly();
-
-        bool waterPath = _source->GetTypeId() == TYPEID_UNIT && _source->ToCreature()->CanEnterWater();
-        if (waterPath)
-        {
-            // Check both start and end points, if they're both in water, then we can *safely* let the creature move
-            for (uint32 i = 0; i < _pathPoints.size(); ++i)
-            {
-                ZLiquidStatus status = _source->GetMap()->GetLiquidStatus(_source->GetPhaseShift(), _pathPoints[i].x, _pathPoints[i].y, _pathPoints[i].z, map_liquidHeaderTypeFlags::AllLiquids, nullptr, _source->GetCollisionHeight());
-                // One of the points is not in the water, cancel movement.
-                if (status == LIQUID_MAP_NO_WATER)
-                {
-                    waterPath = false;
-                    break;
-                }
-            }
-        }
-
-        if (path || waterPath)
+        if (CanShortcutOverHole(_pathPoints[0], _pathPoints[1]))
         {
             _type = PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH);
             return;
@@ -221,42 +417,14 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         }
     }
 
-    // we may need a better number here
-    float allowedPolyDist = 7.0f;
-    if (Unit const* unit = _source->ToUnit())
-        if (unit->IsHovering()) // some hovering units hover above the original 7.0f threshold so we have to take their hover offset into consideration
-            allowedPolyDist = std::max(allowedPolyDist, unit->GetHoverOffset());
-
+    float allowedPolyDist = GetAllowedPolyDist();
     bool startFarFromPoly = distToStartPoly > allowedPolyDist;
     bool endFarFromPoly = distToEndPoly > allowedPolyDist;
     if (startFarFromPoly || endFarFromPoly)
     {
         TC_LOG_DEBUG("maps.mmaps", "++ BuildPolyPath :: farFromPoly distToStartPoly=%.3f distToEndPoly=%.3f", distToStartPoly, distToEndPoly);
 
-        bool buildShotrcut = false;
-
-        G3D::Vector3 const& p = (distToStartPoly > 7.0f) ? startPos : endPos;
-        if (_source->GetMap()->IsUnderWater(_source->GetPhaseShift(), p.x, p.y, p.z))
-        {
-            TC_LOG_DEBUG("maps.mmaps", "++ BuildPolyPath :: underWater case");
-            if (const Unit* _sourceUnit = _source->ToUnit())
-                if (_sourceUnit->CanSwim())
-                    buildShotrcut = true;
-        }
-        else
-        {
-            TC_LOG_DEBUG("maps.mmaps", "++ BuildPolyPath :: flying case");
-            if (const Unit* _sourceUnit = _source->ToUnit())
-            {
-                if (_sourceUnit->CanFly())
-                    buildShotrcut = true;
-                // Allow to build a shortcut if the unit is falling and it's trying to move downwards towards a target (i.e. charging)
-                else if (_sourceUnit->IsFalling() && endPos.z < startPos.z)
-                    buildShotrcut = true;
-            }
-        }
-
-        if (buildShotrcut)
+        if (CanShortcutFarFromPoly(distToStartPoly > 7.0f))
         {
             BuildShortcut();
             _type = PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH);
@@ -322,7 +490,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
                 TC_LOG_ERROR("maps.mmaps", "Invalid poly ref in BuildPolyPath. _polyLength: %u, pathStartIndex: %u,"
                                      " startPos: %s, endPos: %s, mapid: %u",
                                      _polyLength, pathStartIndex, startPos.toString().c_str(), endPos.toString().c_str(),
-                                     _source->GetMapId());
+                                     _navMeshMapId);
 
                 break;
             }
@@ -397,7 +565,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         dtStatus dtResult;
         if (_useRaycast)
         {
-            TC_LOG_ERROR("maps.mmaps", "PathGenerator::BuildPolyPath() called with _useRaycast with a previous path for unit %s", _source->GetGUID().ToString().c_str());
+            TC_LOG_ERROR("maps.mmaps", "PathGenerator::BuildPolyPath() called with _useRaycast with a previous path for unit %s", _sourceGuid.ToString().c_str());
             BuildShortcut();
             _type = PATHFIND_NOPATH;
             return;
@@ -420,7 +588,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
             // this is probably an error state, but we'll leave it
             // and hopefully recover on the next Update
             // we still need to copy our preffix
-            TC_LOG_ERROR("maps", "%u's Path Build failed: 0 length path", _source->GetGUID().GetCounter());
+            TC_LOG_ERROR("maps", "%u's Path Build failed: 0 length path", _sourceGuid.GetCounter());
         }
 
         TC_LOG_DEBUG("maps.mmaps", "++  m_polyLength=%u prefixPolyLength=%u suffixPolyLength=%u", _polyLength, prefixPolyLength, suffixPolyLength);
@@ -511,21 +679,37 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         }
         else
         {
-            dtResult = _navMeshQuery->findPath(
-                            startPoly,          // start polygon
-                            endPoly,            // end polygon
-                            startPoint,         // start position
-                            endPoint,           // end position
-                            &_filter,           // polygon search filter
-                            _pathPolyRefs,     // [out] path
-                            (int*)&_polyLength,
-                            MAX_PATH_LENGTH);   // max number of polygons in output path
+            // paths between the same polygons differ only slightly in their points, the poly path can be shared
+            MMAP::NavMeshPathCache* pathCache = _navMeshQuery.GetPathCache();
+            MMAP::NavMeshPathCache::Key pathCacheKey = { startPoly, endPoly, _filter.getIncludeFlags(), _filter.getExcludeFlags() };
+            _polyLength = pathCache ? pathCache->Find(pathCacheKey, _pathPolyRefs, MAX_PATH_LENGTH) : 0;
+            if (_polyLength)
+                dtResult = DT_SUCCESS;
+            else
+            {
+                uint32 pathCacheGeneration = pathCache ? pathCache->GetGeneration() : 0;
+                std::chrono::steady_clock::time_point searchStart = std::chrono::steady_clock::now();
+
+                dtResult = _navMeshQuery->findPath(
+                                startPoly,          // start polygon
+                                endPoly,            // end polygon
+                                startPoint,         // start position
+                                endPoint,           // end position
+                                &_filter,           // polygon search filter
+                                _pathPolyRefs,     // [out] path
+                                (int*)&_polyLength,
+                                MAX_PATH_LENGTH);   // max number of polygons in output path
+
+                if (pathCache && _polyLength && dtStatusSucceed(dtResult))
+                    pathCache->Insert(pathCacheKey, _pathPolyRefs, _polyLength,
+                        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - searchStart), pathCacheGeneration);
+            }
         }
 
         if (!_polyLength || dtStatusFailed(dtResult))
         {
             // only happens if we passed bad data to findPath(), or navmesh is messed up
-            TC_LOG_ERROR("maps", "%u's Path Build failed: 0 length path", _source->GetGUID().GetCounter());
+            TC_LOG_ERROR("maps", "%u's Path Build failed: 0 length path", _sourceGuid.GetCounter());
             BuildShortcut();
             _type = PATHFIND_NOPATH;
             return;
@@ -552,7 +736,7 @@ void PathGenerator::BuildPointPath(const float *startPoint, const float *endPoin
     if (_useRaycast)
     {
         // _straightLine uses raycast and it currently doesn't support building a point path, only a 2-point path with start and hitpoint/end is returned
-        TC_LOG_ERROR("maps.mmaps", "PathGenerator::BuildPointPath() called with _useRaycast for unit %s", _source->GetGUID().ToString().c_str());
+        TC_LOG_ERROR("maps.mmaps", "PathGenerator::BuildPointPath() called with _useRaycast for unit %s", _sourceGuid.ToString().c_str());
         BuildShortcut();
         _type = PATHFIND_NOPATH;
         return;
@@ -611,10 +795,22 @@ void PathGenerator::BuildPointPath(const float *startPoint, const float *endPoin
     for (uint32 i = 0; i < pointCount; ++i)
         _pathPoints[i] = G3D::Vector3(pathPoints[i*VERTEX_SIZE+2], pathPoints[i*VERTEX_SIZE], pathPoints[i*VERTEX_SIZE+1]);
 
+    // the rest needs the terrain, done by UpdatePendingPath on the map thread
+    if (_asyncSource)
+    {
+        _pointPathPending = true;
+        return;
+    }
+
+    FinishPointPath();
+}
+
+void PathGenerator::FinishPointPath()
+{
     NormalizePath();
 
     // first point is always our current location - we need the next one
-    SetActualEndPosition(_pathPoints[pointCount-1]);
+    SetActualEndPosition(_pathPoints.back());
 
     // force the given destination, if needed
     if (_forceDestination &&
@@ -635,11 +831,18 @@ void PathGenerator::BuildPointPath(const float *startPoint, const float *endPoin
         _type = PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH);
     }
 
-    TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::BuildPointPath path type %d size %d poly-size %d", _type, pointCount, _polyLength);
+    TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::BuildPointPath path type %d size %u poly-size %d", _type, uint32(_pathPoints.size()), _polyLength);
 }
 
 void PathGenerator::NormalizePath()
 {
+    // the terrain is only read on the map thread, done by UpdatePendingPath
+    if (_asyncSource)
+    {
+        _normalizePending = true;
+        return;
+    }
+
     for (uint32 i = 0; i < _pathPoints.size(); ++i)
         _source->UpdateAllowedPositionZ(_pathPoints[i].x, _pathPoints[i].y, _pathPoints[i].z);
 }
@@ -903,7 +1106,7 @@ dtStatus PathGenerator::FindSmoothPath(float const* startPos, float const* endPo
         npolys = FixupCorridor(polys, npolys, MAX_PATH_LENGTH, visited, nvisited);
 
         if (dtStatusFailed(_navMeshQuery->getPolyHeight(polys[0], result, &result[1])))
-            TC_LOG_DEBUG("maps.mmaps", "Cannot find height at position X: %f Y: %f Z: %f for unit %u", result[2], result[0], result[1], _source->GetEntry());
+            TC_LOG_DEBUG("maps.mmaps", "Cannot find height at position X: %f Y: %f Z: %f for unit %u", result[2], result[0], result[1], _sourceGuid.GetEntry());
         result[1] += 0.5f;
         dtVcopy(iterPos, result);
 
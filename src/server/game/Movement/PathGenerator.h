@@ -21,8 +21,13 @@
 #include "DetourNavMesh.h"
 #include "DetourNavMeshQuery.h"
 #include "MMapDefines.h"
+#include "MMapManager.h"
 #include "MoveSplineInitArgs.h"
+#include "ObjectGuid.h"
+#include "Optional.h"
 #include <G3D/Vector3.h>
+#include <atomic>
+#include <memory>
 
 class Unit;
 class WorldObject;
@@ -72,6 +77,17 @@ class TC_GAME_API PathGenerator
         bool CalculatePath(Position const& startPosition, Position const& destination, bool forceDest = false);
         // Calculates the path from start point to given destination
         bool CalculatePath(G3D::Vector3 const& startPoint, G3D::Vector3 const& endPoint, bool forceDest = false);
+
+        // Same as CalculatePath, but the navmesh is searched on a pathfinding thread if those are enabled
+        // IsPathPending is true until UpdatePendingPath takes over the result, the previous path is kept until then
+        bool CalculatePathAsync(float destX, float destY, float destZ, bool forceDest = false);
+        bool CalculatePathAsync(Position const& startPosition, Position const& destination, bool forceDest = false);
+        bool CalculatePathAsync(G3D::Vector3 const& startPoint, G3D::Vector3 const& endPoint, bool forceDest = false);
+        bool IsPathPending() const { return _pendingPath != nullptr; }
+        // called from the owner's update, returns true once the pending path replaced the previous one
+        bool UpdatePendingPath();
+        void CancelPendingPath() { _pendingPath = nullptr; }
+
         bool IsInvalidDestinationZ(Unit const* target) const;
 
         // option setters - use optional
@@ -91,7 +107,21 @@ class TC_GAME_API PathGenerator
         // shortens the path until the destination is the specified distance from the target point
         void ShortenPathUntilDist(G3D::Vector3 const& point, float dist);
 
+        // threads used by CalculatePathAsync, with 0 threads paths are always calculated by the caller
+        static void StartPathfindingThreads(uint32 numThreads);
+        static void StopPathfindingThreads();
+
     private:
+        // what BuildPolyPath has to know about the source, taken on the map thread for paths searched on a pathfinding thread
+        struct AsyncSourceInfo
+        {
+            float AllowedPolyDist;
+            bool ShortcutOverHole;
+            bool ShortcutFarFromPoly[2]; // start, end
+        };
+
+        // copy of owner searching a path on a pathfinding thread, must not access the source
+        PathGenerator(PathGenerator const& owner, MMAP::NavMeshQueryHandle navMeshQuery, AsyncSourceInfo const& sourceInfo);
 
         dtPolyRef _pathPolyRefs[MAX_PATH_LENGTH];   // array of detour polygon references
         uint32 _polyLength;                         // number of polygons in the path
@@ -109,11 +139,19 @@ class TC_GAME_API PathGenerator
         G3D::Vector3 _actualEndPosition;    // {x, y, z} of the closest possible point to given destination
 
         WorldObject const* const _source;       // the object that is moving
+        ObjectGuid const _sourceGuid;           // for logging, the source can be gone when a pathfinding thread finishes
+        uint32 _navMeshMapId;                   // map id of the nav mesh
         dtNavMesh const* _navMesh;              // the nav mesh
-        dtNavMeshQuery const* _navMeshQuery;    // the nav mesh query used to find the path
+        MMAP::NavMeshQueryHandle _navMeshQuery; // the nav mesh query used to find the path, only held while calculating it
 
         dtQueryFilter _filter;  // use single filter for all movements, update it when needed
 
+        Optional<AsyncSourceInfo> _asyncSource;     // set on copies searching on a pathfinding thread
+        bool _normalizePending;                     // path points still need NormalizePath on the map thread
+        bool _pointPathPending;                     // path points still need FinishPointPath on the map thread
+        std::atomic<bool> _asyncDone;
+        std::shared_ptr<PathGenerator> _pendingPath;
+
         void SetStartPosition(G3D::Vector3 const& point) { _startPosition = point; }
         void SetEndPosition(G3D::Vector3 const& point) { _actualEndPosition = point; _endPosition = point; }
         void SetActualEndPosition(G3D::Vector3 const& point) { _actualEndPosition = point; }
@@ -133,10 +171,17 @@ class TC_GAME_API PathGenerator
         dtPolyRef GetPolyByLocation(float const* Point, float* Distance) const;
         bool HaveTile(G3D::Vector3 const& p) const;
 
+        bool StartPath(G3D::Vector3 const& startPoint, G3D::Vector3 const& endPoint, bool forceDest);
+        void BuildPolyPathAsync();
         void BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos);
         void BuildPointPath(float const* startPoint, float const* endPoint);
+        void FinishPointPath();
         void BuildShortcut();
 
+        float GetAllowedPolyDist() const;
+        bool CanShortcutOverHole(G3D::Vector3 const& start, G3D::Vector3 const& end) const;
+        bool CanShortcutFarFromPoly(bool start) const;
+
         NavTerrainFlag GetNavTerrain(float x, float y, float z);
         void CreateFilter();
         void UpdateFilter();
@@ -19,8 +19,13 @@
 #include "PacketLog.h"
 #include "Config.h"
 #include "IpAddress.h"
+#include "Log.h"
+#include "MPSCRingBuffer.h"
 #include "Timer.h"
+#include "StringFormat.h"
+#include "Util.h"
 #include "WorldPacket.h"
+#include <zlib.h>
 
 #pragma pack(push, 1)
 
@@ -58,17 +63,33 @@ struct PacketHeader
 
 #pragma pack(pop)
 
-PacketLog::PacketLog() : _file(nullptr)
+namespace
+{
+    // writer wakes up at least this often to write out queued packets
+    constexpr std::chrono::milliseconds WriterInterval(100);
+    constexpr std::size_t WriteBatchSize = 64 * 1024;
+}
+
+PacketLog::PacketLog() : _file(nullptr), _compressedFile(nullptr), _fileSize(0), _fileIndex(0), _maxFileSize(0), _compress(false),
+    _enabled(false), _droppedPackets(0), _stopWriter(false)
 {
     std::call_once(_initializeFlag, &PacketLog::Initialize, this);
 }
 
 PacketLog::~PacketLog()
 {
-    if (_file)
-        fclose(_file);
+    if (_writerThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(_writerLock);
+            _stopWriter = true;
+        }
 
-    _file = nullptr;
+        _writerCondition.notify_one();
+        _writerThread.join();
+    }
+
+    CloseFile();
 }
 
 PacketLog* PacketLog::instance()
@@ -86,29 +107,39 @@ void PacketLog::Initialize()
             logsDir.push_back('/');
 
     std::string logname = sConfigMgr->GetStringDefault("PacketLogFile", "");
-    if (!logname.empty())
-    {
-        _file = fopen((logsDir + logname).c_str(), "wb");
-
-        LogHeader header;
-        header.Signature[0] = 'P'; header.Signature[1] = 'K'; header.Signature[2] = 'T';
-        header.FormatVersion = 0x0301;
-        header.SnifferId = 'T';
-        header.Build = 15595;
-        header.Locale[0] = 'e'; header.Locale[1] = 'n'; header.Locale[2] = 'U'; header.Locale[3] = 'S';
-        std::memset(header.SessionKey, 0, sizeof(header.SessionKey));
-        header.SniffStartUnixtime = GameTime::GetGameTime();
-        header.SniffStartTicks = getMSTime();
-        header.OptionalDataSize = 0;
-
-        if (CanLogPacket())
-            fwrite(&header, sizeof(header), 1, _file);
-    }
+    if (logname.empty())
+        return;
+
+    _fileName = logsDir + logname;
+    _compress = sConfigMgr->GetBoolDefault("PacketLog.Compress", false);
+    if (_compress && (_fileName.size() < 3 || _fileName.compare(_fileName.size() - 3, 3, ".gz") != 0))
+        _fileName += ".gz";
+
+    _maxFileSize = uint64(std::max(sConfigMgr->GetIntDefault("PacketLog.MaxFileSize", 0), 0)) * 1024 * 1024;
+
+    std::string accounts = sConfigMgr->GetStringDefault("PacketLog.Accounts", "");
+    for (char const* account : Tokenizer(accounts, ','))
+        if (uint32 accountId = uint32(strtoul(account, nullptr, 10)))
+            _accounts.insert(accountId);
+
+    if (!OpenFile())
+        return;
+
+    _queue = std::make_unique<Trinity::MPSCRingBuffer<std::vector<uint8>>>(std::max(sConfigMgr->GetIntDefault("PacketLog.QueueSize", 16384), 2));
+    _enabled = true;
+    _writerThread = std::thread(&PacketLog::WriterThread, this);
+}
+
+bool PacketLog::CanLogPacket(uint32 accountId) const
+{
+    return CanLogPacket() && (_accounts.empty() || _accounts.count(accountId));
 }
 
 void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port)
 {
-    std::lock_guard<std::mutex> lock(_logPacketLock);
+    // sockets cache CanLogPacket, the writer may have stopped since
+    if (!CanLogPacket())
+        return;
 
     PacketHeader header;
     header.Direction = direction == CLIENT_TO_SERVER ? 0x47534d43 : 0x47534d53;
@@ -132,9 +163,170 @@ void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost:
     header.Length = packet.size() + sizeof(header.Opcode);
     header.Opcode = packet.GetOpcode();
 
-    fwrite(&header, sizeof(header), 1, _file);
+    std::vector<uint8> record(sizeof(header) + packet.size());
+    memcpy(record.data(), &header, sizeof(header));
     if (!packet.empty())
-        fwrite(packet.contents(), 1, packet.size(), _file);
+        memcpy(record.data() + sizeof(header), packet.contents(), packet.size());
 
-    fflush(_file);
+    if (!_queue->Enqueue(std::move(record)))
+    {
+        ++_droppedPackets;
+        return;
+    }
+
+    if (_queue->GetSizeApprox() >= _queue->GetCapacity() / 2)
+        _writerCondition.notify_one();
+}
+
+void PacketLog::WriterThread()
+{
+    std::string batch;
+    std::vector<uint8> record;
+    bool stop = false;
+    while (!stop)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_writerLock);
+            _writerCondition.wait_for(lock, WriterInterval, [this]()
+            {
+                return _stopWriter || _queue->GetSizeApprox() >= _queue->GetCapacity() / 2;
+            });
+
+            stop = _stopWriter;
+        }
+
+        while (_queue->Dequeue(record))
+        {
+            // every file starts with its own header, packets are never split between files
+            if (IsFileFull(batch.size() + record.size()))
+            {
+                WriteToFile(batch.data(), batch.size());
+                batch.clear();
+
+                CloseFile();
+                ++_fileIndex;
+                if (!OpenFile())
+                {
+                    _enabled = false;
+                    ReportDroppedPackets();
+
+                    // release packets queued before producers noticed
+                    while (_queue->Dequeue(record))
+                        ;
+                    return;
+                }
+            }
+
+            batch.append(reinterpret_cast<char const*>(record.data()), record.size());
+            if (batch.size() >= WriteBatchSize)
+            {
+                WriteToFile(batch.data(), batch.size());
+                batch.clear();
+            }
+        }
+
+        WriteToFile(batch.data(), batch.size());
+        batch.clear();
+
+        // compressed files are only flushed when closed, flushing the stream this often would ruin compression
+        if (_file)
+            fflush(_file);
+
+        ReportDroppedPackets();
+    }
+}
+
+void PacketLog::ReportDroppedPackets()
+{
+    if (uint32 dropped = _droppedPackets.exchange(0, std::memory_order_relaxed))
+        TC_LOG_WARN("network", "PacketLog::WriterThread: Packet log queue was full, dropped %u packets", dropped);
+}
+
+std::string PacketLog::GetFileName() const
+{
+    if (!_fileIndex)
+        return _fileName;
+
+    // World.pkt -> World_1.pkt, World.pkt.gz -> World_1.pkt.gz
+    std::size_t nameEnd = _fileName.size();
+    if (_compress)
+        nameEnd -= 3;
+
+    std::size_t extension = _fileName.find_last_of("./\\", nameEnd - 1);
+    if (extension == std::string::npos || _fileName[extension] != '.')
+        extension = nameEnd;
+
+    return Trinity::StringFormat("%s_%u%s", _fileName.substr(0, extension).c_str(), _fileIndex, _fileName.substr(extension).c_str());
+}
+
+bool PacketLog::OpenFile()
+{
+    std::string fileName = GetFileName();
+    if (_compress)
+        _compressedFile = gzopen(fileName.c_str(), "wb");
+    else
+        _file = fopen(fileName.c_str(), "wb");
+
+    if (!_file && !_compressedFile)
+    {
+        TC_LOG_ERROR("network", "PacketLog::OpenFile: Could not open %s for writing, packet logging is disabled", fileName.c_str());
+        return false;
+    }
+
+    _fileSize = 0;
+
+    LogHeader header;
+    header.Signature[0] = 'P'; header.Signature[1] = 'K'; header.Signature[2] = 'T';
+    header.FormatVersion = 0x0301;
+    header.SnifferId = 'T';
+    header.Build = 15595;
+    header.Locale[0] = 'e'; header.Locale[1] = 'n'; header.Locale[2] = 'U'; header.Locale[3] = 'S';
+    std::memset(header.SessionKey, 0, sizeof(header.SessionKey));
+    header.SniffStartUnixtime = GameTime::GetGameTime();
+    header.SniffStartTicks = getMSTime();
+    header.OptionalDataSize = 0;
+
+    WriteToFile(&header, sizeof(header));
+    return true;
+}
+
+bool PacketLog::IsFileFull(std::size_t pendingSize) const
+{
+    if (!_maxFileSize)
+        return false;
+
+    // the compressed size of pending data is only known once zlib wrote it, compressed files are rotated when the limit is reached
+    if (_compressedFile)
+        return _fileSize >= _maxFileSize;
+
+    return _fileSize + pendingSize > _maxFileSize;
+}
+
+void PacketLog::WriteToFile(void const* data, std::size_t size)
+{
+    if (!size)
+        return;
+
+    if (_file)
+    {
+        fwrite(data, 1, size, _file);
+        _fileSize += size;
+    }
+    else if (_compressedFile)
+    {
+        gzwrite(_compressedFile, data, unsigned(size));
+        _fileSize = uint64(gzoffset(_compressedFile));
+    }
+}
+
+void PacketLog::CloseFile()
+{
+    if (_file)
+        fclose(_file);
+
+    if (_compressedFile)
+        gzclose(_compressedFile);
+
+    _file = nullptr;
+    _compressedFile = nullptr;
 }
@@ -21,7 +21,13 @@
 #include "Common.h"
 
 #include <boost/asio/ip/address.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 enum Direction
 {
@@ -30,24 +36,59 @@ enum Direction
 };
 
 class WorldPacket;
+struct gzFile_s;
+
+namespace Trinity
+{
+    template<typename T>
+    class MPSCRingBuffer;
+}
 
 class TC_GAME_API PacketLog
 {
     private:
         PacketLog();
         ~PacketLog();
-        std::mutex _logPacketLock;
         std::once_flag _initializeFlag;
 
     public:
         static PacketLog* instance();
 
         void Initialize();
-        bool CanLogPacket() const { return (_file != nullptr); }
+        bool CanLogPacket() const { return _enabled.load(std::memory_order_relaxed); }
+        /// Whether packets of the account are logged, 0 for connections that are not authenticated yet
+        bool CanLogPacket(uint32 accountId) const;
+        /// Copies the packet for the writer thread, dropped if the writer can't keep up
         void LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port);
 
     private:
+        void WriterThread();
+        void ReportDroppedPackets();
+        std::string GetFileName() const;
+        bool OpenFile();
+        // true if the current file must be rotated before pendingSize more bytes are written to it
+        bool IsFileFull(std::size_t pendingSize) const;
+        void WriteToFile(void const* data, std::size_t size);
+        void CloseFile();
+
+        // written by the writer thread only
         FILE* _file;
+        gzFile_s* _compressedFile;
+        std::string _fileName;
+        uint64 _fileSize;                                   // bytes in the file, compressed bytes for gzip files
+        uint32 _fileIndex;
+        uint64 _maxFileSize;
+        bool _compress;
+
+        std::unordered_set<uint32> _accounts;
+
+        std::unique_ptr<Trinity::MPSCRingBuffer<std::vector<uint8>>> _queue;
+        std::atomic<bool> _enabled;                         // cleared when the writer thread stops on a file error
+        std::atomic<uint32> _droppedPackets;
+        std::thread _writerThread;
+        std::mutex _writerLock;
+        std::condition_variable _writerCondition;
+        bool _stopWriter;
 };
 
 #define sPacketLog PacketLog::instance()
@@ -21,6 +21,7 @@
 #include "Common.h"
 #include "Opcodes.h"
 #include "ByteBuffer.h"
+#include <atomic>
 #include <chrono>
 
 struct z_stream_s;
@@ -95,6 +96,9 @@ class WorldPacket : public ByteBuffer
         std::chrono::steady_clock::time_point GetReceivedTime() const { return m_receivedTime; }
         void SetReceiveTime(std::chrono::steady_clock::time_point receivedTime) { m_receivedTime = receivedTime; }
 
+        // link used by WorldSession receive queue, not copied or moved with the packet
+        std::atomic<WorldPacket*> RecvQueueLink;
+
     protected:
         uint16 m_opcode;
         ConnectionType _connection;
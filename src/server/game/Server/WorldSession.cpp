@@ -182,7 +182,7 @@ WorldSession::~WorldSession()
 
     ///- empty incoming packet queue
     WorldPacket* packet = nullptr;
-    while (_recvQueue.next(packet))
+    while (_recvQueue.Dequeue(packet))
         delete packet;
 
     LoginDatabase.PExecute("UPDATE account SET online = 0 WHERE id = %u;", GetAccountId());     // One-time query
@@ -222,16 +222,34 @@ ObjectGuid::LowType WorldSession::GetGUIDLow() const
 
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/)
+{
+    ConnectionType conIdx;
+    if (!PrepareSendPacket(packet, forced, conIdx))
+        return;
+
+    m_Socket[conIdx]->SendPacket(*packet);
+}
+
+void WorldSession::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    ConnectionType conIdx;
+    if (!PrepareSendPacket(packet.get(), false, conIdx))
+        return;
+
+    m_Socket[conIdx]->SendPacket(packet);
+}
+
+bool WorldSession::PrepareSendPacket(WorldPacket const* packet, bool forced, ConnectionType& conIdx)
 {
     if (packet->GetOpcode() == NULL_OPCODE)
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of NULL_OPCODE to %s", GetPlayerInfo().c_str());
-        return;
+        return false;
     }
     else if (packet->GetOpcode() == UNKNOWN_OPCODE)
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of UNKNOWN_OPCODE to %s", GetPlayerInfo().c_str());
-        return;
+        return false;
     }
 
     ServerOpcodeHandler const* handler = opcodeTable[static_cast<OpcodeServer>(packet->GetOpcode())];
@@ -239,11 +257,11 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
     if (!handler)
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of opcode %u with non existing handler to %s", packet->GetOpcode(), GetPlayerInfo().c_str());
-        return;
+        return false;
     }
 
     // Default connection index defined in Opcodes.cpp table
-    ConnectionType conIdx = handler->ConnectionIndex;
+    conIdx = handler->ConnectionIndex;
 
     // Override connection index
     if (packet->GetConnection() != CONNECTION_TYPE_DEFAULT)
@@ -251,7 +269,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
         if (packet->GetConnection() != CONNECTION_TYPE_INSTANCE && IsInstanceOnlyOpcode(packet->GetOpcode()))
         {
             TC_LOG_ERROR("network.opcode", "Prevented sending of instance only opcode %u with connection type %u to %s", packet->GetOpcode(), uint32(packet->GetConnection()), GetPlayerInfo().c_str());
-            return;
+            return false;
         }
 
         conIdx = packet->GetConnection();
@@ -260,7 +278,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
     if (!m_Socket[conIdx])
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of %s to non existent socket %u to %s", GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())).c_str(), uint32(conIdx), GetPlayerInfo().c_str());
-        return;
+        return false;
     }
 
     if (!forced)
@@ -269,7 +287,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
         if (!handler || handler->Status == STATUS_UNHANDLED)
         {
             TC_LOG_ERROR("network.opcode", "Prevented sending disabled opcode %s to %s", GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())).c_str(), GetPlayerInfo().c_str());
-            return;
+            return false;
         }
     }
 
@@ -310,13 +328,22 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
     sScriptMgr->OnPacketSend(this, *packet);
 
     TC_LOG_TRACE("network.opcode", "S->C: %s %s", GetPlayerInfo().c_str(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())).c_str());
-    m_Socket[conIdx]->SendPacket(*packet);
+    return true;
 }
 
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
-    _recvQueue.add(new_packet);
+    _recvQueue.Enqueue(new_packet);
+}
+
+void WorldSession::RecyclePacket(WorldPacket* packet)
+{
+    ConnectionType connection = packet->GetConnection();
+    if (connection >= CONNECTION_TYPE_REALM && connection < MAX_CONNECTION_TYPES && m_Socket[connection])
+        m_Socket[connection]->RecyclePacket(packet);
+    else
+        delete packet;
 }
 
 /// Logging helper for unexpected opcodes
@@ -359,7 +386,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     constexpr uint32 MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 100;
 
-    while (m_Socket[CONNECTION_TYPE_REALM] && _recvQueue.next(packet, updater))
+    while (m_Socket[CONNECTION_TYPE_REALM] && _recvQueue.Next(packet, updater))
     {
         ClientOpcodeHandler const* opHandle = opcodeTable[static_cast<OpcodeClient>(packet->GetOpcode())];
         try
@@ -459,7 +486,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
         }
 
         if (deletePacket)
-            delete packet;
+            RecyclePacket(packet);
 
         deletePacket = true;
 
@@ -473,7 +500,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     TC_METRIC_VALUE("processed_packets", processedPackets);
 
-    _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
+    _recvQueue.Readd(requeuePackets.begin(), requeuePackets.end());
 
     if (m_Socket[0] && m_Socket[0]->IsOpen() && _warden)
         _warden->Update();
@@ -679,7 +706,7 @@ void WorldSession::LogoutPlayer(bool save)
         //! Since each account can only have one online character at any given time, ensure all characters for active account are marked as offline
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ACCOUNT_ONLINE);
         stmt->setUInt32(0, GetAccountId());
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, DB_QUEUE_PRIORITY_NORMAL, GetAccountId());
     }
 
     if (m_Socket[CONNECTION_TYPE_INSTANCE])
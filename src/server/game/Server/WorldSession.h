@@ -25,7 +25,7 @@
 #include "Common.h"
 #include "AsyncCallbackProcessor.h"
 #include "DatabaseEnvFwd.h"
-#include "LockedQueue.h"
+#include "MPSCFilterQueue.h"
 #include "ObjectGuid.h"
 #include "Packet.h"
 #include "SharedDefines.h"
@@ -482,6 +482,8 @@ class TC_GAME_API WorldSession
         void SendAddonsInfo();
         bool IsAddonRegistered(const std::string& prefix) const;
         void SendPacket(WorldPacket const* packet, bool forced = false);
+        // queues packet on the socket without copying its payload, used for broadcasts
+        void SendPacket(std::shared_ptr<WorldPacket const> const& packet);
         void AddInstanceConnection(std::shared_ptr<WorldSocket> sock) { m_Socket[1] = sock; }
 
         void SendNotification(const char *format, ...) ATTR_PRINTF(2, 3);
@@ -1343,6 +1345,12 @@ class TC_GAME_API WorldSession
         // logging helper
         void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char *reason);
 
+        // validates packet before it is sent and selects the connection to send it on
+        bool PrepareSendPacket(WorldPacket const* packet, bool forced, ConnectionType& conIdx);
+
+        // hands a processed packet back to the socket it was received on, only called from the thread updating the session
+        void RecyclePacket(WorldPacket* packet);
+
         // EnumData helpers
         bool IsLegitCharacterForAccount(ObjectGuid lowGUID)
         {
@@ -1409,7 +1417,7 @@ class TC_GAME_API WorldSession
         bool _filterAddonMessages;
         uint32 recruiterId;
         bool isRecruiter;
-        LockedQueue<WorldPacket*> _recvQueue;
+        MPSCFilterQueue<WorldPacket, &WorldPacket::RecvQueueLink> _recvQueue;
         rbac::RBACData* _RBACData;
         uint32 expireTime;
         bool forceExit;
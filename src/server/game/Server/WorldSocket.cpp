@@ -43,7 +43,7 @@ std::string const WorldSocket::ClientConnectionInitialize("WORLD OF WARCRAFT CON
 
 WorldSocket::WorldSocket(tcp::socket&& socket) : Socket(std::move(socket)),
     _type(CONNECTION_TYPE_REALM), _authSeed(rand32()), _OverSpeedPings(0), _worldSession(nullptr),
-    _authed(false), _compressionStream(nullptr), _sendBufferSize(4096)
+    _authed(false), _packetLogEnabled(sPacketLog->CanLogPacket(0)), _recvPacketPool(RecvPacketPoolSize), _compressionStream(nullptr), _sendBufferSize(4096)
 {
     _headerBuffer.Resize(2);
 }
@@ -63,7 +63,8 @@ void WorldSocket::Start()
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_IP_INFO);
     stmt->setString(0, ip_address);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSocket::CheckIpCallback, this, std::placeholders::_1)));
+    // ban and account writes carry no fence key, so login queries wait for the normal lane operations queued before them
+    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt, DB_QUEUE_PRIORITY_INTERACTIVE, DB_FENCE_NORMAL_LANE).WithPreparedCallback(std::bind(&WorldSocket::CheckIpCallback, this, std::placeholders::_1)));
 }
 
 void WorldSocket::CheckIpCallback(PreparedQueryResult result)
@@ -190,34 +191,46 @@ void WorldSocket::InitializeHandler(boost::system::error_code error, std::size_t
 bool WorldSocket::Update()
 {
     EncryptablePacket* queued;
-    MessageBuffer buffer(_sendBufferSize);
+    MessageBuffer buffer = AcquireWriteBuffer(_sendBufferSize);
+    SharedPayloadList sharedPayloads;
+    uint32 bufferedPackets = 0;
     while (_bufferQueue.Dequeue(queued))
     {
-        if (queued->size() > 0x400 && !queued->IsCompressed())
+        // shared packets are never larger than CompressionThreshold, only the header is encrypted per socket
+        if (!queued->HasSharedPayload() && queued->size() > CompressionThreshold && !queued->IsCompressed())
             queued->Compress(_compressionStream);
 
-        ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+        WorldPacket const& packet = queued->GetPayload();
+        ServerPktHeader header(packet.size() + 2, queued->GetOpcode());
         if (queued->NeedsEncryption())
             _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-        if (buffer.GetRemainingSpace() < queued->size() + header.getHeaderLength())
+        // shared payloads are handed to the vectored write as they are, only their header takes buffer space
+        std::size_t bufferedSize = queued->HasSharedPayload() ? 0 : packet.size();
+        if (buffer.GetRemainingSpace() < bufferedSize + header.getHeaderLength())
         {
-            QueuePacket(std::move(buffer));
-            buffer.Resize(_sendBufferSize);
+            QueuePacket(std::move(buffer), std::move(sharedPayloads), bufferedPackets);
+            buffer = AcquireWriteBuffer(_sendBufferSize);
+            sharedPayloads.clear();
+            bufferedPackets = 0;
         }
 
-        if (buffer.GetRemainingSpace() >= queued->size() + header.getHeaderLength())
+        if (buffer.GetRemainingSpace() >= bufferedSize + header.getHeaderLength())
         {
             buffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                buffer.Write(queued->contents(), queued->size());
+            if (queued->HasSharedPayload())
+                sharedPayloads.emplace_back(buffer.GetActiveSize(), queued->GetSharedPayload());
+            else if (!packet.empty())
+                buffer.Write(packet.contents(), packet.size());
+
+            ++bufferedPackets;
         }
         else    // single packet larger than 4096 bytes
         {
-            MessageBuffer packetBuffer(queued->size() + header.getHeaderLength());
+            MessageBuffer packetBuffer(packet.size() + header.getHeaderLength());
             packetBuffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                packetBuffer.Write(queued->contents(), queued->size());
+            if (!packet.empty())
+                packetBuffer.Write(packet.contents(), packet.size());
 
             QueuePacket(std::move(packetBuffer));
         }
@@ -226,7 +239,9 @@ bool WorldSocket::Update()
     }
 
     if (buffer.GetActiveSize() > 0)
-        QueuePacket(std::move(buffer));
+        QueuePacket(std::move(buffer), std::move(sharedPayloads), bufferedPackets);
+    else
+        RecycleWriteBuffer(std::move(buffer));
 
     if (!BaseSocket::Update())
         return false;
@@ -324,6 +339,7 @@ void WorldSocket::SetWorldSession(WorldSession* session)
     std::lock_guard<std::mutex> sessionGuard(_worldSessionLock);
     _worldSession = session;
     _authed = true;
+    _packetLogEnabled = sPacketLog->CanLogPacket(session->GetAccountId());
 }
 
 bool WorldSocket::ReadHeaderHandler(bool initialized)
@@ -420,7 +436,7 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
 
     WorldPacket packet(opcode, std::move(_packetBuffer), GetConnectionType());
 
-    if (sPacketLog->CanLogPacket())
+    if (_packetLogEnabled)
         sPacketLog->LogPacket(packet, CLIENT_TO_SERVER, GetRemoteIpAddress(), GetRemotePort());
 
     std::unique_lock<std::mutex> sessionGuard(_worldSessionLock, std::defer_lock);
@@ -537,8 +553,8 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
             // Our Idle timer will reset on any non PING opcodes on login screen, allowing us to catch people idling.
             _worldSession->ResetTimeOutTime(false);
 
-            // Copy the packet to the heap before enqueuing
-            _worldSession->QueuePacket(new WorldPacket(std::move(packet)));
+            // Move the packet to the heap before enqueuing
+            _worldSession->QueuePacket(AcquireRecvPacket(std::move(packet)));
             break;
         }
     }
@@ -570,12 +586,30 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     if (!IsOpen())
         return;
 
-    if (sPacketLog->CanLogPacket())
+    if (_packetLogEnabled)
         sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
 
     _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
 }
 
+void WorldSocket::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    // compression stream state is per socket, larger packets need their own copy
+    if (packet->size() > CompressionThreshold)
+    {
+        SendPacket(*packet);
+        return;
+    }
+
+    if (!IsOpen())
+        return;
+
+    if (_packetLogEnabled)
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
+}
+
 void WorldSocket::HandleAuthSession(std::shared_ptr<WorldPackets::Auth::AuthSession> authSession)
 {
     // Get the account information from the auth database
@@ -583,7 +617,7 @@ void WorldSocket::HandleAuthSession(std::shared_ptr<WorldPackets::Auth::AuthSess
     stmt->setInt32(0, int32(realm.Id.Realm));
     stmt->setString(1, authSession->Account);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSocket::HandleAuthSessionCallback, this, authSession, std::placeholders::_1)));
+    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt, DB_QUEUE_PRIORITY_INTERACTIVE, DB_FENCE_NORMAL_LANE).WithPreparedCallback(std::bind(&WorldSocket::HandleAuthSessionCallback, this, authSession, std::placeholders::_1)));
 }
 
 void WorldSocket::HandleAuthSessionCallback(std::shared_ptr<WorldPackets::Auth::AuthSession> authSession, PreparedQueryResult result)
@@ -734,6 +768,7 @@ void WorldSocket::HandleAuthSessionCallback(std::shared_ptr<WorldPackets::Auth::
     sScriptMgr->OnAccountLogin(account.Game.Id);
 
     _authed = true;
+    _packetLogEnabled = sPacketLog->CanLogPacket(account.Game.Id);
     _worldSession = new WorldSession(account.Game.Id, std::move(authSession->Account), account.BattleNet.Id, shared_from_this(), account.Game.Security,
         account.Game.Expansion, mutetime, account.BattleNet.Locale, account.Game.Recruiter, account.Game.IsRecruiter);
     _worldSession->ReadAddonsInfo(authSession->AddonInfo);
@@ -774,7 +809,7 @@ void WorldSocket::HandleAuthContinuedSession(std::shared_ptr<WorldPackets::Auth:
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_ACCOUNT_INFO_CONTINUED_SESSION);
     stmt->setUInt32(0, accountId);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSocket::HandleAuthContinuedSessionCallback, this, authSession, std::placeholders::_1)));
+    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt, DB_QUEUE_PRIORITY_INTERACTIVE, DB_FENCE_NORMAL_LANE).WithPreparedCallback(std::bind(&WorldSocket::HandleAuthContinuedSessionCallback, this, authSession, std::placeholders::_1)));
 }
 
 void WorldSocket::HandleAuthContinuedSessionCallback(std::shared_ptr<WorldPackets::Auth::AuthContinuedSession> authSession, PreparedQueryResult result)
@@ -915,3 +950,28 @@ bool WorldSocket::HandlePing(WorldPackets::Auth::Ping& ping)
     SendPacketAndLogOpcode(*WorldPackets::Auth::Pong(ping.Serial).Write());
     return true;
 }
+
+WorldPacket* WorldSocket::AcquireRecvPacket(WorldPacket&& packet)
+{
+    std::chrono::steady_clock::time_point receivedTime = packet.GetReceivedTime();
+
+    std::unique_ptr<WorldPacket> recycled;
+    if (!_recvPacketPool.Dequeue(recycled))
+        return new WorldPacket(std::move(packet), receivedTime);
+
+    // payload of the previous packet was moved out, next one is read into the recycled buffer
+    _packetBuffer = MessageBuffer(recycled->Move());
+    *recycled = std::move(packet);
+    recycled->SetReceiveTime(receivedTime);
+    return recycled.release();
+}
+
+void WorldSocket::RecyclePacket(WorldPacket* packet)
+{
+    std::unique_ptr<WorldPacket> recycled(packet);
+    if (recycled->capacity() > RecvPacketPoolMaxBufferSize)
+        return;
+
+    // deleted when the pool is full
+    _recvPacketPool.Enqueue(std::move(recycled));
+}
@@ -28,7 +28,9 @@
 #include "WorldPacket.h"
 #include "WorldSession.h"
 #include "MPSCQueue.h"
+#include "MPSCRingBuffer.h"
 #include <chrono>
+#include <memory>
 #include <boost/asio/ip/tcp.hpp>
 
 using boost::asio::ip::tcp;
@@ -40,11 +42,23 @@ public:
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    // payload is not copied, the socket keeps referencing it until it has been sent
+    EncryptablePacket(std::shared_ptr<WorldPacket const> packet, bool encrypt) : WorldPacket(packet->GetOpcode(), 0, packet->GetConnection()),
+        _sharedPayload(std::move(packet)), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
     bool NeedsEncryption() const { return _encrypt; }
 
+    WorldPacket const& GetPayload() const { return _sharedPayload ? *_sharedPayload : *this; }
+    bool HasSharedPayload() const { return _sharedPayload != nullptr; }
+    std::shared_ptr<WorldPacket const> const& GetSharedPayload() const { return _sharedPayload; }
+
     std::atomic<EncryptablePacket*> SocketQueueLink;
 
 private:
+    std::shared_ptr<WorldPacket const> _sharedPayload;
     bool _encrypt;
 };
 
@@ -82,6 +96,13 @@ class TC_GAME_API WorldSocket : public Socket<WorldSocket>
     static std::string const ServerConnectionInitialize;
     static std::string const ClientConnectionInitialize;
 
+    // packets above this size are compressed with the per socket zlib stream
+    static std::size_t const CompressionThreshold = 0x400;
+
+    // received packets handed back by the session for reuse, larger buffers are freed
+    static std::size_t const RecvPacketPoolSize = 16;
+    static std::size_t const RecvPacketPoolMaxBufferSize = 0x400;
+
     typedef Socket<WorldSocket> BaseSocket;
 
 public:
@@ -95,6 +116,8 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    // queues a packet shared between many sockets, packet must not be modified after this call
+    void SendPacket(std::shared_ptr<WorldPacket const> const& packet);
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
     ConnectionType GetConnectionType() const { return _type; }
@@ -102,6 +125,9 @@ public:
     void SendAuthResponseError(uint8 code);
     void SetWorldSession(WorldSession* session);
 
+    /// Takes back a received packet after the session has processed it, called from the thread updating the session
+    void RecyclePacket(WorldPacket* packet);
+
 protected:
     void OnClose() override;
     void ReadHandler() override;
@@ -133,6 +159,7 @@ private:
     void LoadSessionPermissionsCallback(PreparedQueryResult result);
     void HandleConnectToFailed(WorldPackets::Auth::ConnectToFailed& connectToFailed);
     bool HandlePing(WorldPackets::Auth::Ping& ping);
+    WorldPacket* AcquireRecvPacket(WorldPacket&& packet);
 
     ConnectionType _type;
 
@@ -147,9 +174,11 @@ private:
     std::mutex _worldSessionLock;
     WorldSession* _worldSession;
     bool _authed;
+    std::atomic<bool> _packetLogEnabled;                    // PacketLog.Accounts filter applied to the account of this socket
 
     MessageBuffer _headerBuffer;
     MessageBuffer _packetBuffer;
+    Trinity::MPSCRingBuffer<std::unique_ptr<WorldPacket>> _recvPacketPool;
 
     z_stream_s* _compressionStream;
 
@@ -0,0 +1,171 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TickProfiler.h"
+#include "Config.h"
+#include <algorithm>
+#include <ostream>
+
+// create instance
+TickProfiler sWorldTickProfiler;
+
+std::atomic<bool> TickProfiler::_enabled(true);
+
+char const* GetTickPhaseName(TickPhase phase)
+{
+    switch (phase)
+    {
+        case TICK_PHASE_WORLD_SESSIONS:             return "UpdateSessions";
+        case TICK_PHASE_WORLD_MAPS:                 return "UpdateMapMgr";
+        case TICK_PHASE_WORLD_TERRAIN:              return "UpdateTerrainMgr";
+        case TICK_PHASE_WORLD_BATTLEGROUNDS:        return "UpdateBattlegroundMgr";
+        case TICK_PHASE_WORLD_OUTDOORPVP:           return "UpdateOutdoorPvPMgr";
+        case TICK_PHASE_WORLD_BATTLEFIELDS:         return "UpdateBattlefieldMgr";
+        case TICK_PHASE_WORLD_LFG:                  return "UpdateLFGMgr";
+        case TICK_PHASE_WORLD_QUERY_CALLBACKS:      return "ProcessQueryCallbacks";
+        case TICK_PHASE_WORLD_CLI_COMMANDS:         return "ProcessCliCommands";
+        case TICK_PHASE_WORLD_SCRIPTS:              return "OnWorldUpdate";
+        case TICK_PHASE_MAP_SESSIONS:               return "UpdateSessions";
+        case TICK_PHASE_MAP_RESPAWNS:               return "ProcessRespawns";
+        case TICK_PHASE_MAP_OBJECTS:                return "ObjectUpdater";
+        case TICK_PHASE_MAP_TRANSPORTS:             return "UpdateTransports";
+        case TICK_PHASE_MAP_SEND_OBJECT_UPDATES:    return "SendObjectUpdates";
+        case TICK_PHASE_MAP_SCRIPT_QUEUE:           return "ScriptsProcess";
+        case TICK_PHASE_MAP_WEATHER:                return "UpdateWeather";
+        case TICK_PHASE_MAP_MOVE_LISTS:             return "MoveAllInMoveList";
+        case TICK_PHASE_MAP_RELOCATION_NOTIFIES:    return "ProcessRelocationNotifies";
+        case TICK_PHASE_MAP_SCRIPTS:                return "OnMapUpdate";
+        default:
+            break;
+    }
+
+    return "Unknown";
+}
+
+TickProfiler::TickProfiler() : _active(false), _historyIndex(0)
+{
+}
+
+void TickProfiler::LoadFromConfig()
+{
+    _enabled = sConfigMgr->GetBoolDefault("TickProfiler.Enable", true);
+}
+
+void TickProfiler::BeginTick()
+{
+    _active = IsEnabled();
+    if (!_active)
+        return;
+
+    _current.Start = Clock::now();
+    _current.RecordedPhases = 0;
+}
+
+void TickProfiler::EndTick()
+{
+    if (!_active)
+        return;
+
+    _active = false;
+    _current.Duration = uint32(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - _current.Start).count());
+
+    std::lock_guard<std::mutex> lock(_historyLock);
+    if (_history.empty())
+        _history.reserve(TICK_PROFILER_HISTORY);
+
+    if (_history.size() < TICK_PROFILER_HISTORY)
+        _history.push_back(_current);
+    else
+        _history[_historyIndex] = _current;
+
+    _historyIndex = (_historyIndex + 1) % TICK_PROFILER_HISTORY;
+}
+
+void TickProfiler::RecordPhase(TickPhase phase, Clock::time_point start, Clock::time_point end)
+{
+    uint32 duration = uint32(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+    PhaseSample& sample = _current.Phases[phase];
+    if (_current.HasPhase(phase))
+    {
+        sample.Duration += duration;
+        return;
+    }
+
+    _current.RecordedPhases |= 1u << phase;
+    sample.Offset = uint32(std::chrono::duration_cast<std::chrono::microseconds>(start - _current.Start).count());
+    sample.Duration = duration;
+}
+
+std::vector<TickProfiler::Tick> TickProfiler::GetHistory() const
+{
+    std::lock_guard<std::mutex> lock(_historyLock);
+    std::vector<Tick> history;
+    history.reserve(_history.size());
+    if (_history.size() < TICK_PROFILER_HISTORY)
+        history = _history;
+    else
+    {
+        history.insert(history.end(), _history.begin() + _historyIndex, _history.end());
+        history.insert(history.end(), _history.begin(), _history.begin() + _historyIndex);
+    }
+
+    return history;
+}
+
+TickProfiler::Summary TickProfiler::GetSummary() const
+{
+    auto add = [](PhaseSummary& summary, uint32 duration)
+    {
+        ++summary.Ticks;
+        summary.Total += duration;
+        summary.Max = std::max(summary.Max, duration);
+    };
+
+    Summary summary;
+    std::lock_guard<std::mutex> lock(_historyLock);
+    for (Tick const& tick : _history)
+    {
+        add(summary.Update, tick.Duration);
+        for (uint8 phase = 0; phase < MAX_TICK_PHASES; ++phase)
+            if (tick.HasPhase(TickPhase(phase)))
+                add(summary.Phases[phase], tick.Phases[phase].Duration);
+    }
+
+    return summary;
+}
+
+std::size_t TickProfiler::WriteTraceEvents(std::ostream& out, uint32 tid) const
+{
+    std::size_t events = 0;
+    auto writeEvent = [&](char const* name, int64 start, uint32 duration)
+    {
+        out << ",\n" << R"({"name":")" << name << R"(","cat":"tick","ph":"X","pid":1,"tid":)" << tid
+            << R"(,"ts":)" << start << R"(,"dur":)" << duration << '}';
+        ++events;
+    };
+
+    for (Tick const& tick : GetHistory())
+    {
+        int64 tickStart = std::chrono::duration_cast<std::chrono::microseconds>(tick.Start.time_since_epoch()).count();
+        writeEvent("Tick", tickStart, tick.Duration);
+        for (uint8 phase = 0; phase < MAX_TICK_PHASES; ++phase)
+            if (tick.HasPhase(TickPhase(phase)))
+                writeEvent(GetTickPhaseName(TickPhase(phase)), tickStart + tick.Phases[phase].Offset, tick.Phases[phase].Duration);
+    }
+
+    return events;
+}
@@ -0,0 +1,166 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TICKPROFILER_H
+#define __TICKPROFILER_H
+
+#include "Define.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// number of ticks kept by every profiler
+#define TICK_PROFILER_HISTORY 256
+
+enum TickPhase : uint8
+{
+    // World::Update
+    TICK_PHASE_WORLD_SESSIONS,
+    TICK_PHASE_WORLD_MAPS,
+    TICK_PHASE_WORLD_TERRAIN,
+    TICK_PHASE_WORLD_BATTLEGROUNDS,
+    TICK_PHASE_WORLD_OUTDOORPVP,
+    TICK_PHASE_WORLD_BATTLEFIELDS,
+    TICK_PHASE_WORLD_LFG,
+    TICK_PHASE_WORLD_QUERY_CALLBACKS,
+    TICK_PHASE_WORLD_CLI_COMMANDS,
+    TICK_PHASE_WORLD_SCRIPTS,
+
+    // Map::Update
+    TICK_PHASE_MAP_SESSIONS,
+    TICK_PHASE_MAP_RESPAWNS,
+    TICK_PHASE_MAP_OBJECTS,
+    TICK_PHASE_MAP_TRANSPORTS,
+    TICK_PHASE_MAP_SEND_OBJECT_UPDATES,
+    TICK_PHASE_MAP_SCRIPT_QUEUE,
+    TICK_PHASE_MAP_WEATHER,
+    TICK_PHASE_MAP_MOVE_LISTS,
+    TICK_PHASE_MAP_RELOCATION_NOTIFIES,
+    TICK_PHASE_MAP_SCRIPTS,
+
+    MAX_TICK_PHASES
+};
+
+static_assert(MAX_TICK_PHASES <= 32, "TickProfiler::Tick::RecordedPhases must be able to hold all phases");
+
+TC_GAME_API char const* GetTickPhaseName(TickPhase phase);
+
+/// Keeps per phase durations of the last TICK_PROFILER_HISTORY ticks of one update loop
+/// Phases are recorded by the thread running the loop without locking, finished ticks are published once per tick
+class TC_GAME_API TickProfiler
+{
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        struct PhaseSample
+        {
+            uint32 Offset;      // microseconds since tick start
+            uint32 Duration;    // microseconds, summed if the phase ran more than once
+        };
+
+        struct Tick
+        {
+            Clock::time_point Start;
+            uint32 Duration = 0;
+            uint32 RecordedPhases = 0;
+            std::array<PhaseSample, MAX_TICK_PHASES> Phases;
+
+            bool HasPhase(TickPhase phase) const { return (RecordedPhases & (1u << phase)) != 0; }
+        };
+
+        struct PhaseSummary
+        {
+            uint32 Ticks = 0;
+            uint64 Total = 0;
+            uint32 Max = 0;
+
+            uint32 GetAverage() const { return Ticks ? uint32(Total / Ticks) : 0; }
+        };
+
+        struct Summary
+        {
+            PhaseSummary Update;
+            std::array<PhaseSummary, MAX_TICK_PHASES> Phases;
+        };
+
+        TickProfiler();
+
+        TickProfiler(TickProfiler const&) = delete;
+        TickProfiler& operator=(TickProfiler const&) = delete;
+
+        static void LoadFromConfig();
+        static bool IsEnabled() { return _enabled.load(std::memory_order_relaxed); }
+
+        void BeginTick();
+        void EndTick();
+
+        // true between BeginTick and EndTick if profiling was enabled when the tick started
+        bool IsActive() const { return _active; }
+
+        void RecordPhase(TickPhase phase, Clock::time_point start, Clock::time_point end);
+
+        // ticks oldest first
+        std::vector<Tick> GetHistory() const;
+        Summary GetSummary() const;
+
+        // appends recorded phases as Chrome trace "complete" events on thread tid, each preceded by a comma
+        // returns number of events written
+        std::size_t WriteTraceEvents(std::ostream& out, uint32 tid) const;
+
+    private:
+        static std::atomic<bool> _enabled;
+
+        bool _active;
+        Tick _current;
+
+        mutable std::mutex _historyLock;
+        std::vector<Tick> _history;     // allocated on first profiled tick
+        std::size_t _historyIndex;
+};
+
+/// Records time spent until end of scope as phase of the current tick
+class TickProfilerScope
+{
+    public:
+        TickProfilerScope(TickProfiler& profiler, TickPhase phase) : _profiler(profiler.IsActive() ? &profiler : nullptr), _phase(phase)
+        {
+            if (_profiler)
+                _start = TickProfiler::Clock::now();
+        }
+
+        ~TickProfilerScope()
+        {
+            if (_profiler)
+                _profiler->RecordPhase(_phase, _start, TickProfiler::Clock::now());
+        }
+
+        TickProfilerScope(TickProfilerScope const&) = delete;
+        TickProfilerScope& operator=(TickProfilerScope const&) = delete;
+
+    private:
+        TickProfiler* _profiler;
+        TickPhase _phase;
+        TickProfiler::Clock::time_point _start;
+};
+
+TC_GAME_API extern TickProfiler sWorldTickProfiler;
+
+#endif
@@ -80,7 +80,9 @@
 #include "SkillExtraItems.h"
 #include "SmartScriptMgr.h"
 #include "SpellMgr.h"
+#include "TaskGraph.h"
 #include "TerrainMgr.h"
+#include "TickProfiler.h"
 #include "TicketMgr.h"
 #include "TransportMgr.h"
 #include "Unit.h"
@@ -542,6 +544,7 @@ void World::LoadConfigSettings(bool reload)
 
     // load update time related configs
     sWorldUpdateTime.LoadFromConfig();
+    TickProfiler::LoadFromConfig();
 
     ///- Read the player limit and the Message of the day from the config file
     SetPlayerAmountLimit(sConfigMgr->GetIntDefault("PlayerLimit", 100));
@@ -754,6 +757,8 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_INTERVAL_SAVE] = sConfigMgr->GetIntDefault("PlayerSaveInterval", 15 * MINUTE * IN_MILLISECONDS);
     m_int_configs[CONFIG_INTERVAL_DISCONNECT_TOLERANCE] = sConfigMgr->GetIntDefault("DisconnectToleranceInterval", 0);
     m_bool_configs[CONFIG_STATS_SAVE_ONLY_ON_LOGOUT] = sConfigMgr->GetBoolDefault("PlayerSave.Stats.SaveOnlyOnLogout", true);
+    m_bool_configs[CONFIG_PLAYER_SAVE_DIFFERENTIAL] = sConfigMgr->GetBoolDefault("PlayerSave.Differential", true);
+    m_bool_configs[CONFIG_PLAYER_SAVE_DIFFERENTIAL_VERIFY] = sConfigMgr->GetBoolDefault("PlayerSave.Differential.Verify", false);
 
     m_int_configs[CONFIG_MIN_LEVEL_STAT_SAVE] = sConfigMgr->GetIntDefault("PlayerSave.Stats.MinLevel", 0);
     if (m_int_configs[CONFIG_MIN_LEVEL_STAT_SAVE] > MAX_LEVEL)
@@ -1471,6 +1476,7 @@ void World::LoadConfigSettings(bool reload)
     }
 
     m_bool_configs[CONFIG_ENABLE_MMAPS] = sConfigMgr->GetBoolDefault("mmap.enablePathFinding", true);
+    m_int_configs[CONFIG_MMAP_PATH_CACHE_SIZE] = sConfigMgr->GetIntDefault("mmap.pathCacheSize", 256);
     TC_LOG_INFO("server.loading", "WORLD: MMap data directory is: %smmaps", m_dataPath.c_str());
 
     m_bool_configs[CONFIG_VMAP_INDOOR_CHECK] = sConfigMgr->GetBoolDefault("vmap.enableIndoorCheck", 0);
@@ -1506,6 +1512,10 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_SHOW_MUTE_IN_WORLD] = sConfigMgr->GetBoolDefault("ShowMuteInWorld", false);
     m_bool_configs[CONFIG_SHOW_BAN_IN_WORLD] = sConfigMgr->GetBoolDefault("ShowBanInWorld", false);
     m_int_configs[CONFIG_NUMTHREADS] = sConfigMgr->GetIntDefault("MapUpdate.Threads", 1);
+    m_bool_configs[CONFIG_MAP_UPDATE_REGIONS] = sConfigMgr->GetBoolDefault("MapUpdate.Regions.Enable", false);
+    m_int_configs[CONFIG_MAP_UPDATE_REGIONS_MIN_PLAYERS] = sConfigMgr->GetIntDefault("MapUpdate.Regions.MinPlayers", 50);
+    m_int_configs[CONFIG_MAP_UPDATE_PATHFINDING_THREADS] = sConfigMgr->GetIntDefault("MapUpdate.PathfindingThreads", 0);
+    m_int_configs[CONFIG_STARTUP_LOADER_THREADS] = sConfigMgr->GetIntDefault("Startup.LoaderThreads", 1);
     m_int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = sConfigMgr->GetIntDefault("Command.LookupMaxResults", 0);
 
     // Warden
@@ -1711,7 +1721,7 @@ void World::SetInitialWorldSettings()
 
     ///- Load the DBC/DB2 files
     TC_LOG_INFO("server.loading", "Initialize data stores...");
-    sDBCManager.LoadStores(m_dataPath, m_defaultDbcLocale);
+    sDBCManager.LoadStores(m_dataPath, sConfigMgr->GetStringDefault("DBC.CacheDir", ""), m_defaultDbcLocale);
     m_availableDbcLocaleMask = sDB2Manager.LoadStores(m_dataPath, m_defaultDbcLocale);
     if (!(m_availableDbcLocaleMask & (1 << m_defaultDbcLocale)))
     {
@@ -1745,6 +1755,7 @@ void World::SetInitialWorldSettings()
 
     MMAP::MMapManager* mmmgr = MMAP::MMapFactory::createOrGetMMapManager();
     mmmgr->InitializeThreadUnsafe(mapData);
+    mmmgr->SetPathCacheSize(getIntConfig(CONFIG_MMAP_PATH_CACHE_SIZE));
 
     TC_LOG_INFO("server.loading", "Initializing PlayerDump tables...");
     PlayerDump::InitializeTables();
@@ -1787,170 +1798,125 @@ void World::SetInitialWorldSettings()
     TC_LOG_INFO("server.loading", "Loading character cache store...");
     sCharacterCache->LoadCharacterCacheStorage();
 
-    TC_LOG_INFO("server.loading", "Loading Broadcast texts...");
-    sObjectMgr->LoadBroadcastTexts();
-    sObjectMgr->LoadBroadcastTextLocales();
-
-    TC_LOG_INFO("server.loading", "Loading Localization strings...");
-    uint32 oldMSTime = getMSTime();
-    sObjectMgr->LoadCreatureLocales();
-    sObjectMgr->LoadGameObjectLocales();
-    sObjectMgr->LoadQuestLocales();
-    sObjectMgr->LoadNpcTextLocales();
-    sObjectMgr->LoadPageTextLocales();
-    sObjectMgr->LoadGossipMenuItemsLocales();
-    sObjectMgr->LoadPointOfInterestLocales();
-    sObjectMgr->LoadQuestGreetingsLocales();
-
-    sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
-    TC_LOG_INFO("server.loading", ">> Localization strings loaded in %u ms", GetMSTimeDiffToNow(oldMSTime));
-
-    TC_LOG_INFO("server.loading", "Loading Account Roles and Permissions...");
-    sAccountMgr->LoadRBAC();
-
-    TC_LOG_INFO("server.loading", "Loading Page Texts...");
-    sObjectMgr->LoadPageTexts();
-
-    TC_LOG_INFO("server.loading", "Loading Game Object Templates...");         // must be after LoadPageTexts
-    sObjectMgr->LoadGameObjectTemplate();
-
-    TC_LOG_INFO("server.loading", "Loading Game Object template addons...");
-    sObjectMgr->LoadGameObjectTemplateAddons();
-
-    TC_LOG_INFO("server.loading", "Loading Transport templates...");
-    sTransportMgr->LoadTransportTemplates();
-
-    TC_LOG_INFO("server.loading", "Loading Transport animations and rotations...");
-    sTransportMgr->LoadTransportAnimationAndRotation();
-
-    TC_LOG_INFO("server.loading", "Loading Transport spawns...");
-    sTransportMgr->LoadTransportSpawns();
-
-    TC_LOG_INFO("server.loading", "Loading Spell Rank Data...");
-    sSpellMgr->LoadSpellRanks();
-
-    TC_LOG_INFO("server.loading", "Loading Spell Required Data...");
-    sSpellMgr->LoadSpellRequired();
-
-    TC_LOG_INFO("server.loading", "Loading Spell Group types...");
-    sSpellMgr->LoadSpellGroups();
-
-    TC_LOG_INFO("server.loading", "Loading Spell Learn Skills...");
-    sSpellMgr->LoadSpellLearnSkills();                           // must be after LoadSpellRanks
-
-    TC_LOG_INFO("server.loading", "Loading SpellInfo SpellSpecific and AuraState...");
-    sSpellMgr->LoadSpellInfoSpellSpecificAndAuraState();         // must be after LoadSpellRanks
-
-    TC_LOG_INFO("server.loading", "Loading Spell Learn Spells...");
-    sSpellMgr->LoadSpellLearnSpells();
-
-    TC_LOG_INFO("server.loading", "Loading Spell Proc conditions and data...");
-    sSpellMgr->LoadSpellProcs();
-
-    TC_LOG_INFO("server.loading", "Loading Spell Bonus Data...");
-    sSpellMgr->LoadSpellBonuses();
-
-    TC_LOG_INFO("server.loading", "Loading Aggro Spells Definitions...");
-    sSpellMgr->LoadSpellThreats();
-
-    TC_LOG_INFO("server.loading", "Loading Spell Group Stack Rules...");
-    sSpellMgr->LoadSpellGroupStackRules();
-
-    TC_LOG_INFO("server.loading", "Loading NPC Texts...");
-    sObjectMgr->LoadGossipText();
-
-    TC_LOG_INFO("server.loading", "Loading Enchant Spells Proc datas...");
-    sSpellMgr->LoadSpellEnchantProcData();
-
-    TC_LOG_INFO("server.loading", "Loading Item Random Enchantments Table...");
-    LoadRandomEnchantmentsTable();
-
-    TC_LOG_INFO("server.loading", "Loading Disables");                         // must be before loading quests and items
-    DisableMgr::LoadDisables();
-
-    TC_LOG_INFO("server.loading", "Loading Items...");                         // must be after LoadRandomEnchantmentsTable and LoadPageTexts
-    sObjectMgr->LoadItemTemplates();
-
-    TC_LOG_INFO("server.loading", "Loading Item set names...");                // must be after LoadItemPrototypes
-    sObjectMgr->LoadItemTemplateAddon();
-
-    TC_LOG_INFO("misc", "Loading Item Scripts...");                 // must be after LoadItemPrototypes
-    sObjectMgr->LoadItemScriptNames();
-
-    TC_LOG_INFO("server.loading", "Loading Creature Model Based Info Data...");
-    sObjectMgr->LoadCreatureModelInfo();
-
-    TC_LOG_INFO("server.loading", "Loading Creature templates...");
-    sObjectMgr->LoadCreatureTemplates();
-
-    TC_LOG_INFO("server.loading", "Loading Equipment templates...");           // must be after LoadCreatureTemplates
-    sObjectMgr->LoadEquipmentTemplates();
-
-    TC_LOG_INFO("server.loading", "Loading Creature template addons...");
-    sObjectMgr->LoadCreatureTemplateAddons();
-
-    TC_LOG_INFO("server.loading", "Loading Reputation Reward Rates...");
-    sObjectMgr->LoadReputationRewardRate();
-
-    TC_LOG_INFO("server.loading", "Loading Creature Reward OnKill Data...");
-    sObjectMgr->LoadRewardOnKill();
-
-    TC_LOG_INFO("server.loading", "Loading Reputation Spillover Data...");
-    sObjectMgr->LoadReputationSpilloverTemplate();
-
-    TC_LOG_INFO("server.loading", "Loading Points Of Interest Data...");
-    sObjectMgr->LoadPointsOfInterest();
-
-    TC_LOG_INFO("server.loading", "Loading Creature Base Stats...");
-    sObjectMgr->LoadCreatureClassLevelStats();
-
-    TC_LOG_INFO("server.loading", "Loading Spawn Group Templates...");
-    sObjectMgr->LoadSpawnGroupTemplates();
-
-    TC_LOG_INFO("server.loading", "Loading Creature Data...");
-    sObjectMgr->LoadCreatures();
-
-    TC_LOG_INFO("server.loading", "Loading Temporary Summon Data...");
-    sObjectMgr->LoadTempSummons();                               // must be after LoadCreatureTemplates() and LoadGameObjectTemplates()
-
-    TC_LOG_INFO("server.loading", "Loading pet levelup spells...");
-    sSpellMgr->LoadPetLevelupSpellMap();
-
-    TC_LOG_INFO("server.loading", "Loading pet default spells additional to levelup spells...");
-    sSpellMgr->LoadPetDefaultSpells();
-
-    TC_LOG_INFO("server.loading", "Loading Creature Addon Data...");
-    sObjectMgr->LoadCreatureAddons();                            // must be after LoadCreatureTemplates() and LoadCreatures()
-
-    TC_LOG_INFO("server.loading", "Loading Creature Movement Overrides...");
-    sObjectMgr->LoadCreatureMovementOverrides();                 // must be after LoadCreatures()
-
-    TC_LOG_INFO("server.loading", "Loading Creature Movement Info...");
-    sObjectMgr->LoadCreatureMovementInfo();                      // must be after LoadCreatureTemplates()
-
-    TC_LOG_INFO("server.loading", "Loading Gameobject Data...");
-    sObjectMgr->LoadGameObjects();
-
-    TC_LOG_INFO("server.loading", "Loading Spawn Group Data...");
-    sObjectMgr->LoadSpawnGroups();
-
-    TC_LOG_INFO("server.loading", "Loading instance spawn groups...");
-    sObjectMgr->LoadInstanceSpawnGroups();
-
-    TC_LOG_INFO("server.loading", "Loading GameObject Addon Data...");
-    sObjectMgr->LoadGameObjectAddons();                          // must be after LoadGameObjectTemplate() and LoadGameObjects()
-
-    TC_LOG_INFO("server.loading", "Loading GameObject Quest Items...");
-    sObjectMgr->LoadGameObjectQuestItems();
-
-    TC_LOG_INFO("server.loading", "Loading Creature Quest Items...");
-    sObjectMgr->LoadCreatureQuestItems();
-
-    TC_LOG_INFO("server.loading", "Loading Creature Sparring Data...");
-    sObjectMgr->LoadCreatureSparringTemplate();
+    ///- Load static data, loaders that don't depend on each other run concurrently if Startup.LoaderThreads > 1
+    Trinity::TaskGraph loaders;
+    auto addLoader = [&loaders](char const* name, std::initializer_list<Trinity::TaskGraph::TaskId> dependencies, std::function<void()> load)
+    {
+        return loaders.AddTask(name, dependencies, [name, load = std::move(load)]()
+        {
+            TC_LOG_INFO("server.loading", "Loading %s...", name);
+            load();
+        });
+    };
 
-    TC_LOG_INFO("server.loading", "Loading Creature Linked Respawn...");
-    sObjectMgr->LoadLinkedRespawn();                             // must be after LoadCreatures(), LoadGameObjects()
+    Trinity::TaskGraph::TaskId broadcastTexts = addLoader("Broadcast texts", {}, []()
+    {
+        sObjectMgr->LoadBroadcastTexts();
+        sObjectMgr->LoadBroadcastTextLocales();
+    });
+
+    addLoader("Localization strings", {}, [this]()
+    {
+        sObjectMgr->LoadCreatureLocales();
+        sObjectMgr->LoadGameObjectLocales();
+        sObjectMgr->LoadQuestLocales();
+        sObjectMgr->LoadNpcTextLocales();
+        sObjectMgr->LoadPageTextLocales();
+        sObjectMgr->LoadGossipMenuItemsLocales();
+        sObjectMgr->LoadPointOfInterestLocales();
+        sObjectMgr->LoadQuestGreetingsLocales();
+
+        sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());    // Get once for all the locale index of DBC language (console/broadcasts)
+    });
+
+    addLoader("Account Roles and Permissions", {}, []() { sAccountMgr->LoadRBAC(); });
+
+    Trinity::TaskGraph::TaskId pageTexts = addLoader("Page Texts", {}, []() { sObjectMgr->LoadPageTexts(); });
+    Trinity::TaskGraph::TaskId gameObjectTemplates = addLoader("Game Object Templates", { pageTexts }, []() { sObjectMgr->LoadGameObjectTemplate(); });
+    addLoader("Game Object template addons", { gameObjectTemplates }, []() { sObjectMgr->LoadGameObjectTemplateAddons(); });
+
+    Trinity::TaskGraph::TaskId transportTemplates = addLoader("Transport templates", { gameObjectTemplates }, []() { sTransportMgr->LoadTransportTemplates(); });
+    Trinity::TaskGraph::TaskId transportAnimations = addLoader("Transport animations and rotations", { transportTemplates }, []() { sTransportMgr->LoadTransportAnimationAndRotation(); });
+    addLoader("Transport spawns", { transportAnimations }, []() { sTransportMgr->LoadTransportSpawns(); });
+
+    // spell tables referencing other spell tables stay in their original order
+    Trinity::TaskGraph::TaskId spellRanks = addLoader("Spell Rank Data", {}, []() { sSpellMgr->LoadSpellRanks(); });
+    Trinity::TaskGraph::TaskId spellRequired = addLoader("Spell Required Data", { spellRanks }, []() { sSpellMgr->LoadSpellRequired(); });
+    Trinity::TaskGraph::TaskId spellGroups = addLoader("Spell Group types", { spellRequired }, []() { sSpellMgr->LoadSpellGroups(); });
+    Trinity::TaskGraph::TaskId spellLearnSkills = addLoader("Spell Learn Skills", { spellGroups }, []() { sSpellMgr->LoadSpellLearnSkills(); });
+    Trinity::TaskGraph::TaskId spellSpecific = addLoader("SpellInfo SpellSpecific and AuraState", { spellLearnSkills }, []() { sSpellMgr->LoadSpellInfoSpellSpecificAndAuraState(); });
+    Trinity::TaskGraph::TaskId spellLearnSpells = addLoader("Spell Learn Spells", { spellSpecific }, []() { sSpellMgr->LoadSpellLearnSpells(); });
+    Trinity::TaskGraph::TaskId spellProcs = addLoader("Spell Proc conditions and data", { spellLearnSpells }, []() { sSpellMgr->LoadSpellProcs(); });
+    addLoader("Spell Group Stack Rules", { spellProcs }, []() { sSpellMgr->LoadSpellGroupStackRules(); });
+    addLoader("Spell Bonus Data", {}, []() { sSpellMgr->LoadSpellBonuses(); });
+    addLoader("Aggro Spells Definitions", {}, []() { sSpellMgr->LoadSpellThreats(); });
+    addLoader("Enchant Spells Proc datas", {}, []() { sSpellMgr->LoadSpellEnchantProcData(); });
+
+    addLoader("NPC Texts", { broadcastTexts }, []() { sObjectMgr->LoadGossipText(); });
+
+    Trinity::TaskGraph::TaskId randomEnchantments = addLoader("Item Random Enchantments Table", {}, []() { LoadRandomEnchantmentsTable(); });
+    Trinity::TaskGraph::TaskId disables = addLoader("Disables", {}, []() { DisableMgr::LoadDisables(); });
+    Trinity::TaskGraph::TaskId items = addLoader("Items", { randomEnchantments, pageTexts, disables }, []() { sObjectMgr->LoadItemTemplates(); });
+    Trinity::TaskGraph::TaskId itemAddons = addLoader("Item set names", { items }, []() { sObjectMgr->LoadItemTemplateAddon(); });
+    addLoader("Item Scripts", { itemAddons }, []() { sObjectMgr->LoadItemScriptNames(); });
+
+    Trinity::TaskGraph::TaskId creatureModels = addLoader("Creature Model Based Info Data", {}, []() { sObjectMgr->LoadCreatureModelInfo(); });
+    Trinity::TaskGraph::TaskId creatureTemplates = addLoader("Creature templates", { creatureModels }, []() { sObjectMgr->LoadCreatureTemplates(); });
+    Trinity::TaskGraph::TaskId equipmentTemplates = addLoader("Equipment templates", { creatureTemplates, items }, []() { sObjectMgr->LoadEquipmentTemplates(); });
+    addLoader("Creature template addons", { creatureTemplates }, []() { sObjectMgr->LoadCreatureTemplateAddons(); });
+    addLoader("Reputation Reward Rates", {}, []() { sObjectMgr->LoadReputationRewardRate(); });
+    addLoader("Creature Reward OnKill Data", { creatureTemplates }, []() { sObjectMgr->LoadRewardOnKill(); });
+    addLoader("Reputation Spillover Data", {}, []() { sObjectMgr->LoadReputationSpilloverTemplate(); });
+    addLoader("Points Of Interest Data", {}, []() { sObjectMgr->LoadPointsOfInterest(); });
+    addLoader("Creature Base Stats", { creatureTemplates }, []() { sObjectMgr->LoadCreatureClassLevelStats(); });
+
+    Trinity::TaskGraph::TaskId spawnGroupTemplates = addLoader("Spawn Group Templates", {}, []() { sObjectMgr->LoadSpawnGroupTemplates(); });
+    Trinity::TaskGraph::TaskId creatures = addLoader("Creature Data", { creatureTemplates, equipmentTemplates, spawnGroupTemplates }, []() { sObjectMgr->LoadCreatures(); });
+    addLoader("Temporary Summon Data", { creatureTemplates, gameObjectTemplates }, []() { sObjectMgr->LoadTempSummons(); });
+
+    Trinity::TaskGraph::TaskId petLevelupSpells = addLoader("pet levelup spells", {}, []() { sSpellMgr->LoadPetLevelupSpellMap(); });
+    addLoader("pet default spells additional to levelup spells", { creatureTemplates, petLevelupSpells }, []() { sSpellMgr->LoadPetDefaultSpells(); });
+
+    addLoader("Creature Addon Data", { creatures }, []() { sObjectMgr->LoadCreatureAddons(); });
+    addLoader("Creature Movement Overrides", { creatures }, []() { sObjectMgr->LoadCreatureMovementOverrides(); });
+    addLoader("Creature Movement Info", { creatureTemplates }, []() { sObjectMgr->LoadCreatureMovementInfo(); });
+
+    // shares the per map spawn guid store with LoadCreatures
+    Trinity::TaskGraph::TaskId gameObjects = addLoader("Gameobject Data", { gameObjectTemplates, spawnGroupTemplates, creatures }, []() { sObjectMgr->LoadGameObjects(); });
+    Trinity::TaskGraph::TaskId spawnGroups = addLoader("Spawn Group Data", { creatures, gameObjects }, []() { sObjectMgr->LoadSpawnGroups(); });
+    addLoader("instance spawn groups", { spawnGroups }, []() { sObjectMgr->LoadInstanceSpawnGroups(); });
+    addLoader("GameObject Addon Data", { gameObjects }, []() { sObjectMgr->LoadGameObjectAddons(); });
+    addLoader("GameObject Quest Items", { gameObjectTemplates }, []() { sObjectMgr->LoadGameObjectQuestItems(); });
+    addLoader("Creature Quest Items", { creatureTemplates }, []() { sObjectMgr->LoadCreatureQuestItems(); });
+    addLoader("Creature Sparring Data", { creatureTemplates }, []() { sObjectMgr->LoadCreatureSparringTemplate(); });
+    addLoader("Creature Linked Respawn", { spawnGroups }, []() { sObjectMgr->LoadLinkedRespawn(); });
+
+    loaders.Run(getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
+
+    std::chrono::microseconds loadersTotal = std::chrono::microseconds::zero();
+    for (Trinity::TaskGraph::Task const& task : loaders.GetTasks())
+    {
+        loadersTotal += task.Duration;
+        TC_LOG_DEBUG("server.loading", "Startup loader %s started after %u ms and took %u ms", task.Name.c_str(),
+            uint32(std::chrono::duration_cast<Milliseconds>(task.Start).count()), uint32(std::chrono::duration_cast<Milliseconds>(task.Duration).count()));
+    }
+
+    std::chrono::microseconds criticalPathTime = std::chrono::microseconds::zero();
+    std::string criticalPath;
+    for (Trinity::TaskGraph::TaskId id : loaders.GetCriticalPath())
+    {
+        Trinity::TaskGraph::Task const& task = loaders.GetTasks()[id];
+        criticalPathTime += task.Duration;
+        if (!criticalPath.empty())
+            criticalPath += " > ";
+        criticalPath += Trinity::StringFormat("%s (%u ms)", task.Name.c_str(), uint32(std::chrono::duration_cast<Milliseconds>(task.Duration).count()));
+    }
+
+    TC_LOG_INFO("server.loading", ">> Startup loaders finished in %u ms on %u threads, %u ms of loading in total",
+        uint32(std::chrono::duration_cast<Milliseconds>(loaders.GetDuration()).count()), std::max(getIntConfig(CONFIG_STARTUP_LOADER_THREADS), 1u),
+        uint32(std::chrono::duration_cast<Milliseconds>(loadersTotal).count()));
+    TC_LOG_INFO("server.loading", ">> Startup loader critical path takes %u ms: %s",
+        uint32(std::chrono::duration_cast<Milliseconds>(criticalPathTime).count()), criticalPath.c_str());
 
     TC_LOG_INFO("server.loading", "Loading Weather Data...");
     WeatherMgr::LoadWeatherData();
@@ -2403,6 +2369,7 @@ void World::Update(uint32 diff)
     time_t currentGameTime = GameTime::GetGameTime();
 
     sWorldUpdateTime.UpdateWithDiff(diff);
+    sWorldTickProfiler.BeginTick();
 
     // Record update if recording set in log and diff is greater then minimum set in log
     sWorldUpdateTime.RecordUpdateTime(GameTime::GetGameTimeMS(), diff, GetActiveSessionCount());
@@ -2473,9 +2440,12 @@ void World::Update(uint32 diff)
     }
 
     /// <li> Handle session updates when the timer has passed
-    sWorldUpdateTime.RecordUpdateTimeReset();
-    UpdateSessions(diff);
-    sWorldUpdateTime.RecordUpdateTimeDuration("UpdateSessions");
+    {
+        TickProfilerScope profile(sWorldTickProfiler, TICK_PHASE_WORLD_SESSIONS);
+        sWorldUpdateTime.RecordUpdateTimeReset();
+        UpdateSessions(diff);
+        sWorldUpdateTime.RecordUpdateTimeDuration("UpdateSessions");
+    }
 
     /// <li> Update uptime table
     if (m_timers[WUPDATE_UPTIME].Passed())
@@ -2492,7 +2462,7 @@ void World::Update(uint32 diff)
         stmt->setUInt32(2, realm.Id.Realm);
         stmt->setUInt32(3, uint32(GameTime::GetStartTime()));
 
-        LoginDatabase.Execute(stmt);
+        LoginDatabase.Execute(stmt, DB_QUEUE_PRIORITY_BACKGROUND);
     }
 
     /// <li> Clean logs table
@@ -2508,19 +2478,28 @@ void World::Update(uint32 diff)
             stmt->setUInt32(1, uint32(time(0)));
             stmt->setUInt32(2, realm.Id.Realm);
 
-            LoginDatabase.Execute(stmt);
+            LoginDatabase.Execute(stmt, DB_QUEUE_PRIORITY_BACKGROUND);
         }
     }
 
     /// <li> Handle all other objects
     ///- Update objects when the timer has passed (maps, transport, creatures, ...)
-    sWorldUpdateTime.RecordUpdateTimeReset();
-    sMapMgr->Update(diff);
-    sWorldUpdateTime.RecordUpdateTimeDuration("UpdateMapMgr");
+    {
+        TickProfilerScope profile(sWorldTickProfiler, TICK_PHASE_WORLD_MAPS);
+        sWorldUpdateTime.RecordUpdateTimeReset();
+        sMapMgr->Update(diff);
+        sWorldUpdateTime.RecordUpdateTimeDuration("UpdateMapMgr");
+    }
 
-    sWorldUpdateTime.RecordUpdateTimeReset();
-    sTerrainMgr.Update(diff);
-    sWorldUpdateTime.RecordUpdateTimeDuration("UpdateTerrainMgr");
+    // logins and logouts free what they can right away, catch up on memory a reader was still holding
+    ObjectAccessor::ReclaimRetiredPlayerContainers();
+
+    {
+        TickProfilerScope profile(sWorldTickProfiler, TICK_PHASE_WORLD_TERRAIN);
+        sWorldUpdateTime.RecordUpdateTimeReset();
+        sTerrainMgr.Update(diff);
+        sWorldUpdateTime.RecordUpdateTimeDuration("UpdateTerrainMgr");
+    }
 
     if (sWorld->getBoolConfig(CONFIG_AUTOBROADCAST))
     {
@@ -2531,14 +2510,23 @@ void World::Update(uint32 diff)
         }
     }
 
-    sBattlegroundMgr->Update(diff);
-    sWorldUpdateTime.RecordUpdateTimeDuration("UpdateBattlegroundMgr");
+    {
+        TickProfilerScope profile(sWorldTickProfiler, TICK_PHASE_WORLD_BATTLEGROUNDS);
+        sBattlegroundMgr->Update(diff);
+        sWorldUpdateTime.RecordUpdateTimeDuration("UpdateBattlegroundMgr");
+    }
 
-    sOutdoorPvPMgr->Update(diff);
-    sWorldUpdateTime.RecordUpdateTimeDuration("UpdateOutdoorPvPMgr");
+    {
+        TickProfilerScope profile(sWorldTickProfiler, TICK_PHASE_WORLD_OUTDOORPVP);
+        sOutdoorPvPMgr->Update(diff);
+        sWorldUpdateTime.RecordUpdateTimeDuration("UpdateOutdoorPvPMgr");
+    }
 
-    sBattlefieldMgr->Update(diff);
-    sWorldUpdateTime.RecordUpdateTimeDuration("BattlefieldMgr");
+    {
+        TickProfilerScope profile(sWorldTickProfiler, TICK_PHASE_WORLD_BATTLEFIELDS);
+        sBattlefieldMgr->Update(diff);
+        sWorldUpdateTime.RecordUpdateTimeDuration("BattlefieldMgr");
+    }
 
     ///- Delete all characters which have been deleted X days before
     if (m_timers[WUPDATE_DELETECHARS].Passed())
@@ -2547,12 +2535,18 @@ void World::Update(uint32 diff)
         Player::DeleteOldCharacters();
     }
 
-    sLFGMgr->Update(diff);
-   sWorldUpdateTime.RecordUpdateTimeDuration("UpdateLFGMgr");
+    {
+        TickProfilerScope profile(sWorldTickProfiler, TICK_PHASE_WORLD_LFG);
+        sLFGMgr->Update(diff);
+        sWorldUpdateTime.RecordUpdateTimeDuration("UpdateLFGMgr");
+    }
 
     // execute callbacks from sql queries that were queued recently
-    ProcessQueryCallbacks();
-    sWorldUpdateTime.RecordUpdateTimeDuration("ProcessQueryCallbacks");
+    {
+        TickProfilerScope profile(sWorldTickProfiler, TICK_PHASE_WORLD_QUERY_CALLBACKS);
+        ProcessQueryCallbacks();
+        sWorldUpdateTime.RecordUpdateTimeDuration("ProcessQueryCallbacks");
+    }
 
     ///- Erase corpses once every 20 minutes
     if (m_timers[WUPDATE_CORPSES].Passed())
@@ -2600,9 +2594,17 @@ void World::Update(uint32 diff)
     }
 
     // And last, but not least handle the issued cli commands
-    ProcessCliCommands();
+    {
+        TickProfilerScope profile(sWorldTickProfiler, TICK_PHASE_WORLD_CLI_COMMANDS);
+        ProcessCliCommands();
+    }
+
+    {
+        TickProfilerScope profile(sWorldTickProfiler, TICK_PHASE_WORLD_SCRIPTS);
+        sScriptMgr->OnWorldUpdate(diff);
+    }
 
-    sScriptMgr->OnWorldUpdate(diff);
+    sWorldTickProfiler.EndTick();
 
     // Stats logger update
     sMetric->Update();
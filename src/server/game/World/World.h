@@ -102,6 +102,8 @@ enum WorldBoolConfigs : uint8
     CONFIG_CLEAN_CHARACTER_DB,
     CONFIG_GRID_UNLOAD,
     CONFIG_STATS_SAVE_ONLY_ON_LOGOUT,
+    CONFIG_PLAYER_SAVE_DIFFERENTIAL,
+    CONFIG_PLAYER_SAVE_DIFFERENTIAL_VERIFY,
     CONFIG_ALLOW_TWO_SIDE_INTERACTION_CALENDAR,
     CONFIG_ALLOW_TWO_SIDE_INTERACTION_CHANNEL,
     CONFIG_ALLOW_TWO_SIDE_INTERACTION_GROUP,
@@ -186,6 +188,7 @@ enum WorldBoolConfigs : uint8
     CONFIG_CHECK_GOBJECT_LOS,
     CONFIG_RESPAWN_DYNAMIC_ESCORTNPC,
     CONFIG_CACHE_DATA_QUERIES,
+    CONFIG_MAP_UPDATE_REGIONS,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -420,6 +423,10 @@ enum WorldIntConfigs : uint8
     CONFIG_RESPAWN_GUIDWARNING_FREQUENCY,
     CONFIG_RATED_BATTLEGROUND_ENABLE,
     CONFIG_PENDING_MOVE_CHANGES_TIMEOUT,
+    CONFIG_MAP_UPDATE_REGIONS_MIN_PLAYERS,
+    CONFIG_MAP_UPDATE_PATHFINDING_THREADS,
+    CONFIG_MMAP_PATH_CACHE_SIZE,
+    CONFIG_STARTUP_LOADER_THREADS,
     INT_CONFIG_VALUE_COUNT
 };
 
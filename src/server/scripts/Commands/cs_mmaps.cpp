@@ -141,7 +141,7 @@ public:
         // calculate navmesh tile location
         uint32 terrainMapId = PhasingHandler::GetTerrainMapId(player->GetPhaseShift(), player->GetMapId(), player->GetMap()->GetTerrain(), x, y);
         dtNavMesh const* navmesh = MMAP::MMapFactory::createOrGetMMapManager()->GetNavMesh(terrainMapId);
-        dtNavMeshQuery const* navmeshquery = MMAP::MMapFactory::createOrGetMMapManager()->GetNavMeshQuery(terrainMapId, player->GetMapId(), player->GetInstanceId());
+        MMAP::NavMeshQueryHandle navmeshquery = MMAP::MMapFactory::createOrGetMMapManager()->AcquireNavMeshQuery(terrainMapId);
         if (!navmesh || !navmeshquery)
         {
             handler->PSendSysMessage("NavMesh not loaded for current map.");
@@ -192,8 +192,7 @@ public:
         Player* player = handler->GetSession()->GetPlayer();
         uint32 terrainMapId = PhasingHandler::GetTerrainMapId(player->GetPhaseShift(), player->GetMapId(), player->GetMap()->GetTerrain(), player->GetPositionX(), player->GetPositionY());
         dtNavMesh const* navmesh = MMAP::MMapFactory::createOrGetMMapManager()->GetNavMesh(terrainMapId);
-        dtNavMeshQuery const* navmeshquery = MMAP::MMapFactory::createOrGetMMapManager()->GetNavMeshQuery(terrainMapId, player->GetMapId(), player->GetInstanceId());
-        if (!navmesh || !navmeshquery)
+        if (!navmesh)
         {
             handler->PSendSysMessage("NavMesh not loaded for current map.");
             return true;
@@ -259,6 +258,16 @@ public:
         handler->PSendSysMessage(" %u triangles (%u vertices)", triCount, triVertCount);
         handler->PSendSysMessage(" %.2f MB of data (not including pointers)", ((float)dataSize / sizeof(unsigned char)) / 1048576);
 
+        if (MMAP::NavMeshPathCache const* pathCache = manager->GetPathCache(terrainMapId))
+        {
+            MMAP::NavMeshPathCache::Stats stats = pathCache->GetStats();
+            uint64 lookups = stats.Hits + stats.Misses;
+            handler->PSendSysMessage("Path cache stats:");
+            handler->PSendSysMessage(" %u paths cached", uint32(pathCache->GetSize()));
+            handler->PSendSysMessage(" " UI64FMTD " hits, " UI64FMTD " misses (%.1f%% hit rate)", stats.Hits, stats.Misses, lookups ? float(stats.Hits) * 100.0f / lookups : 0.0f);
+            handler->PSendSysMessage(" " UI64FMTD " ms of navmesh searches saved", stats.SavedMicroseconds / 1000);
+        }
+
         return true;
     }
 
@@ -31,11 +31,14 @@ EndScriptData */
 #include "GitRevision.h"
 #include "Language.h"
 #include "Log.h"
+#include "Map.h"
+#include "MapManager.h"
 #include "MySQLThreading.h"
 #include "ObjectAccessor.h"
 #include "Player.h"
 #include "RBAC.h"
 #include "Realm.h"
+#include "TickProfiler.h"
 #include "UpdateTime.h"
 #include "Util.h"
 #include "VMapFactory.h"
@@ -46,6 +49,8 @@ EndScriptData */
 #include <boost/filesystem/operations.hpp>
 #include <openssl/crypto.h>
 #include <openssl/opensslv.h>
+#include <algorithm>
+#include <fstream>
 #include <numeric>
 
 class server_commandscript : public CommandScript
@@ -81,6 +86,12 @@ public:
             { ""   ,    rbac::RBAC_PERM_COMMAND_SERVER_SHUTDOWN,        true, &HandleServerShutDownCommand,       "" },
         };
 
+        static std::vector<ChatCommand> serverProfileCommandTable =
+        {
+            { "dump", rbac::RBAC_PERM_COMMAND_SERVER_PROFILE, true, &HandleServerProfileDumpCommand, "" },
+            { "",     rbac::RBAC_PERM_COMMAND_SERVER_PROFILE, true, &HandleServerProfileCommand,     "" },
+        };
+
         static std::vector<ChatCommand> serverSetCommandTable =
         {
             { "difftime", rbac::RBAC_PERM_COMMAND_SERVER_SET_DIFFTIME, true, &HandleServerSetDiffTimeCommand, "" },
@@ -99,6 +110,7 @@ public:
             { "info",         rbac::RBAC_PERM_COMMAND_SERVER_INFO,         true, &HandleServerInfoCommand,    "" },
             { "motd",         rbac::RBAC_PERM_COMMAND_SERVER_MOTD,         true, &HandleServerMotdCommand,    "" },
             { "plimit",       rbac::RBAC_PERM_COMMAND_SERVER_PLIMIT,       true, &HandleServerPLimitCommand,  "" },
+            { "profile",      rbac::RBAC_PERM_COMMAND_SERVER_PROFILE,      true, nullptr,                     "", serverProfileCommandTable },
             { "restart",      rbac::RBAC_PERM_COMMAND_SERVER_RESTART,      true, nullptr,                     "", serverRestartCommandTable },
             { "shutdown",     rbac::RBAC_PERM_COMMAND_SERVER_SHUTDOWN,     true, nullptr,                     "", serverShutdownCommandTable },
             { "set",          rbac::RBAC_PERM_COMMAND_SERVER_SET,          true, nullptr,                     "", serverSetCommandTable },
@@ -250,6 +262,11 @@ public:
         handler->PSendSysMessage("CharacterDatabase queue size: %zu", CharacterDatabase.QueueSize());
         handler->PSendSysMessage("WorldDatabase queue size: %zu", WorldDatabase.QueueSize());
         handler->PSendSysMessage("HotfixDatabase queue size: %zu", HotfixDatabase.QueueSize());
+
+        std::vector<MapUpdaterWorkerStats> workerStats = sMapMgr->GetMapUpdater()->get_worker_stats();
+        for (std::size_t i = 0; i < workerStats.size(); ++i)
+            handler->PSendSysMessage("Map update thread %zu: %.1f%% busy, " UI64FMTD " updates, " UI64FMTD " stolen",
+                i, workerStats[i].Utilization * 100.0f, workerStats[i].Requests, workerStats[i].Steals);
         return true;
     }
 
@@ -285,6 +302,125 @@ public:
         return true;
     }
 
+    static void SendTickPhases(ChatHandler* handler, TickProfiler::Summary const& summary)
+    {
+        for (uint8 phase = 0; phase < MAX_TICK_PHASES; ++phase)
+        {
+            TickProfiler::PhaseSummary const& phaseSummary = summary.Phases[phase];
+            if (!phaseSummary.Ticks)
+                continue;
+
+            handler->PSendSysMessage("  %s: avg %u us, max %u us, ran in %u ticks", GetTickPhaseName(TickPhase(phase)),
+                phaseSummary.GetAverage(), phaseSummary.Max, phaseSummary.Ticks);
+        }
+    }
+
+    // Show per phase update times of world and maps over last ticks
+    static bool HandleServerProfileCommand(ChatHandler* handler, char const* args)
+    {
+        if (!TickProfiler::IsEnabled())
+            handler->SendSysMessage("Tick profiler is disabled (TickProfiler.Enable), showing previously recorded ticks.");
+
+        if (*args)
+        {
+            char* mapIdStr = strtok((char*)args, " ");
+            char* instanceIdStr = strtok(nullptr, " ");
+            if (!mapIdStr)
+                return false;
+
+            uint32 mapId = uint32(atoul(mapIdStr));
+            Optional<uint32> instanceId;
+            if (instanceIdStr)
+                instanceId = uint32(atoul(instanceIdStr));
+
+            bool found = false;
+            sMapMgr->DoForAllMapsWithMapId(mapId, [&](Map* map)
+            {
+                if (instanceId && map->GetInstanceId() != *instanceId)
+                    return;
+
+                TickProfiler::Summary summary = map->GetTickProfiler().GetSummary();
+                handler->PSendSysMessage("Map %u (%s) instance %u: avg %u us, max %u us over %u ticks", map->GetId(), map->GetMapName(), map->GetInstanceId(),
+                    summary.Update.GetAverage(), summary.Update.Max, summary.Update.Ticks);
+                SendTickPhases(handler, summary);
+                found = true;
+            });
+
+            if (!found)
+                handler->PSendSysMessage("No map with id %u is loaded.", mapId);
+            return true;
+        }
+
+        TickProfiler::Summary worldSummary = sWorldTickProfiler.GetSummary();
+        handler->PSendSysMessage("World update: avg %u us, max %u us over %u ticks", worldSummary.Update.GetAverage(), worldSummary.Update.Max, worldSummary.Update.Ticks);
+        SendTickPhases(handler, worldSummary);
+
+        struct MapSummary
+        {
+            Map const* Source;
+            TickProfiler::PhaseSummary Update;
+        };
+
+        std::vector<MapSummary> maps;
+        sMapMgr->DoForAllMaps([&](Map* map)
+        {
+            maps.push_back({ map, map->GetTickProfiler().GetSummary().Update });
+        });
+
+        std::size_t const shownMaps = std::min<std::size_t>(maps.size(), 5);
+        std::partial_sort(maps.begin(), maps.begin() + shownMaps, maps.end(), [](MapSummary const& left, MapSummary const& right)
+        {
+            return left.Update.GetAverage() > right.Update.GetAverage();
+        });
+
+        handler->PSendSysMessage("Slowest maps (use .server profile #mapId [#instanceId] for details):");
+        for (std::size_t i = 0; i < shownMaps; ++i)
+            handler->PSendSysMessage("  Map %u (%s) instance %u: avg %u us, max %u us", maps[i].Source->GetId(), maps[i].Source->GetMapName(),
+                maps[i].Source->GetInstanceId(), maps[i].Update.GetAverage(), maps[i].Update.Max);
+
+        return true;
+    }
+
+    // Write recorded ticks of world and all maps in Chrome trace format (chrome://tracing, Perfetto) to logs directory
+    static bool HandleServerProfileDumpCommand(ChatHandler* handler, char const* args)
+    {
+        std::string fileName = *args ? args : "tick_profile.json";
+        if (fileName.find_first_of("/\\") != std::string::npos || fileName.find("..") != std::string::npos)
+        {
+            handler->SendSysMessage("File name must not contain a path.");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        std::string path = sLog->GetLogsDir() + fileName;
+        std::ofstream out(path, std::ios::out | std::ios::trunc);
+        if (!out)
+        {
+            handler->PSendSysMessage("Could not open %s for writing.", path.c_str());
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        out << R"({"displayTimeUnit":"ms","traceEvents":[)" << '\n';
+        out << R"({"name":"thread_name","ph":"M","pid":1,"tid":0,"args":{"name":"World"}})";
+        std::size_t events = sWorldTickProfiler.WriteTraceEvents(out, 0);
+
+        uint32 tid = 0;
+        sMapMgr->DoForAllMaps([&](Map* map)
+        {
+            ++tid;
+            out << ",\n" << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << tid << R"(,"args":{"name":"Map )"
+                << map->GetId() << " instance " << map->GetInstanceId() << R"("}})";
+            events += map->GetTickProfiler().WriteTraceEvents(out, tid);
+        });
+
+        out << "\n]}\n";
+        out.close();
+
+        handler->PSendSysMessage("Written " SZFMTD " events of world and %u maps to %s.", events, tid, path.c_str());
+        return true;
+    }
+
     static bool HandleServerPLimitCommand(ChatHandler* handler, char const* args)
     {
         if (*args)
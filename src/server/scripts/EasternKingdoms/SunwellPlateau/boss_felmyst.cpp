@@ -150,7 +150,7 @@ public:
 
             me->SetDisableGravity(true);
             me->SetFloatValue(UNIT_FIELD_BOUNDINGRADIUS, 10);
-            me->SetFloatValue(UNIT_FIELD_COMBATREACH, 10);
+            me->SetCombatReach(10);
 
             DespawnSummons(NPC_VAPOR_TRAIL);
             me->setActive(false);
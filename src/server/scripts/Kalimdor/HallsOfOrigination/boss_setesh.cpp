@@ -333,7 +333,7 @@ public:
         {
             me->SetDisableGravity(true);
             me->SetFloatValue(UNIT_FIELD_BOUNDINGRADIUS, 7.0f);
-            me->SetFloatValue(UNIT_FIELD_COMBATREACH, 7.0f);
+            me->SetCombatReach(7.0f);
             me->SetFaction(FACTION_FRIENDLY);
 
             DoCastSelf(SPELL_SEED_OF_CHAOS_DUMMY);
@@ -46,125 +46,85 @@ DB2FileLoader::DB2FileLoader()
 
 bool DB2FileLoader::Load(char const* filename, char const* fmt)
 {
-    if (data)
-    {
-        delete [] data;
-        data = nullptr;
-    }
+    data = nullptr;
+    stringTable = nullptr;
+    delete[] fieldsOffset;
+    fieldsOffset = nullptr;
 
-    FILE* f = fopen(filename, "rb");
-    if (!f)
+    // records are read straight from the mapped file, pages only get loaded when touched
+    if (!file.Open(filename))
         return false;
 
-    uint32 header;
-    if (fread(&header, 4, 1, f) != 1)                        // Signature
+    unsigned char* position = file.GetData();
+    unsigned char* end = position + file.GetSize();
+    auto read = [&](auto& value)
     {
-        fclose(f);
-        return false;
-    }
+        if (std::size_t(end - position) < sizeof(value))
+            return false;
+
+        memcpy(&value, position, sizeof(value));
+        EndianConvert(value);
+        position += sizeof(value);
+        return true;
+    };
 
-    EndianConvert(header);
+    uint32 header;
+    if (!read(header))                                      // Signature
+        return false;
 
     if (header != 0x32424457)
-    {
-        fclose(f);
         return false;                                       //'WDB2'
-    }
 
-    if (fread(&recordCount, 4, 1, f) != 1)                 // Number of records
-    {
-        fclose(f);
+    if (!read(recordCount))                                 // Number of records
         return false;
-    }
-
-    EndianConvert(recordCount);
 
-    if (fread(&fieldCount, 4, 1, f) != 1)                 // Number of fields
-    {
-        fclose(f);
+    if (!read(fieldCount))                                  // Number of fields
         return false;
-    }
-
-    EndianConvert(fieldCount);
 
-    if (fread(&recordSize, 4, 1, f) != 1)                 // Size of a record
-    {
-        fclose(f);
+    if (!read(recordSize))                                  // Size of a record
         return false;
-    }
-
-    EndianConvert(recordSize);
 
-    if (fread(&stringSize, 4, 1, f) != 1)                 // String size
-    {
-        fclose(f);
+    if (!read(stringSize))                                  // String size
         return false;
-    }
-
-    EndianConvert(stringSize);
 
     /* NEW WDB2 FIELDS*/
-    if (fread(&tableHash, 4, 1, f) != 1)                  // Table hash
-    {
-        fclose(f);
+    if (!read(tableHash))                                   // Table hash
         return false;
-    }
 
-    EndianConvert(tableHash);
-
-    if (fread(&build, 4, 1, f) != 1)                     // Build
-    {
-        fclose(f);
+    if (!read(build))                                       // Build
         return false;
-    }
-
-    EndianConvert(build);
 
-    if (fread(&unk1, 4, 1, f) != 1)                     // Unknown WDB2
-    {
-        fclose(f);
+    if (!read(unk1))                                        // Unknown WDB2
         return false;
-    }
-
-    EndianConvert(unk1);
 
     if (build > 12880)
     {
-        if (fread(&minIndex, 4, 1, f) != 1)                           // MinIndex WDB2
-        {
-            fclose(f);
+        if (!read(minIndex))                                // MinIndex WDB2
             return false;
-        }
-        EndianConvert(minIndex);
 
-        if (fread(&maxIndex, 4, 1, f) != 1)                           // MaxIndex WDB2
-        {
-            fclose(f);
+        if (!read(maxIndex))                                // MaxIndex WDB2
             return false;
-        }
-        EndianConvert(maxIndex);
 
-        if (fread(&locale, 4, 1, f) != 1)                             // Locales
-        {
-            fclose(f);
+        if (!read(locale))                                  // Locales
             return false;
-        }
-        EndianConvert(locale);
 
-        if (fread(&unk5, 4, 1, f) != 1)                               // Unknown WDB2
-        {
-            fclose(f);
+        if (!read(unk5))                                    // Unknown WDB2
             return false;
-        }
-        EndianConvert(unk5);
     }
 
     if (maxIndex != 0)
     {
         int32 diff = maxIndex - minIndex + 1;
-        fseek(f, diff * 4 + diff * 2, SEEK_CUR);    // diff * 4: an index for rows, diff * 2: a memory allocation bank
+        uint64 skip = uint64(diff) * 4 + uint64(diff) * 2;  // diff * 4: an index for rows, diff * 2: a memory allocation bank
+        if (uint64(end - position) < skip)
+            return false;
+
+        position += skip;
     }
 
+    if (uint64(recordSize) * recordCount + stringSize > uint64(end - position))
+        return false;
+
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
     for (uint32 i = 1; i < fieldCount; i++)
@@ -176,25 +136,14 @@ bool DB2FileLoader::Load(char const* filename, char const* fmt)
             fieldsOffset[i] += 4;
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
+    data = position;
     stringTable = data + recordSize * recordCount;
-
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
     return true;
 }
 
 DB2FileLoader::~DB2FileLoader()
 {
-    if (data)
-        delete [] data;
-    if (fieldsOffset)
-        delete [] fieldsOffset;
+    delete[] fieldsOffset;
 }
 
 DB2FileLoader::Record DB2FileLoader::getRecord(size_t id)
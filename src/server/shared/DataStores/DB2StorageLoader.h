@@ -19,6 +19,7 @@
 #define DB2_FILE_LOADER_H
 
 #include "Define.h"
+#include "MappedFile.h"
 #include "Utilities/ByteConverter.h"
 #include <cassert>
 #include <list>
@@ -87,6 +88,7 @@ class TC_SHARED_API DB2FileLoader
     static uint32 GetFormatStringFieldCount(const char* format);
 private:
 
+    Trinity::MappedFile file;
     uint32 recordSize;
     uint32 recordCount;
     uint32 fieldCount;
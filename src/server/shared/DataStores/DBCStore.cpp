@@ -17,6 +17,67 @@
 
 #include "DBCStore.h"
 #include "DBCDatabaseLoader.h"
+#include "Log.h"
+#include <boost/filesystem/operations.hpp>
+#include <cstdio>
+
+namespace
+{
+    uint32 const DBC_CACHE_SIGNATURE = 0x43424454;          // 'TDBC'
+    uint32 const DBC_CACHE_VERSION = 1;
+    uint32 const DBC_CACHE_UNUSED_RECORD = 0xFFFFFFFF;       // record replaced by a later one with the same index
+
+    // header, format string, index of each record and converted records, each block 8 byte aligned
+    struct DBCCacheHeader
+    {
+        uint32 Signature;
+        uint32 Version;
+        uint64 SourceSize;
+        int64 SourceWriteTime;
+        uint32 FieldCount;
+        uint32 RecordCount;
+        uint32 RecordSize;
+        uint32 IndexTableSize;
+    };
+
+    struct DBCCacheLayout
+    {
+        DBCCacheLayout(uint32 fieldCount, uint32 recordCount, uint32 recordSize)
+        {
+            FormatOffset = sizeof(DBCCacheHeader);
+            IndexOffset = Align(FormatOffset + fieldCount);
+            DataOffset = Align(IndexOffset + uint64(recordCount) * sizeof(uint32));
+            Size = DataOffset + uint64(recordCount) * recordSize;
+        }
+
+        static uint64 Align(uint64 offset) { return (offset + 7) & ~uint64(7); }
+
+        uint64 FormatOffset;
+        uint64 IndexOffset;
+        uint64 DataOffset;
+        uint64 Size;
+    };
+
+    bool GetSourceStamp(std::string const& path, uint64& size, int64& writeTime)
+    {
+        boost::system::error_code error;
+        size = boost::filesystem::file_size(path, error);
+        if (error)
+            return false;
+
+        writeTime = boost::filesystem::last_write_time(path, error);
+        return !error;
+    }
+
+    bool HasStringFields(char const* format)
+    {
+        for (; *format; ++format)
+            if (*format == FT_STRING)
+                return true;
+
+        return false;
+    }
+}
 
 DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _dataTableEx(nullptr), _indexTableSize(0)
 {
@@ -24,13 +85,14 @@ DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fm
 
 DBCStorageBase::~DBCStorageBase()
 {
-    delete[] _dataTable;
+    if (!_mappedFile)
+        delete[] _dataTable;
     delete[] _dataTableEx;
     for (char* strings : _stringPool)
         delete[] strings;
 }
 
-bool DBCStorageBase::Load(std::string const& path, char**& indexTable)
+bool DBCStorageBase::Load(std::string const& path, std::string const& cacheDir, char**& indexTable)
 {
     indexTable = nullptr;
 
@@ -41,6 +103,23 @@ bool DBCStorageBase::Load(std::string const& path, char**& indexTable)
 
     _fieldCount = dbc.GetCols();
 
+    // records already have the layout of the structure, use them straight from the mapped file
+    if (dbc.IsLayoutMatching(_fileFormat))
+    {
+        _dataTable = dbc.ProduceDataInPlace(_fileFormat, _indexTableSize, indexTable);
+        _mappedFile = dbc.ReleaseFile();
+        return true;
+    }
+
+    // string fields hold pointers and are overwritten by every locale, only tables without them can be cached
+    std::string cacheFile;
+    if (!cacheDir.empty() && !HasStringFields(_fileFormat))
+    {
+        cacheFile = (boost::filesystem::path(cacheDir) / boost::filesystem::path(path).filename()).string() + ".cache";
+        if (LoadFromCache(cacheFile, path, indexTable))
+            return true;
+    }
+
     // load raw non-string data
     _dataTable = dbc.AutoProduceData(_fileFormat, _indexTableSize, indexTable);
 
@@ -49,7 +128,123 @@ bool DBCStorageBase::Load(std::string const& path, char**& indexTable)
         _stringPool.push_back(stringBlock);
 
     // error in dbc file at loading if NULL
-    return indexTable != nullptr;
+    if (!indexTable)
+        return false;
+
+    // converted data is used from the heap this time, next start maps the cache
+    if (!cacheFile.empty() && !WriteCache(cacheFile, path, dbc.GetNumRows(), indexTable))
+        TC_LOG_WARN("server.loading", "Could not write DBC cache file %s, %s will be converted again on next start.", cacheFile.c_str(), path.c_str());
+
+    return true;
+}
+
+bool DBCStorageBase::LoadFromCache(std::string const& cacheFile, std::string const& path, char**& indexTable)
+{
+    uint64 sourceSize;
+    int64 sourceWriteTime;
+    if (!GetSourceStamp(path, sourceSize, sourceWriteTime))
+        return false;
+
+    std::unique_ptr<Trinity::MappedFile> cache = std::make_unique<Trinity::MappedFile>();
+    if (!cache->Open(cacheFile.c_str()) || cache->GetSize() < sizeof(DBCCacheHeader))
+        return false;
+
+    DBCCacheHeader header;
+    memcpy(&header, cache->GetData(), sizeof(header));
+
+    // outdated caches are silently replaced
+    uint32 fieldCount = uint32(strlen(_fileFormat));
+    if (header.Signature != DBC_CACHE_SIGNATURE || header.Version != DBC_CACHE_VERSION
+        || header.SourceSize != sourceSize || header.SourceWriteTime != sourceWriteTime
+        || header.FieldCount != fieldCount || header.RecordSize != DBCFileLoader::GetFormatRecordSize(_fileFormat))
+        return false;
+
+    DBCCacheLayout layout(header.FieldCount, header.RecordCount, header.RecordSize);
+    if (cache->GetSize() != layout.Size || memcmp(cache->GetData() + layout.FormatOffset, _fileFormat, fieldCount) != 0)
+        return false;
+
+    uint32 const* recordIndexes = reinterpret_cast<uint32 const*>(cache->GetData() + layout.IndexOffset);
+    char* dataTable = reinterpret_cast<char*>(cache->GetData() + layout.DataOffset);
+
+    indexTable = new char*[header.IndexTableSize]();
+    for (uint32 y = 0; y < header.RecordCount; ++y)
+    {
+        if (recordIndexes[y] == DBC_CACHE_UNUSED_RECORD)
+            continue;
+
+        if (recordIndexes[y] >= header.IndexTableSize)
+        {
+            delete[] indexTable;
+            indexTable = nullptr;
+            return false;
+        }
+
+        indexTable[recordIndexes[y]] = &dataTable[y * header.RecordSize];
+    }
+
+    _dataTable = dataTable;
+    _indexTableSize = header.IndexTableSize;
+    _mappedFile = std::move(cache);
+    return true;
+}
+
+bool DBCStorageBase::WriteCache(std::string const& cacheFile, std::string const& path, uint32 recordCount, char** indexTable) const
+{
+    DBCCacheHeader header = { };
+    header.Signature = DBC_CACHE_SIGNATURE;
+    header.Version = DBC_CACHE_VERSION;
+    if (!GetSourceStamp(path, header.SourceSize, header.SourceWriteTime))
+        return false;
+
+    header.FieldCount = uint32(strlen(_fileFormat));
+    header.RecordCount = recordCount;
+    header.RecordSize = DBCFileLoader::GetFormatRecordSize(_fileFormat);
+    header.IndexTableSize = _indexTableSize;
+
+    // records are stored in file order, AutoProduceData laid them out the same way
+    std::vector<uint32> recordIndexes(recordCount, DBC_CACHE_UNUSED_RECORD);
+    for (uint32 i = 0; i < _indexTableSize; ++i)
+        if (indexTable[i])
+            recordIndexes[(indexTable[i] - _dataTable) / header.RecordSize] = i;
+
+    DBCCacheLayout layout(header.FieldCount, header.RecordCount, header.RecordSize);
+    std::vector<char> content(layout.DataOffset);
+    memcpy(content.data(), &header, sizeof(header));
+    memcpy(content.data() + layout.FormatOffset, _fileFormat, header.FieldCount);
+    memcpy(content.data() + layout.IndexOffset, recordIndexes.data(), recordIndexes.size() * sizeof(uint32));
+
+    boost::system::error_code error;
+    boost::filesystem::path target(cacheFile);
+    boost::filesystem::create_directories(target.parent_path(), error);
+    if (error)
+        return false;
+
+    // other processes may be loading the same cache, only replace it once complete
+    boost::filesystem::path temporary = boost::filesystem::unique_path(target.string() + ".%%%%%%", error);
+    if (error)
+        return false;
+
+    FILE* f = fopen(temporary.string().c_str(), "wb");
+    if (!f)
+        return false;
+
+    bool written = fwrite(content.data(), content.size(), 1, f) == 1;
+    if (written && recordCount && header.RecordSize)
+        written = fwrite(_dataTable, uint64(recordCount) * header.RecordSize, 1, f) == 1;
+
+    if (fclose(f) != 0)
+        written = false;
+
+    if (written)
+        boost::filesystem::rename(temporary, target, error);
+
+    if (!written || error)
+    {
+        boost::filesystem::remove(temporary, error);
+        return false;
+    }
+
+    return true;
 }
 
 bool DBCStorageBase::LoadStringsFrom(std::string const& path, char**& indexTable)
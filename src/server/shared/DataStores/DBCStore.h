@@ -20,6 +20,8 @@
 
 #include "Common.h"
 #include "DBStorageIterator.h"
+#include "MappedFile.h"
+#include <memory>
 #include <vector>
 
  /// Interface class for common access
@@ -32,21 +34,27 @@ class TC_SHARED_API DBCStorageBase
         char const* GetFormat() const { return _fileFormat; }
         uint32 GetFieldCount() const { return _fieldCount; }
 
-        virtual bool Load(std::string const& path) = 0;
+        // cacheDir is where converted copies of files without strings are kept for later starts, empty disables it
+        virtual bool Load(std::string const& path, std::string const& cacheDir) = 0;
         virtual bool LoadStringsFrom(std::string const& path) = 0;
         virtual void LoadFromDB(std::string const& path, std::string const& dbFormat, std::string const& primaryKey) = 0;
 
     protected:
-        bool Load(std::string const& path, char**& indexTable);
+        bool Load(std::string const& path, std::string const& cacheDir, char**& indexTable);
         bool LoadStringsFrom(std::string const& path, char**& indexTable);
         void LoadFromDB(std::string const& path, std::string const& dbFormat, std::string const& primaryKey, char**& indexTable);
 
         uint32 _fieldCount;
         char const* _fileFormat;
-        char* _dataTable;
+        char* _dataTable;                                   // points into _mappedFile when it is set
         char* _dataTableEx;
+        std::unique_ptr<Trinity::MappedFile> _mappedFile;
         std::vector<char*> _stringPool;
         uint32 _indexTableSize;
+
+    private:
+        bool LoadFromCache(std::string const& cacheFile, std::string const& path, char**& indexTable);
+        bool WriteCache(std::string const& cacheFile, std::string const& path, uint32 recordCount, char** indexTable) const;
 };
 
 template <class T>
@@ -70,9 +78,9 @@ class DBCStorage : public DBCStorageBase
 
         uint32 GetNumRows() const { return _indexTableSize; }
 
-        bool Load(std::string const& path) override
+        bool Load(std::string const& path, std::string const& cacheDir) override
         {
-            return DBCStorageBase::Load(path, _indexTable.AsChar);
+            return DBCStorageBase::Load(path, cacheDir, _indexTable.AsChar);
         }
 
         bool LoadStringsFrom(std::string const& path) override
@@ -19,21 +19,32 @@
 #define __SOCKET_H__
 
 #include "MessageBuffer.h"
+#include "ByteBuffer.h"
 #include "Log.h"
+#include "Metric.h"
 #include <atomic>
-#include <queue>
+#include <deque>
 #include <memory>
 #include <functional>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include <boost/asio/ip/tcp.hpp>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
+// maximum number of buffers handed to a single vectored write
+#define WRITE_BATCH_SIZE 64
+// maximum number of sent buffers kept by each socket for reuse
+#define WRITE_BUFFER_POOL_SIZE 8
 #ifdef BOOST_ASIO_HAS_IOCP
 #define TC_SOCKET_USE_IOCP
 #endif
 
+// payloads shared with other sockets, each sent after the given number of bytes of the buffer it is queued with
+typedef std::vector<std::pair<std::size_t, std::shared_ptr<ByteBuffer const>>> SharedPayloadList;
+
 template<class T>
 class Socket : public std::enable_shared_from_this<T>
 {
@@ -101,9 +112,10 @@ public:
             std::bind(callback, this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
     }
 
-    void QueuePacket(MessageBuffer&& buffer)
+    /// packetCount is the number of packets written into buffer, only used for write statistics
+    void QueuePacket(MessageBuffer&& buffer, SharedPayloadList&& sharedPayloads = {}, uint32 packetCount = 1)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.emplace_back(std::move(buffer), std::move(sharedPayloads), packetCount);
 
 #ifdef TC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -138,6 +150,28 @@ public:
 
     MessageBuffer& GetReadBuffer() { return _readBuffer; }
 
+    /// Returns an empty buffer of given size for QueuePacket, reusing storage of already sent buffers when possible
+    MessageBuffer AcquireWriteBuffer(std::size_t size)
+    {
+        if (_writeBufferPool.empty())
+            return MessageBuffer(size);
+
+        MessageBuffer buffer(std::move(_writeBufferPool.back()));
+        _writeBufferPool.pop_back();
+        buffer.Resize(size);
+        return buffer;
+    }
+
+    /// Returns storage of a buffer that will not be queued to the pool
+    void RecycleWriteBuffer(MessageBuffer&& buffer)
+    {
+        if (_writeBufferPool.size() >= WRITE_BUFFER_POOL_SIZE)
+            return;
+
+        buffer.Reset();
+        _writeBufferPool.push_back(std::move(buffer));
+    }
+
 protected:
     virtual void OnClose() { }
 
@@ -151,8 +185,8 @@ protected:
         _isWritingAsync = true;
 
 #ifdef TC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()), std::bind(&Socket<T>::WriteHandler,
+        PrepareWriteBuffers();
+        _socket.async_write_some(_writeBuffers, std::bind(&Socket<T>::WriteHandler,
             this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
 #else
         _socket.async_write_some(boost::asio::null_buffers(), std::bind(&Socket<T>::WriteHandlerWrapper,
@@ -172,6 +206,56 @@ protected:
     }
 
 private:
+    /// Queued buffer with the shared payloads that are written in between its bytes
+    struct QueuedWrite
+    {
+        QueuedWrite(MessageBuffer&& buffer, SharedPayloadList&& sharedPayloads, uint32 packetCount) : Buffer(std::move(buffer)),
+            SharedPayloads(std::move(sharedPayloads)), Size(Buffer.GetActiveSize()), Sent(0), PacketCount(packetCount)
+        {
+            for (auto const& [offset, payload] : SharedPayloads)
+                Size += payload->size();
+        }
+
+        /// Appends the bytes not sent yet to buffers, returns false if WRITE_BATCH_SIZE was reached before the end
+        bool AddUnsent(std::vector<boost::asio::const_buffer>& buffers)
+        {
+            std::size_t skip = Sent;
+            auto add = [&](uint8 const* data, std::size_t size)
+            {
+                if (skip >= size)
+                {
+                    skip -= size;
+                    return true;
+                }
+
+                if (buffers.size() >= WRITE_BATCH_SIZE)
+                    return false;
+
+                buffers.emplace_back(data + skip, size - skip);
+                skip = 0;
+                return true;
+            };
+
+            uint8 const* data = Buffer.GetReadPointer();
+            std::size_t position = 0;
+            for (auto const& [offset, payload] : SharedPayloads)
+            {
+                if (!add(data + position, offset - position) || (!payload->empty() && !add(payload->contents(), payload->size())))
+                    return false;
+
+                position = offset;
+            }
+
+            return add(data + position, Buffer.GetActiveSize() - position);
+        }
+
+        MessageBuffer Buffer;
+        SharedPayloadList SharedPayloads;
+        std::size_t Size;
+        std::size_t Sent;
+        uint32 PacketCount;
+    };
+
     void ReadHandlerInternal(boost::system::error_code error, size_t transferredBytes)
     {
         if (error)
@@ -184,6 +268,52 @@ private:
         ReadHandler();
     }
 
+    /// Packets per write call are socket_written_packets / socket_write_calls, packets count once their last byte is sent
+    static void RecordWrite(uint32 packetCount, std::size_t bytes)
+    {
+        TC_METRIC_COUNTER("socket_write_calls", 1);
+        TC_METRIC_COUNTER("socket_written_packets", packetCount);
+        TC_METRIC_COUNTER("socket_written_bytes", bytes);
+    }
+
+    /// Fills _writeBuffers with the unsent bytes of the first queued buffers, returns their total size
+    std::size_t PrepareWriteBuffers()
+    {
+        _writeBuffers.clear();
+        for (QueuedWrite& queued : _writeQueue)
+            if (!queued.AddUnsent(_writeBuffers))
+                break;
+
+        return boost::asio::buffer_size(_writeBuffers);
+    }
+
+    /// Removes fully sent buffers from the queue and advances the first partially sent one, returns the number of packets fully sent
+    uint32 WriteCompleted(std::size_t bytesSent)
+    {
+        uint32 packetCount = 0;
+        while (bytesSent)
+        {
+            QueuedWrite& queued = _writeQueue.front();
+            if (bytesSent < queued.Size - queued.Sent)
+            {
+                queued.Sent += bytesSent;
+                break;
+            }
+
+            bytesSent -= queued.Size - queued.Sent;
+            packetCount += queued.PacketCount;
+            PopWriteQueue();
+        }
+
+        return packetCount;
+    }
+
+    void PopWriteQueue()
+    {
+        RecycleWriteBuffer(std::move(_writeQueue.front().Buffer));
+        _writeQueue.pop_front();
+    }
+
 #ifdef TC_SOCKET_USE_IOCP
 
     void WriteHandler(boost::system::error_code error, std::size_t transferedBytes)
@@ -191,9 +321,7 @@ private:
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            RecordWrite(WriteCompleted(transferedBytes), transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -217,37 +345,35 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        std::size_t bytesToSend = PrepareWriteBuffers();
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(_writeBuffers, error);
 
         if (error)
         {
             if (error == boost::asio::error::would_block || error == boost::asio::error::try_again)
                 return AsyncProcessQueue();
 
-            _writeQueue.pop();
+            PopWriteQueue();
             if (_closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            PopWriteQueue();
             if (_closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
         else if (bytesSent < bytesToSend) // now n > 0
         {
-            queuedMessage.ReadCompleted(bytesSent);
+            RecordWrite(WriteCompleted(bytesSent), bytesSent);
             return AsyncProcessQueue();
         }
 
-        _writeQueue.pop();
+        RecordWrite(WriteCompleted(bytesSent), bytesSent);
         if (_closing && _writeQueue.empty())
             CloseSocket();
         return !_writeQueue.empty();
@@ -261,7 +387,9 @@ private:
     uint16 _remotePort;
 
     MessageBuffer _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<QueuedWrite> _writeQueue;
+    std::vector<boost::asio::const_buffer> _writeBuffers;
+    std::vector<MessageBuffer> _writeBufferPool;
 
     std::atomic<bool> _closed;
     std::atomic<bool> _closing;
@@ -122,6 +122,15 @@ class TC_SHARED_API ByteBuffer
             _rpos = _wpos = 0;
         }
 
+        // Gives up the storage so its capacity can be reused by another buffer
+        std::vector<uint8>&& Move() noexcept
+        {
+            _rpos = _wpos = 0;
+            _bitpos = InitialBitPos;
+            _curbitval = 0;
+            return std::move(_storage);
+        }
+
         template <typename T> void append(T value)
         {
             static_assert(std::is_fundamental<T>::value, "append(compound)");
@@ -536,6 +545,7 @@ class TC_SHARED_API ByteBuffer
         }
 
         size_t size() const { return _storage.size(); }
+        size_t capacity() const { return _storage.capacity(); }
         bool empty() const { return _storage.empty(); }
 
         void resize(size_t newsize)
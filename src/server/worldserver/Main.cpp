@@ -202,8 +202,8 @@ extern int main(int argc, char** argv)
     std::shared_ptr<Trinity::Asio::IoContext> ioContext = std::make_shared<Trinity::Asio::IoContext>();
 
     sLog->RegisterAppender<AppenderDB>();
-    // If logs are supposed to be handled async then we need to pass the IoContext into the Log singleton
-    sLog->Initialize(sConfigMgr->GetBoolDefault("Log.Async.Enable", false) ? ioContext.get() : nullptr);
+    // Async logging hands messages to a dedicated writer thread
+    sLog->Initialize(sConfigMgr->GetBoolDefault("Log.Async.Enable", false));
 
     Trinity::Banner::Show("worldserver-daemon",
         [](char const* text)
@@ -279,8 +279,11 @@ extern int main(int argc, char** argv)
         TC_METRIC_VALUE("online_players", sWorld->GetPlayerCount());
         TC_METRIC_VALUE("db_queue_login", LoginDatabase.QueueSize());
         TC_METRIC_VALUE("db_queue_character", CharacterDatabase.QueueSize());
+        TC_METRIC_VALUE("db_queue_character_interactive", CharacterDatabase.QueueSize(DB_QUEUE_PRIORITY_INTERACTIVE));
+        TC_METRIC_VALUE("db_queue_login_interactive", LoginDatabase.QueueSize(DB_QUEUE_PRIORITY_INTERACTIVE));
         TC_METRIC_VALUE("db_queue_world", WorldDatabase.QueueSize());
         TC_METRIC_VALUE("db_queue_hotfix", HotfixDatabase.QueueSize());
+        TC_METRIC_VALUE("log_dropped_messages", sLog->GetDroppedMessages());
     });
 
     TC_METRIC_EVENT("events", "Worldserver started", "");
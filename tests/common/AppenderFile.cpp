@@ -0,0 +1,72 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "AppenderFile.h"
+#include "LogMessage.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("File appender written from several threads without a log writer", "[AppenderFile]")
+{
+    constexpr int Threads = 4;
+    constexpr int PerThread = 2000;
+
+    std::string fileName = (std::filesystem::temp_directory_path() / "tc_test_appender_file.log").string();
+    std::remove(fileName.c_str());
+
+    {
+        AppenderFile appender(0, "test", LOG_LEVEL_DEBUG, APPENDER_FLAGS_NONE, { fileName.c_str(), "w" });
+
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < Threads; ++thread)
+        {
+            threads.emplace_back([&appender, thread]()
+            {
+                for (int i = 0; i < PerThread; ++i)
+                {
+                    LogMessage message(LOG_LEVEL_INFO, "test", "line " + std::to_string(thread * PerThread + i));
+                    appender.write(&message);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+    // every line is written whole and exactly once
+    std::ifstream file(fileName);
+    std::set<std::string> lines;
+    std::size_t count = 0;
+    for (std::string line; std::getline(file, line); ++count)
+        lines.insert(line);
+
+    file.close();
+    std::remove(fileName.c_str());
+
+    REQUIRE(count == Threads * PerThread);
+    REQUIRE(lines.size() == Threads * PerThread);
+    for (int i = 0; i < Threads * PerThread; ++i)
+        REQUIRE(lines.count("line " + std::to_string(i)) == 1);
+}
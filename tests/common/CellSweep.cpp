@@ -0,0 +1,154 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "CellSweep.h"
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <random>
+#include <utility>
+
+namespace
+{
+constexpr uint32 CellsPerGrid = 8;
+constexpr uint32 GridsPerMap = 64;
+constexpr uint32 CellsPerMap = CellsPerGrid * GridsPerMap;
+
+struct TestCell
+{
+    std::vector<int> GridObjects;
+    std::vector<int> WorldObjects;
+};
+
+struct TestGrid
+{
+    bool ObjectDataLoaded = true;
+    std::array<std::array<TestCell, CellsPerGrid>, CellsPerGrid> Cells;
+};
+
+struct TestMap
+{
+    std::array<std::array<std::unique_ptr<TestGrid>, GridsPerMap>, GridsPerMap> Grids;
+
+    TestCell& AddCell(uint32 cellX, uint32 cellY)
+    {
+        std::unique_ptr<TestGrid>& grid = Grids[cellX / CellsPerGrid][cellY / CellsPerGrid];
+        if (!grid)
+            grid = std::make_unique<TestGrid>();
+
+        return grid->Cells[cellX % CellsPerGrid][cellY % CellsPerGrid];
+    }
+
+    // Map::Visit with a NoCreate cell for the grid objects and then for the world objects of every cell
+    std::vector<int> Visit(std::vector<std::pair<uint32, uint32>> const& cells) const
+    {
+        std::vector<int> visited;
+        for (auto [cellX, cellY] : cells)
+        {
+            TestGrid const* grid = Grids[cellX / CellsPerGrid][cellY / CellsPerGrid].get();
+            if (!grid || !grid->ObjectDataLoaded)
+                continue;
+
+            TestCell const& cell = grid->Cells[cellX % CellsPerGrid][cellY % CellsPerGrid];
+            visited.insert(visited.end(), cell.GridObjects.begin(), cell.GridObjects.end());
+            visited.insert(visited.end(), cell.WorldObjects.begin(), cell.WorldObjects.end());
+        }
+
+        return visited;
+    }
+
+    std::vector<int> Sweep(std::vector<uint32> const& cellIds)
+    {
+        std::vector<int> visited;
+        Trinity::SweepCells<CellsPerGrid, CellsPerMap>(cellIds,
+            [this](uint32 gridX, uint32 gridY) -> TestGrid*
+            {
+                TestGrid* grid = Grids[gridX][gridY].get();
+                return grid && grid->ObjectDataLoaded ? grid : nullptr;
+            },
+            [](TestGrid& grid, uint32 cellX, uint32 cellY) -> TestCell& { return grid.Cells[cellX][cellY]; },
+            [&](TestCell& cell)
+            {
+                visited.insert(visited.end(), cell.GridObjects.begin(), cell.GridObjects.end());
+                visited.insert(visited.end(), cell.WorldObjects.begin(), cell.WorldObjects.end());
+            });
+
+        return visited;
+    }
+};
+
+// cell ids as Map::markCell stores them
+uint32 GetCellId(uint32 cellX, uint32 cellY)
+{
+    return cellY * CellsPerMap + cellX;
+}
+}
+
+TEST_CASE("Sweep visits objects in Map::Visit order", "[CellSweep]")
+{
+    TestMap map;
+    std::mt19937 random(12345);
+    std::uniform_int_distribution<uint32> coordinate(0, CellsPerMap - 1);
+    std::uniform_int_distribution<int> objectCount(0, 3);
+
+    // cells are collected per player and active object, not sorted by position
+    std::vector<std::pair<uint32, uint32>> cells;
+    int nextObject = 0;
+    for (int i = 0; i < 500; ++i)
+    {
+        uint32 cellX = coordinate(random);
+        uint32 cellY = coordinate(random);
+        TestCell& cell = map.AddCell(cellX, cellY);
+        for (int count = objectCount(random); count > 0; --count)
+            cell.GridObjects.push_back(nextObject++);
+        for (int count = objectCount(random); count > 0; --count)
+            cell.WorldObjects.push_back(nextObject++);
+
+        cells.emplace_back(cellX, cellY);
+    }
+
+    // neighbouring cells across grid borders and the last cell of the map
+    for (auto [cellX, cellY] : { std::make_pair(7u, 8u), std::make_pair(8u, 7u), std::make_pair(CellsPerMap - 1, CellsPerMap - 1) })
+    {
+        map.AddCell(cellX, cellY).GridObjects.push_back(nextObject++);
+        cells.emplace_back(cellX, cellY);
+    }
+
+    // cells of grids that are missing or not loaded are skipped
+    cells.emplace_back(CellsPerMap - 9, 0);
+    map.AddCell(100, 100).GridObjects.push_back(nextObject++);
+    map.Grids[100 / CellsPerGrid][100 / CellsPerGrid]->ObjectDataLoaded = false;
+    cells.emplace_back(100, 100);
+
+    std::shuffle(cells.begin(), cells.end(), random);
+
+    std::vector<uint32> cellIds;
+    for (auto [cellX, cellY] : cells)
+        cellIds.push_back(GetCellId(cellX, cellY));
+
+    std::vector<int> expected = map.Visit(cells);
+    REQUIRE(!expected.empty());
+    REQUIRE(map.Sweep(cellIds) == expected);
+}
+
+TEST_CASE("Sweep of no cells visits nothing", "[CellSweep]")
+{
+    TestMap map;
+    map.AddCell(0, 0).GridObjects.push_back(1);
+    REQUIRE(map.Sweep({}).empty());
+}
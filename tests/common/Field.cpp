@@ -0,0 +1,115 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Field.h"
+#include <array>
+#include <cstring>
+#include <string>
+
+namespace
+{
+// fills fields the way ResultSet and PreparedResultSet do, adds no members so an array of it is a row
+class TestField : public Field
+{
+public:
+    // ad hoc query results are text
+    void SetText(char const* value, QueryResultFieldMetadata const* meta)
+    {
+        SetMetadata(meta);
+        SetStructuredValue(value, value ? uint32(strlen(value)) : 0);
+    }
+
+    // prepared statement results are raw bytes
+    void SetBytes(void const* value, uint32 length, QueryResultFieldMetadata const* meta)
+    {
+        SetMetadata(meta);
+        SetByteValue(static_cast<char const*>(value), length);
+    }
+};
+
+static_assert(sizeof(TestField) == sizeof(Field));
+
+QueryResultFieldMetadata MakeMeta(DatabaseFieldTypes type)
+{
+    QueryResultFieldMetadata meta;
+    meta.Type = type;
+    return meta;
+}
+}
+
+TEST_CASE("GetStringView points into the row", "[Field]")
+{
+    QueryResultFieldMetadata meta = MakeMeta(DatabaseFieldTypes::Binary);
+    char const buffer[] = "npc_script_name";
+
+    TestField field;
+    field.SetBytes(buffer, 3, &meta);
+    std::string_view view = field.GetStringView();
+    REQUIRE(view.data() == buffer);
+    REQUIRE(view == "npc");
+
+    field.SetText(buffer, &meta);
+    REQUIRE(field.GetStringView() == field.GetString());
+
+    field.SetText(nullptr, &meta);
+    REQUIRE(field.IsNull());
+    REQUIRE(field.GetStringView().empty());
+}
+
+TEST_CASE("GetFields reads a text row prefix", "[Field]")
+{
+    std::array<QueryResultFieldMetadata, 5> meta = { MakeMeta(DatabaseFieldTypes::Int32), MakeMeta(DatabaseFieldTypes::Int16),
+        MakeMeta(DatabaseFieldTypes::Float), MakeMeta(DatabaseFieldTypes::Binary), MakeMeta(DatabaseFieldTypes::Int8) };
+
+    TestField row[5];
+    row[0].SetText("123456", &meta[0]);
+    row[1].SetText("571", &meta[1]);
+    row[2].SetText("-8913.5", &meta[2]);
+    row[3].SetText("SmartAI", &meta[3]);
+    row[4].SetText("1", &meta[4]);
+
+    auto [guid, mapId, x, scriptName] = Trinity::GetFields<uint32, uint16, float, std::string_view>(row);
+    REQUIRE(guid == 123456);
+    REQUIRE(mapId == 571);
+    REQUIRE(x == -8913.5f);
+    REQUIRE(scriptName == "SmartAI");
+    REQUIRE(scriptName.data() == row[3].GetCString());
+}
+
+TEST_CASE("GetFields reads a prepared row and nulls", "[Field]")
+{
+    std::array<QueryResultFieldMetadata, 4> meta = { MakeMeta(DatabaseFieldTypes::Int64), MakeMeta(DatabaseFieldTypes::Int8),
+        MakeMeta(DatabaseFieldTypes::Double), MakeMeta(DatabaseFieldTypes::Int32) };
+
+    uint64 guid = 0x1F00000000000005;
+    int8 equipmentId = -1;
+    double wanderDistance = 5.25;
+
+    TestField row[4];
+    row[0].SetBytes(&guid, sizeof(guid), &meta[0]);
+    row[1].SetBytes(&equipmentId, sizeof(equipmentId), &meta[1]);
+    row[2].SetBytes(&wanderDistance, sizeof(wanderDistance), &meta[2]);
+    row[3].SetBytes(nullptr, 0, &meta[3]);
+
+    auto [readGuid, readEquipmentId, readWanderDistance, poolId] = Trinity::GetFields<uint64, int8, double, uint32>(row);
+    REQUIRE(readGuid == guid);
+    REQUIRE(readEquipmentId == -1);
+    REQUIRE(readWanderDistance == 5.25);
+    REQUIRE(poolId == 0);
+}
@@ -0,0 +1,175 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "LogMessage.h"
+#include "LogWriter.h"
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+std::unique_ptr<LogMessage> MakeMessage(LogLevel level, std::string text)
+{
+    return std::make_unique<LogMessage>(level, "test", std::move(text));
+}
+}
+
+TEST_CASE("Messages are written in order and flushed on shutdown", "[LogWriter]")
+{
+    std::vector<std::string> written;
+    int flushes = 0;
+    {
+        LogWriter writer(16, 10ms, false,
+            [&](LogMessage* message) { written.push_back(message->text); },
+            [&]() { ++flushes; });
+
+        // more than the queue holds, producer has to wait for the writer
+        for (int i = 0; i < 100; ++i)
+            writer.Enqueue(MakeMessage(LOG_LEVEL_DEBUG, std::to_string(i)));
+
+        REQUIRE(writer.GetDroppedMessages() == 0);
+    }
+
+    REQUIRE(written.size() == 100);
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(written[i] == std::to_string(i));
+
+    REQUIRE(flushes >= 1);
+}
+
+TEST_CASE("Full queue drops messages below error level", "[LogWriter]")
+{
+    std::promise<void> writing;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::vector<std::pair<LogLevel, std::string>> written;
+    bool first = true;
+    {
+        LogWriter writer(2, 1000ms, true,
+            [&](LogMessage* message)
+            {
+                if (first)
+                {
+                    // hold the writer thread so the queue fills up
+                    first = false;
+                    writing.set_value();
+                    released.wait();
+                }
+
+                written.emplace_back(message->level, message->text);
+            },
+            []() { });
+
+        writer.Enqueue(MakeMessage(LOG_LEVEL_INFO, "blocking"));
+        writing.get_future().wait();
+
+        writer.Enqueue(MakeMessage(LOG_LEVEL_INFO, "queued 1"));
+        writer.Enqueue(MakeMessage(LOG_LEVEL_INFO, "queued 2"));
+        writer.Enqueue(MakeMessage(LOG_LEVEL_DEBUG, "dropped 1"));
+        writer.Enqueue(MakeMessage(LOG_LEVEL_WARN, "dropped 2"));
+        REQUIRE(writer.GetDroppedMessages() == 2);
+
+        release.set_value();
+        // errors wait for room instead
+        writer.Enqueue(MakeMessage(LOG_LEVEL_ERROR, "kept"));
+    }
+
+    // the drop report is written on the next flush, which can fall between the queued messages
+    std::vector<std::string> messages;
+    std::vector<std::string> reports;
+    for (auto const& [level, text] : written)
+        (level == LOG_LEVEL_WARN ? reports : messages).push_back(text);
+
+    REQUIRE(messages == std::vector<std::string>{ "blocking", "queued 1", "queued 2", "kept" });
+    REQUIRE(reports.size() == 1);
+    REQUIRE(reports[0].find("dropped 2 messages") != std::string::npos);
+}
+
+TEST_CASE("Reconfigure while other threads log", "[LogWriter]")
+{
+    constexpr int Producers = 4;
+    constexpr int PerProducer = 5000;
+
+    // stands in for the appenders, replaced by each reload and only touched with the writer paused
+    auto appender = std::make_unique<std::vector<std::string>>();
+    std::size_t written = 0;
+    std::size_t reloads = 0;
+    {
+        LogWriter writer(64, 1ms, false,
+            [&](LogMessage* message) { appender->push_back(message->text); },
+            [&]() { written += appender->size(); appender->clear(); });
+
+        std::vector<std::thread> producers;
+        for (int producer = 0; producer < Producers; ++producer)
+        {
+            producers.emplace_back([&writer, producer]()
+            {
+                for (int i = 0; i < PerProducer; ++i)
+                    writer.Enqueue(MakeMessage(LOG_LEVEL_DEBUG, std::to_string(producer * PerProducer + i)));
+            });
+        }
+
+        for (int i = 0; i < 50; ++i)
+        {
+            writer.Reconfigure(Milliseconds(1 + i % 3), false, [&]()
+            {
+                REQUIRE(appender->empty());
+                appender = std::make_unique<std::vector<std::string>>();
+                ++reloads;
+            });
+            std::this_thread::yield();
+        }
+
+        for (std::thread& thread : producers)
+            thread.join();
+    }
+
+    REQUIRE(reloads == 50);
+    REQUIRE(written == Producers * PerProducer);
+}
+
+TEST_CASE("Synchronous writer writes on the logging thread", "[LogWriter]")
+{
+    std::vector<std::string> written;
+    std::vector<std::thread::id> threads;
+    {
+        LogWriter writer(16, 1000ms, false,
+            [&](LogMessage* message)
+            {
+                written.push_back(message->text);
+                threads.push_back(std::this_thread::get_id());
+            },
+            []() { });
+
+        writer.Enqueue(MakeMessage(LOG_LEVEL_INFO, "queued"));
+        writer.SetSynchronous();
+        REQUIRE(writer.IsSynchronous());
+        REQUIRE(written == std::vector<std::string>{ "queued" });
+
+        writer.Enqueue(MakeMessage(LOG_LEVEL_INFO, "direct"));
+        REQUIRE(written == std::vector<std::string>{ "queued", "direct" });
+        REQUIRE(threads.back() == std::this_thread::get_id());
+    }
+
+    REQUIRE(written.size() == 2);
+}
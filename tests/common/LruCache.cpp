@@ -0,0 +1,71 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "LruCache.h"
+#include <string>
+#include <vector>
+
+TEST_CASE("Least recently used entry is evicted", "[LruCache]")
+{
+    Trinity::Containers::LruCache<int, std::string> cache(2);
+    cache.insert(1, "a");
+    cache.insert(2, "b");
+
+    // touching 1 leaves 2 as the oldest entry
+    REQUIRE(cache.find(1) != nullptr);
+    cache.insert(3, "c");
+
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.find(2) == nullptr);
+    REQUIRE(*cache.find(1) == "a");
+    REQUIRE(*cache.find(3) == "c");
+}
+
+TEST_CASE("Inserting a cached key replaces its value", "[LruCache]")
+{
+    Trinity::Containers::LruCache<int, std::string> cache(2);
+    cache.insert(1, "a");
+    cache.insert(2, "b");
+    cache.insert(1, "changed");
+    cache.insert(3, "c");
+
+    REQUIRE(cache.size() == 2);
+    REQUIRE(*cache.find(1) == "changed");
+    REQUIRE(cache.find(2) == nullptr);
+}
+
+TEST_CASE("Iteration goes from most to least recently used", "[LruCache]")
+{
+    Trinity::Containers::LruCache<int, int> cache(4);
+    for (int i = 1; i <= 4; ++i)
+        cache.insert(i, i * 10);
+
+    cache.find(2);
+
+    std::vector<int> keys;
+    for (auto const& [key, value] : cache)
+        keys.push_back(key);
+
+    REQUIRE(keys == std::vector<int>{ 2, 4, 3, 1 });
+
+    REQUIRE(cache.erase(4));
+    REQUIRE(!cache.erase(4));
+    cache.clear();
+    REQUIRE(cache.empty());
+}
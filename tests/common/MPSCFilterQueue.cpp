@@ -0,0 +1,177 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "MPSCFilterQueue.h"
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct TestPacket
+{
+    TestPacket(int id, bool mapSafe = true, bool needsWorld = false) : Id(id), MapSafe(mapSafe), NeedsWorld(needsWorld) { }
+
+    int Id;
+    bool MapSafe;           // accepted by the filter, like a packet MapSessionFilter lets through
+    bool NeedsWorld;        // STATUS_LOGGEDIN packet requeued while the player is not in world yet
+    std::atomic<TestPacket*> QueueLink;
+};
+
+struct TestFilter
+{
+    bool Process(TestPacket* packet) { return packet->MapSafe; }
+};
+
+struct AcceptAll
+{
+    bool Process(TestPacket*) { return true; }
+};
+
+using TestQueue = MPSCFilterQueue<TestPacket, &TestPacket::QueueLink>;
+
+std::vector<int> Drain(TestQueue& queue)
+{
+    std::vector<int> ids;
+    AcceptAll filter;
+    TestPacket* packet = nullptr;
+    while (queue.Next(packet, filter))
+    {
+        ids.push_back(packet->Id);
+        delete packet;
+    }
+
+    return ids;
+}
+}
+
+TEST_CASE("A rejected packet stays first in line", "[MPSCFilterQueue]")
+{
+    TestQueue queue;
+    for (int i = 1; i <= 4; ++i)
+        queue.Enqueue(new TestPacket(i, i != 2));
+
+    TestFilter filter;
+    TestPacket* packet = nullptr;
+    REQUIRE(queue.Next(packet, filter));
+    REQUIRE(packet->Id == 1);
+    delete packet;
+
+    // 3 and 4 would be accepted but must not overtake 2
+    REQUIRE_FALSE(queue.Next(packet, filter));
+    REQUIRE_FALSE(queue.Next(packet, filter));
+
+    REQUIRE(Drain(queue) == std::vector<int>{ 2, 3, 4 });
+}
+
+TEST_CASE("Requeued packets come back first and in order", "[MPSCFilterQueue]")
+{
+    TestQueue queue;
+    queue.Enqueue(new TestPacket(1, true, true));
+    queue.Enqueue(new TestPacket(2));
+    queue.Enqueue(new TestPacket(3, true, true));
+    queue.Enqueue(new TestPacket(4, false));
+    queue.Enqueue(new TestPacket(5));
+
+    // same loop as WorldSession::Update, stopping at the packet the filter rejects
+    TestFilter filter;
+    std::vector<TestPacket*> requeuePackets;
+    std::vector<int> processed;
+    TestPacket* packet = nullptr;
+    while (queue.Next(packet, filter))
+    {
+        if (packet->NeedsWorld)
+            requeuePackets.push_back(packet);
+        else
+        {
+            processed.push_back(packet->Id);
+            delete packet;
+        }
+    }
+
+    queue.Enqueue(new TestPacket(6));
+    queue.Readd(requeuePackets.begin(), requeuePackets.end());
+
+    REQUIRE(processed == std::vector<int>{ 2 });
+    REQUIRE(Drain(queue) == std::vector<int>{ 1, 3, 4, 5, 6 });
+}
+
+TEST_CASE("Readd before anything was taken from the lock free queue", "[MPSCFilterQueue]")
+{
+    TestQueue queue;
+    queue.Enqueue(new TestPacket(3));
+
+    std::vector<TestPacket*> requeuePackets = { new TestPacket(1), new TestPacket(2) };
+    queue.Readd(requeuePackets.begin(), requeuePackets.end());
+
+    TestPacket* packet = nullptr;
+    REQUIRE(queue.Dequeue(packet));
+    REQUIRE(packet->Id == 1);
+    delete packet;
+
+    REQUIRE(Drain(queue) == std::vector<int>{ 2, 3 });
+
+    // packets still queued are deleted with the queue
+    queue.Enqueue(new TestPacket(4));
+    requeuePackets = { new TestPacket(5) };
+    queue.Readd(requeuePackets.begin(), requeuePackets.end());
+}
+
+TEST_CASE("Packets from many producers arrive once and in producer order", "[MPSCFilterQueue]")
+{
+    constexpr int Producers = 4;
+    constexpr int PerProducer = 20000;
+    TestQueue queue;
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < Producers; ++producer)
+    {
+        producers.emplace_back([&queue, producer]()
+        {
+            for (int i = 0; i < PerProducer; ++i)
+                queue.Enqueue(new TestPacket(producer * PerProducer + i, i % 7 != 0));
+        });
+    }
+
+    // rejected packets are taken once the filter is relaxed, like a session waiting for the map update
+    std::vector<int> next(Producers, 0);
+    int received = 0;
+    bool ordered = true;
+    TestFilter filter;
+    AcceptAll acceptAll;
+    while (received < Producers * PerProducer)
+    {
+        TestPacket* packet = nullptr;
+        if (!queue.Next(packet, filter) && !queue.Next(packet, acceptAll))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        int producer = packet->Id / PerProducer;
+        ordered = ordered && packet->Id % PerProducer == next[producer];
+        next[producer] = packet->Id % PerProducer + 1;
+        ++received;
+        delete packet;
+    }
+
+    for (std::thread& thread : producers)
+        thread.join();
+
+    REQUIRE(ordered);
+    REQUIRE(Drain(queue).empty());
+}
@@ -0,0 +1,95 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MPSCRingBuffer.h"
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Enqueue fails when the ring buffer is full", "[MPSCRingBuffer]")
+{
+    Trinity::MPSCRingBuffer<std::unique_ptr<int>> queue(3);
+    REQUIRE(queue.GetCapacity() == 4);
+
+    for (int i = 0; i < 4; ++i)
+        REQUIRE(queue.Enqueue(std::make_unique<int>(i)));
+
+    std::unique_ptr<int> rejected = std::make_unique<int>(4);
+    REQUIRE_FALSE(queue.Enqueue(std::move(rejected)));
+    REQUIRE(rejected);
+    REQUIRE(queue.GetSizeApprox() == 4);
+
+    std::unique_ptr<int> value;
+    REQUIRE(queue.Dequeue(value));
+    REQUIRE(*value == 0);
+    REQUIRE(queue.Enqueue(std::move(rejected)));
+
+    for (int i = 1; i <= 4; ++i)
+    {
+        REQUIRE(queue.Dequeue(value));
+        REQUIRE(*value == i);
+    }
+
+    REQUIRE_FALSE(queue.Dequeue(value));
+}
+
+TEST_CASE("Values from many producers arrive once and in producer order", "[MPSCRingBuffer]")
+{
+    constexpr int Producers = 4;
+    constexpr int PerProducer = 20000;
+    Trinity::MPSCRingBuffer<int> queue(64);
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < Producers; ++producer)
+    {
+        producers.emplace_back([&queue, producer]()
+        {
+            for (int i = 0; i < PerProducer; ++i)
+            {
+                int value = producer * PerProducer + i;
+                while (!queue.Enqueue(std::move(value)))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<int> next(Producers, 0);
+    int received = 0;
+    bool ordered = true;
+    while (received < Producers * PerProducer)
+    {
+        int value;
+        if (!queue.Dequeue(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        int producer = value / PerProducer;
+        ordered = ordered && value % PerProducer == next[producer];
+        ++next[producer];
+        ++received;
+    }
+
+    for (std::thread& producer : producers)
+        producer.join();
+
+    REQUIRE(ordered);
+    REQUIRE(next == std::vector<int>(Producers, PerProducer));
+}
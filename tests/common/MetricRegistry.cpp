@@ -0,0 +1,87 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MetricRegistry.h"
+#include <sstream>
+#include <thread>
+
+TEST_CASE("Counters report amount added since previous flush", "[MetricRegistry]")
+{
+    MetricRegistry registry;
+    MetricCounter& counter = registry.RegisterCounter("packets");
+    REQUIRE(&registry.RegisterCounter("packets") == &counter);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&counter]() { for (int i = 0; i < 1000; ++i) counter.Add(); });
+    for (std::thread& thread : threads)
+        thread.join();
+
+    std::ostringstream out;
+    REQUIRE(registry.WriteLines(out, "", std::chrono::system_clock::time_point(std::chrono::nanoseconds(42))) == 1);
+    REQUIRE(out.str() == "packets value=4000i 42\n");
+
+    REQUIRE(counter.Collect() == 0);
+}
+
+TEST_CASE("Gauges report last value", "[MetricRegistry]")
+{
+    MetricRegistry registry;
+    registry.RegisterGauge("players").Set(10);
+    registry.RegisterGauge("players").Set(7);
+
+    std::ostringstream out;
+    registry.WriteLines(out, "Trinity", std::chrono::system_clock::time_point(std::chrono::nanoseconds(1)));
+    REQUIRE(out.str() == "players,realm=Trinity value=7i 1\n");
+}
+
+TEST_CASE("Histograms count values per bucket", "[MetricRegistry]")
+{
+    MetricRegistry registry;
+    MetricHistogram& histogram = registry.RegisterHistogram("update_time", { 10, 100 });
+    histogram.Record(5);
+    histogram.Record(10);
+    histogram.Record(50);
+    histogram.Record(1000);
+
+    std::ostringstream out;
+    registry.WriteLines(out, "", std::chrono::system_clock::time_point(std::chrono::nanoseconds(3)));
+    REQUIRE(out.str() == "update_time count=4i,sum=1065i,bucket_10=2i,bucket_100=1i,bucket_inf=1i 3\n");
+
+    MetricHistogram::Snapshot empty = histogram.Collect();
+    REQUIRE(empty.Count == 0);
+    REQUIRE(empty.Sum == 0);
+}
+
+TEST_CASE("Histogram counters spanning several cache lines", "[MetricRegistry]")
+{
+    MetricRegistry registry;
+    MetricHistogram& histogram = registry.RegisterHistogram("db_latency", { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&histogram]() { for (uint64 value = 1; value <= 13; ++value) histogram.Record(value); });
+    for (std::thread& thread : threads)
+        thread.join();
+
+    MetricHistogram::Snapshot snapshot = histogram.Collect();
+    REQUIRE(snapshot.Count == 4 * 13);
+    REQUIRE(snapshot.Sum == 4 * 91);
+    REQUIRE(snapshot.BucketCounts == std::vector<uint64>(13, 4));
+}
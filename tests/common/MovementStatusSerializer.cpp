@@ -0,0 +1,390 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MovementStatusSequences.h"
+#include <bit>
+#include <chrono>
+#include <random>
+#include <vector>
+
+using Movement::MovementStatus;
+using Movement::MovementStatusSerializer;
+
+namespace
+{
+// stands in for ExtraMovementStatusElement, every extra element is a single uint32
+struct TestExtras
+{
+    void ReadNextElement(ByteBuffer& data) { data >> Value; }
+    void WriteNextElement(ByteBuffer& data) { data << Value; }
+
+    uint32 Value = 0;
+};
+
+// previous implementation, the sequence is walked at runtime with a switch per element
+void InterpretWrite(MovementStatusElements const* sequence, ByteBuffer& data, MovementStatus const& status, TestExtras* extras)
+{
+    for (; *sequence != MSEEnd; ++sequence)
+    {
+        MovementStatusElements const element = *sequence;
+        switch (element)
+        {
+            case MSEHasGuidByte0: case MSEHasGuidByte1: case MSEHasGuidByte2: case MSEHasGuidByte3:
+            case MSEHasGuidByte4: case MSEHasGuidByte5: case MSEHasGuidByte6: case MSEHasGuidByte7:
+                data.WriteBit(status.Guid[element - MSEHasGuidByte0]);
+                break;
+            case MSEHasTransportGuidByte0: case MSEHasTransportGuidByte1: case MSEHasTransportGuidByte2: case MSEHasTransportGuidByte3:
+            case MSEHasTransportGuidByte4: case MSEHasTransportGuidByte5: case MSEHasTransportGuidByte6: case MSEHasTransportGuidByte7:
+                if (status.HasTransportData)
+                    data.WriteBit(status.TransportGuid[element - MSEHasTransportGuidByte0]);
+                break;
+            case MSEGuidByte0: case MSEGuidByte1: case MSEGuidByte2: case MSEGuidByte3:
+            case MSEGuidByte4: case MSEGuidByte5: case MSEGuidByte6: case MSEGuidByte7:
+                data.WriteByteSeq(status.Guid[element - MSEGuidByte0]);
+                break;
+            case MSETransportGuidByte0: case MSETransportGuidByte1: case MSETransportGuidByte2: case MSETransportGuidByte3:
+            case MSETransportGuidByte4: case MSETransportGuidByte5: case MSETransportGuidByte6: case MSETransportGuidByte7:
+                if (status.HasTransportData)
+                    data.WriteByteSeq(status.TransportGuid[element - MSETransportGuidByte0]);
+                break;
+            case MSEHasMovementFlags: data.WriteBit(!status.HasMovementFlags); break;
+            case MSEHasMovementFlags2: data.WriteBit(!status.HasMovementFlags2); break;
+            case MSEHasTimestamp: data.WriteBit(!status.HasTimestamp); break;
+            case MSEHasOrientation: data.WriteBit(!status.HasOrientation); break;
+            case MSEHasTransportData: data.WriteBit(status.HasTransportData); break;
+            case MSEHasTransportTime2: if (status.HasTransportData) data.WriteBit(status.HasTransportTime2); break;
+            case MSEHasVehicleId: if (status.HasTransportData) data.WriteBit(status.HasTransportVehicleId); break;
+            case MSEHasPitch: data.WriteBit(!status.HasPitch); break;
+            case MSEHasFallData: data.WriteBit(status.HasFallData); break;
+            case MSEHasFallDirection: if (status.HasFallData) data.WriteBit(status.HasFallDirection); break;
+            case MSEHasSplineElevation: data.WriteBit(!status.HasSplineElevation); break;
+            case MSEHasSpline: data.WriteBit(status.HasSpline); break;
+            case MSEHasHeightChangeFailed: data.WriteBit(status.HeightChangeFailed); break;
+            case MSEMovementFlags: if (status.HasMovementFlags) data.WriteBits(status.Flags, 30); break;
+            case MSEMovementFlags2: if (status.HasMovementFlags2) data.WriteBits(status.Flags2, 12); break;
+            case MSETimestamp: if (status.HasTimestamp) data << status.Time; break;
+            case MSEPositionX: data << status.PositionX; break;
+            case MSEPositionY: data << status.PositionY; break;
+            case MSEPositionZ: data << status.PositionZ; break;
+            case MSEOrientation: if (status.HasOrientation) data << status.Orientation; break;
+            case MSETransportPositionX: if (status.HasTransportData) data << status.TransportPositionX; break;
+            case MSETransportPositionY: if (status.HasTransportData) data << status.TransportPositionY; break;
+            case MSETransportPositionZ: if (status.HasTransportData) data << status.TransportPositionZ; break;
+            case MSETransportOrientation: if (status.HasTransportData) data << status.TransportOrientation; break;
+            case MSETransportSeat: if (status.HasTransportData) data << status.TransportSeat; break;
+            case MSETransportTime: if (status.HasTransportData) data << status.TransportTime; break;
+            case MSETransportTime2: if (status.HasTransportData && status.HasTransportTime2) data << status.TransportTime2; break;
+            case MSETransportVehicleId: if (status.HasTransportData && status.HasTransportVehicleId) data << status.TransportVehicleId; break;
+            case MSEPitch: if (status.HasPitch) data << status.Pitch; break;
+            case MSEFallTime: if (status.HasFallData) data << status.FallTime; break;
+            case MSEFallVerticalSpeed: if (status.HasFallData) data << status.FallVerticalSpeed; break;
+            case MSEFallCosAngle: if (status.HasFallData && status.HasFallDirection) data << status.FallCosAngle; break;
+            case MSEFallSinAngle: if (status.HasFallData && status.HasFallDirection) data << status.FallSinAngle; break;
+            case MSEFallHorizontalSpeed: if (status.HasFallData && status.HasFallDirection) data << status.FallHorizontalSpeed; break;
+            case MSESplineElevation: if (status.HasSplineElevation) data << status.SplineElevation; break;
+            case MSECounter: data << status.Counter; break;
+            case MSEZeroBit: data.WriteBit(0); break;
+            case MSEOneBit: data.WriteBit(1); break;
+            case MSEFlushBits: data.FlushBits(); break;
+            case MSEExtraElement: extras->WriteNextElement(data); break;
+            default: FAIL("unexpected element " << element); break;
+        }
+    }
+}
+
+void InterpretRead(MovementStatusElements const* sequence, ByteBuffer& data, MovementStatus& status, TestExtras* extras)
+{
+    for (; *sequence != MSEEnd; ++sequence)
+    {
+        MovementStatusElements const element = *sequence;
+        switch (element)
+        {
+            case MSEHasGuidByte0: case MSEHasGuidByte1: case MSEHasGuidByte2: case MSEHasGuidByte3:
+            case MSEHasGuidByte4: case MSEHasGuidByte5: case MSEHasGuidByte6: case MSEHasGuidByte7:
+                status.Guid[element - MSEHasGuidByte0] = data.ReadBit();
+                break;
+            case MSEHasTransportGuidByte0: case MSEHasTransportGuidByte1: case MSEHasTransportGuidByte2: case MSEHasTransportGuidByte3:
+            case MSEHasTransportGuidByte4: case MSEHasTransportGuidByte5: case MSEHasTransportGuidByte6: case MSEHasTransportGuidByte7:
+                if (status.HasTransportData)
+                    status.TransportGuid[element - MSEHasTransportGuidByte0] = data.ReadBit();
+                break;
+            case MSEGuidByte0: case MSEGuidByte1: case MSEGuidByte2: case MSEGuidByte3:
+            case MSEGuidByte4: case MSEGuidByte5: case MSEGuidByte6: case MSEGuidByte7:
+                data.ReadByteSeq(status.Guid[element - MSEGuidByte0]);
+                break;
+            case MSETransportGuidByte0: case MSETransportGuidByte1: case MSETransportGuidByte2: case MSETransportGuidByte3:
+            case MSETransportGuidByte4: case MSETransportGuidByte5: case MSETransportGuidByte6: case MSETransportGuidByte7:
+                if (status.HasTransportData)
+                    data.ReadByteSeq(status.TransportGuid[element - MSETransportGuidByte0]);
+                break;
+            case MSEHasMovementFlags: status.HasMovementFlags = !data.ReadBit(); break;
+            case MSEHasMovementFlags2: status.HasMovementFlags2 = !data.ReadBit(); break;
+            case MSEHasTimestamp: status.HasTimestamp = !data.ReadBit(); break;
+            case MSEHasOrientation: status.HasOrientation = !data.ReadBit(); break;
+            case MSEHasTransportData: status.HasTransportData = data.ReadBit(); break;
+            case MSEHasTransportTime2: if (status.HasTransportData) status.HasTransportTime2 = data.ReadBit(); break;
+            case MSEHasVehicleId: if (status.HasTransportData) status.HasTransportVehicleId = data.ReadBit(); break;
+            case MSEHasPitch: status.HasPitch = !data.ReadBit(); break;
+            case MSEHasFallData: status.HasFallData = data.ReadBit(); break;
+            case MSEHasFallDirection: if (status.HasFallData) status.HasFallDirection = data.ReadBit(); break;
+            case MSEHasSplineElevation: status.HasSplineElevation = !data.ReadBit(); break;
+            case MSEHasSpline: status.HasSpline = data.ReadBit(); break;
+            case MSEHasHeightChangeFailed: status.HeightChangeFailed = data.ReadBit(); break;
+            case MSEMovementFlags: if (status.HasMovementFlags) status.Flags = data.ReadBits(30); break;
+            case MSEMovementFlags2: if (status.HasMovementFlags2) status.Flags2 = data.ReadBits(12); break;
+            case MSETimestamp: if (status.HasTimestamp) data >> status.Time; break;
+            case MSEPositionX: data >> status.PositionX; break;
+            case MSEPositionY: data >> status.PositionY; break;
+            case MSEPositionZ: data >> status.PositionZ; break;
+            case MSEOrientation: if (status.HasOrientation) status.Orientation = data.read<float>(); break;
+            case MSETransportPositionX: if (status.HasTransportData) data >> status.TransportPositionX; break;
+            case MSETransportPositionY: if (status.HasTransportData) data >> status.TransportPositionY; break;
+            case MSETransportPositionZ: if (status.HasTransportData) data >> status.TransportPositionZ; break;
+            case MSETransportOrientation: if (status.HasTransportData) status.TransportOrientation = data.read<float>(); break;
+            case MSETransportSeat: if (status.HasTransportData) data >> status.TransportSeat; break;
+            case MSETransportTime: if (status.HasTransportData) data >> status.TransportTime; break;
+            case MSETransportTime2: if (status.HasTransportData && status.HasTransportTime2) data >> status.TransportTime2; break;
+            case MSETransportVehicleId: if (status.HasTransportData && status.HasTransportVehicleId) data >> status.TransportVehicleId; break;
+            case MSEPitch: if (status.HasPitch) status.Pitch = data.read<float>(); break;
+            case MSEFallTime: if (status.HasFallData) data >> status.FallTime; break;
+            case MSEFallVerticalSpeed: if (status.HasFallData) data >> status.FallVerticalSpeed; break;
+            case MSEFallCosAngle: if (status.HasFallData && status.HasFallDirection) data >> status.FallCosAngle; break;
+            case MSEFallSinAngle: if (status.HasFallData && status.HasFallDirection) data >> status.FallSinAngle; break;
+            case MSEFallHorizontalSpeed: if (status.HasFallData && status.HasFallDirection) data >> status.FallHorizontalSpeed; break;
+            case MSESplineElevation: if (status.HasSplineElevation) data >> status.SplineElevation; break;
+            case MSECounter: data >> status.Counter; break;
+            case MSEZeroBit: case MSEOneBit: data.ReadBit(); break;
+            case MSEExtraElement: extras->ReadNextElement(data); break;
+            default: FAIL("unexpected element " << element); break;
+        }
+    }
+}
+
+struct OpcodeSerializer
+{
+    char const* Name;
+    MovementStatusElements const* Sequence;
+    void(*Read)(ByteBuffer&, MovementStatus&, TestExtras*);
+    void(*Write)(ByteBuffer&, MovementStatus const&, TestExtras*);
+};
+
+#define CLIENT_SERIALIZER(opcode, sequence) { #opcode, sequence, &MovementStatusSerializer<sequence>::Read<TestExtras>, &MovementStatusSerializer<sequence>::Write<TestExtras> },
+#define SERVER_SERIALIZER(opcode, sequence) { #opcode, sequence, nullptr, &MovementStatusSerializer<sequence>::Write<TestExtras> },
+
+std::vector<OpcodeSerializer> const Serializers =
+{
+    MOVEMENT_STATUS_CLIENT_SEQUENCES(CLIENT_SERIALIZER)
+    MOVEMENT_STATUS_SERVER_SEQUENCES(SERVER_SERIALIZER)
+};
+
+#undef CLIENT_SERIALIZER
+#undef SERVER_SERIALIZER
+
+MovementStatus RandomStatus(std::mt19937& rng)
+{
+    std::uniform_int_distribution<uint32> value;
+    std::uniform_real_distribution<float> position(-10000.0f, 10000.0f);
+    auto chance = [&]() { return value(rng) % 2 == 0; };
+    auto guidBytes = [&]()
+    {
+        std::array<uint8, 8> bytes;
+        for (uint8& byte : bytes)
+            byte = chance() ? uint8(value(rng)) : 0;
+        return bytes;
+    };
+
+    MovementStatus status;
+    status.Guid = guidBytes();
+    status.TransportGuid = guidBytes();
+    status.Flags = value(rng) & 0x3FFFFFFF;
+    status.Flags2 = value(rng) & 0xFFF;
+    status.Time = value(rng);
+    status.PositionX = position(rng);
+    status.PositionY = position(rng);
+    status.PositionZ = position(rng);
+    status.Orientation = position(rng);
+    status.TransportPositionX = position(rng);
+    status.TransportPositionY = position(rng);
+    status.TransportPositionZ = position(rng);
+    status.TransportOrientation = position(rng);
+    status.TransportSeat = int8(value(rng));
+    status.TransportTime = value(rng);
+    status.TransportTime2 = value(rng);
+    status.TransportVehicleId = value(rng);
+    status.Pitch = position(rng);
+    status.FallTime = value(rng);
+    status.FallVerticalSpeed = position(rng);
+    status.FallCosAngle = position(rng);
+    status.FallSinAngle = position(rng);
+    status.FallHorizontalSpeed = position(rng);
+    status.SplineElevation = position(rng);
+    status.Counter = value(rng);
+    status.HasMovementFlags = chance();
+    status.HasMovementFlags2 = chance();
+    status.HasTimestamp = chance();
+    status.HasOrientation = chance();
+    status.HasTransportData = chance();
+    status.HasTransportTime2 = chance();
+    status.HasTransportVehicleId = chance();
+    status.HasPitch = chance();
+    status.HasFallData = chance();
+    status.HasFallDirection = chance();
+    status.HasSplineElevation = chance();
+    status.HasSpline = chance();
+    status.HeightChangeFailed = chance();
+    return status;
+}
+
+// floats compared bitwise, packets may carry NaN orientation or pitch
+std::vector<uint64> Values(MovementStatus const& status)
+{
+    auto bits = [](float value) { return uint64(std::bit_cast<uint32>(value)); };
+    return
+    {
+        Movement::MovementStatus::GuidFromBytes(status.Guid), Movement::MovementStatus::GuidFromBytes(status.TransportGuid),
+        status.Flags, status.Flags2, status.Time,
+        bits(status.PositionX), bits(status.PositionY), bits(status.PositionZ), bits(status.Orientation),
+        bits(status.TransportPositionX), bits(status.TransportPositionY), bits(status.TransportPositionZ), bits(status.TransportOrientation),
+        uint64(status.TransportSeat), status.TransportTime, status.TransportTime2, status.TransportVehicleId,
+        bits(status.Pitch), status.FallTime, bits(status.FallVerticalSpeed), bits(status.FallCosAngle), bits(status.FallSinAngle), bits(status.FallHorizontalSpeed),
+        bits(status.SplineElevation), status.Counter,
+        status.HasMovementFlags, status.HasMovementFlags2, status.HasTimestamp, status.HasOrientation, status.HasTransportData,
+        status.HasTransportTime2, status.HasTransportVehicleId, status.HasPitch, status.HasFallData, status.HasFallDirection,
+        status.HasSplineElevation, status.HasSpline, status.HeightChangeFailed
+    };
+}
+
+std::vector<uint8> Contents(ByteBuffer& data)
+{
+    data.FlushBits();
+    return std::vector<uint8>(data.contents(), data.contents() + data.size());
+}
+}
+
+TEST_CASE("Generated writers produce the same bytes as the interpreter", "[MovementStatusSerializer]")
+{
+    std::mt19937 rng(42);
+    for (OpcodeSerializer const& serializer : Serializers)
+    {
+        INFO(serializer.Name);
+        for (int i = 0; i < 64; ++i)
+        {
+            MovementStatus status = RandomStatus(rng);
+            TestExtras extras;
+            extras.Value = i;
+
+            ByteBuffer interpreted, generated;
+            InterpretWrite(serializer.Sequence, interpreted, status, &extras);
+            serializer.Write(generated, status, &extras);
+            REQUIRE(Contents(generated) == Contents(interpreted));
+        }
+    }
+}
+
+TEST_CASE("Generated readers decode the same values as the interpreter", "[MovementStatusSerializer]")
+{
+    std::mt19937 rng(7);
+    for (OpcodeSerializer const& serializer : Serializers)
+    {
+        if (!serializer.Read)
+            continue;
+
+        INFO(serializer.Name);
+        for (int i = 0; i < 64; ++i)
+        {
+            // arbitrary client data, truncated packets and invalid floats have to fail the same way
+            ByteBuffer packet;
+            std::size_t size = rng() % 96;
+            for (std::size_t j = 0; j < size; ++j)
+                packet << uint8(rng());
+
+            // values missing from the packet have to be left alone
+            MovementStatus previous = RandomStatus(rng);
+            MovementStatus interpreted = previous, generated = previous;
+            TestExtras interpretedExtras, generatedExtras;
+            ByteBuffer interpretedPacket(packet), generatedPacket(packet);
+
+            auto succeeds = [](auto read)
+            {
+                try
+                {
+                    read();
+                    return true;
+                }
+                catch (ByteBufferException const&)
+                {
+                    return false;
+                }
+            };
+
+            bool interpretedRead = succeeds([&]() { InterpretRead(serializer.Sequence, interpretedPacket, interpreted, &interpretedExtras); });
+            bool generatedRead = succeeds([&]() { serializer.Read(generatedPacket, generated, &generatedExtras); });
+
+            REQUIRE(generatedRead == interpretedRead);
+            REQUIRE(Values(generated) == Values(interpreted));
+            REQUIRE(generatedExtras.Value == interpretedExtras.Value);
+            REQUIRE(generatedPacket.rpos() == interpretedPacket.rpos());
+        }
+    }
+}
+
+// not run by default, use tests-common "[.benchmark]"
+TEST_CASE("Movement status serialization throughput", "[MovementStatusSerializer][.benchmark]")
+{
+    std::mt19937 rng(42);
+    std::vector<MovementStatus> statuses;
+    for (int i = 0; i < 64; ++i)
+        statuses.push_back(RandomStatus(rng));
+
+    constexpr uint32 Iterations = 2000;
+    auto measure = [&](auto write)
+    {
+        std::size_t bytes = 0;
+        std::size_t packets = 0;
+        ByteBuffer data(256);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < Iterations; ++i)
+        {
+            for (OpcodeSerializer const& serializer : Serializers)
+            {
+                TestExtras extras;
+                write(serializer, data, statuses[packets % statuses.size()], &extras);
+                data.FlushBits();
+                bytes += data.size();
+                data.clear();
+                ++packets;
+            }
+        }
+
+        double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        return std::make_pair(nanoseconds / packets, bytes);
+    };
+
+    auto interpreted = measure([](OpcodeSerializer const& serializer, ByteBuffer& data, MovementStatus const& status, TestExtras* extras)
+    {
+        InterpretWrite(serializer.Sequence, data, status, extras);
+    });
+    auto generated = measure([](OpcodeSerializer const& serializer, ByteBuffer& data, MovementStatus const& status, TestExtras* extras)
+    {
+        serializer.Write(data, status, extras);
+    });
+
+    WARN(Serializers.size() << " opcodes: interpreter " << interpreted.first << " ns/packet, generated " << generated.first << " ns/packet");
+    CHECK(interpreted.second == generated.second);
+}
@@ -0,0 +1,189 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "MultiRowInsert.h"
+#include <string>
+#include <vector>
+
+namespace
+{
+PreparedStatementData MakeUInt32(uint32 value)
+{
+    PreparedStatementData data{};
+    data.type = TYPE_UI32;
+    data.data.ui32 = value;
+    return data;
+}
+
+PreparedStatementData MakeString(std::string const& value)
+{
+    PreparedStatementData data{};
+    data.type = TYPE_STRING;
+    data.binary.assign(value.begin(), value.end());
+    data.binary.push_back(0);
+    return data;
+}
+
+PreparedStatementData MakeNull()
+{
+    PreparedStatementData data{};
+    data.type = TYPE_NULL;
+    return data;
+}
+
+// same escapes mysql_real_escape_string applies to quotes and backslashes
+void Escape(std::string& sql, char const* value, std::size_t length)
+{
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        if (value[i] == '\'' || value[i] == '\\')
+            sql += '\\';
+        sql += value[i];
+    }
+}
+}
+
+TEST_CASE("MultiRowInsert::SplitQuery", "[MultiRowInsert]")
+{
+    std::string prefix, row;
+
+    SECTION("Single row insert")
+    {
+        REQUIRE(Trinity::MultiRowInsert::SplitQuery("INSERT INTO character_aura (guid, spell, stacks) VALUES (?, ?, ?)", 3, prefix, row));
+        REQUIRE(prefix == "INSERT INTO character_aura (guid, spell, stacks) VALUES ");
+        REQUIRE(row == "(?, ?, ?)");
+    }
+
+    SECTION("Replace, lower case keywords and trailing semicolon")
+    {
+        REQUIRE(Trinity::MultiRowInsert::SplitQuery("  replace into t (a, b) values (?, UNIX_TIMESTAMP(?));\n", 2, prefix, row));
+        REQUIRE(prefix == "  replace into t (a, b) values ");
+        REQUIRE(row == "(?, UNIX_TIMESTAMP(?))");
+    }
+
+    SECTION("Statements that cannot be joined")
+    {
+        REQUIRE_FALSE(Trinity::MultiRowInsert::SplitQuery("UPDATE t SET a = ? WHERE b = ?", 2, prefix, row));
+        REQUIRE_FALSE(Trinity::MultiRowInsert::SplitQuery("INSERT INTO t (a) VALUES (?), (?)", 2, prefix, row));
+        REQUIRE_FALSE(Trinity::MultiRowInsert::SplitQuery("INSERT INTO t (a) VALUES (?) ON DUPLICATE KEY UPDATE a = ?", 2, prefix, row));
+        REQUIRE_FALSE(Trinity::MultiRowInsert::SplitQuery("INSERT INTO t (a) SELECT a FROM u WHERE b = ?", 1, prefix, row));
+        REQUIRE(prefix.empty());
+        REQUIRE(row.empty());
+    }
+
+    SECTION("Placeholders inside string literals")
+    {
+        // a literal question mark is not a parameter, such rows are never rewritten
+        REQUIRE_FALSE(Trinity::MultiRowInsert::SplitQuery("INSERT INTO t (a, b) VALUES (?, 'why?')", 1, prefix, row));
+        REQUIRE_FALSE(Trinity::MultiRowInsert::SplitQuery("INSERT INTO t (a, b) VALUES (?, \"why?\")", 1, prefix, row));
+        REQUIRE_FALSE(Trinity::MultiRowInsert::SplitQuery("INSERT INTO t (`a?`) VALUES (?)", 1, prefix, row));
+        REQUIRE(prefix.empty());
+    }
+}
+
+TEST_CASE("MultiRowInsert::AppendRow", "[MultiRowInsert]")
+{
+    std::string sql;
+
+    SECTION("Values replace placeholders in order")
+    {
+        Trinity::MultiRowInsert::AppendRow(sql, "(?, ?, ?)", { MakeUInt32(7), MakeNull(), MakeUInt32(4000000000) }, Escape);
+        REQUIRE(sql == "(7, NULL, 4000000000)");
+    }
+
+    SECTION("Strings are quoted and escaped")
+    {
+        Trinity::MultiRowInsert::AppendRow(sql, "(?, ?)", { MakeString("O'Neil \\ co"), MakeString("") }, Escape);
+        REQUIRE(sql == "('O\\'Neil \\\\ co', '')");
+    }
+
+    SECTION("Question marks in values are not placeholders")
+    {
+        Trinity::MultiRowInsert::AppendRow(sql, "(?, ?)", { MakeString("why?"), MakeUInt32(1) }, Escape);
+        REQUIRE(sql == "('why?', 1)");
+    }
+
+    SECTION("Binary values are hex literals")
+    {
+        PreparedStatementData data{};
+        data.type = TYPE_BINARY;
+        data.binary = { 0x00, 0xAB, 0x10 };
+        Trinity::MultiRowInsert::AppendRow(sql, "(?)", { data }, Escape);
+        REQUIRE(sql == "(X'00AB10')");
+    }
+}
+
+TEST_CASE("MultiRowInsert::BuildQueries", "[MultiRowInsert]")
+{
+    std::string const prefix = "INSERT INTO t (a) VALUES ";
+    std::vector<uint32> values = { 1, 22, 333, 4444, 55555 };
+    auto appendRow = [&](std::string& sql, std::size_t i)
+    {
+        Trinity::MultiRowInsert::AppendRow(sql, "(?)", { MakeUInt32(values[i]) }, Escape);
+    };
+
+    std::vector<std::string> queries;
+    std::vector<std::size_t> rowCounts;
+    auto execute = [&](std::string const& sql, std::size_t rowCount)
+    {
+        queries.push_back(sql);
+        rowCounts.push_back(rowCount);
+        return true;
+    };
+
+    SECTION("All rows fit into one query")
+    {
+        REQUIRE(Trinity::MultiRowInsert::BuildQueries(prefix, values.size(), 1024, appendRow, execute) == values.size());
+        REQUIRE(queries == std::vector<std::string>{ prefix + "(1), (22), (333), (4444), (55555)" });
+        REQUIRE(rowCounts == std::vector<std::size_t>{ 5 });
+    }
+
+    SECTION("Queries are closed once they reach the size limit")
+    {
+        std::size_t maxQuerySize = prefix.length() + std::string("(1), (22)").length();
+        REQUIRE(Trinity::MultiRowInsert::BuildQueries(prefix, values.size(), maxQuerySize, appendRow, execute) == values.size());
+        REQUIRE(queries == std::vector<std::string>{ prefix + "(1), (22)", prefix + "(333), (4444)", prefix + "(55555)" });
+        REQUIRE(rowCounts == std::vector<std::size_t>{ 2, 2, 1 });
+    }
+
+    SECTION("A row larger than the limit is sent alone")
+    {
+        REQUIRE(Trinity::MultiRowInsert::BuildQueries(prefix, values.size(), 1, appendRow, execute) == values.size());
+        REQUIRE(queries.size() == values.size());
+        REQUIRE(queries.back() == prefix + "(55555)");
+    }
+
+    SECTION("Rows after a failed query are not executed")
+    {
+        std::size_t maxQuerySize = prefix.length() + std::string("(1), (22)").length();
+        auto failSecond = [&](std::string const& sql, std::size_t rowCount)
+        {
+            execute(sql, rowCount);
+            return queries.size() < 2;
+        };
+
+        REQUIRE(Trinity::MultiRowInsert::BuildQueries(prefix, values.size(), maxQuerySize, appendRow, failSecond) == 2);
+        REQUIRE(queries.size() == 2);
+    }
+
+    SECTION("No rows")
+    {
+        REQUIRE(Trinity::MultiRowInsert::BuildQueries(prefix, 0, 1024, appendRow, execute) == 0);
+        REQUIRE(queries.empty());
+    }
+}
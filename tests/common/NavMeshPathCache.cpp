@@ -0,0 +1,137 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tc_catch2.h"
+
+#include "MMapManager.h"
+#include <vector>
+
+using MMAP::NavMeshPathCache;
+
+namespace
+{
+constexpr uint16 WalkFlags = 0x01;
+constexpr uint16 SwimFlags = 0x02;
+constexpr uint32 MaxPath = 64;
+
+NavMeshPathCache::Key MakeKey(dtPolyRef start, dtPolyRef end, uint16 includeFlags = WalkFlags, uint16 excludeFlags = 0)
+{
+    return { start, end, includeFlags, excludeFlags };
+}
+
+void Insert(NavMeshPathCache& cache, std::vector<dtPolyRef> const& polys, uint16 includeFlags = WalkFlags, std::chrono::microseconds searchTime = std::chrono::microseconds(100))
+{
+    cache.Insert(MakeKey(polys.front(), polys.back(), includeFlags), polys.data(), uint32(polys.size()), searchTime, cache.GetGeneration());
+}
+
+std::vector<dtPolyRef> Find(NavMeshPathCache& cache, NavMeshPathCache::Key const& key, uint32 maxPath = MaxPath)
+{
+    std::vector<dtPolyRef> path(MaxPath);
+    path.resize(cache.Find(key, path.data(), maxPath));
+    return path;
+}
+}
+
+TEST_CASE("Cached paths are found by start and end poly", "[NavMeshPathCache]")
+{
+    NavMeshPathCache cache(8);
+    Insert(cache, { 1, 2, 3, 4, 5 });
+
+    REQUIRE(Find(cache, MakeKey(1, 5)) == std::vector<dtPolyRef>{ 1, 2, 3, 4, 5 });
+    REQUIRE(Find(cache, MakeKey(6, 7)).empty());
+
+    // a path longer than the caller's buffer is not returned
+    REQUIRE(Find(cache, MakeKey(1, 5), 4).empty());
+
+    NavMeshPathCache::Stats stats = cache.GetStats();
+    REQUIRE(stats.Hits == 1);
+    REQUIRE(stats.Misses == 2);
+    REQUIRE(stats.SavedMicroseconds == 100);
+}
+
+TEST_CASE("Parts of cached paths are reused", "[NavMeshPathCache]")
+{
+    NavMeshPathCache cache(8);
+    Insert(cache, { 1, 2, 3, 4, 5 });
+
+    REQUIRE(Find(cache, MakeKey(2, 4)) == std::vector<dtPolyRef>{ 2, 3, 4 });
+    REQUIRE(Find(cache, MakeKey(3, 3)) == std::vector<dtPolyRef>{ 3 });
+
+    // the path is only walked forwards
+    REQUIRE(Find(cache, MakeKey(4, 2)).empty());
+    REQUIRE(Find(cache, MakeKey(2, 6)).empty());
+    REQUIRE(Find(cache, MakeKey(2, 4), 2).empty());
+
+    // saved time is the share of the sub-path in the cached search
+    NavMeshPathCache::Stats stats = cache.GetStats();
+    REQUIRE(stats.Hits == 2);
+    REQUIRE(stats.Misses == 3);
+    REQUIRE(stats.SavedMicroseconds == 60 + 20);
+
+    // reused parts are not cached themselves
+    REQUIRE(cache.GetSize() == 1);
+}
+
+TEST_CASE("Only recently used paths are searched for parts", "[NavMeshPathCache]")
+{
+    NavMeshPathCache cache(64);
+    Insert(cache, { 1, 2, 3, 4, 5 });
+    for (dtPolyRef i = 0; i < 16; ++i)
+        Insert(cache, { 100 + i * 2, 101 + i * 2 });
+
+    REQUIRE(Find(cache, MakeKey(2, 4)).empty());
+
+    // an exact hit makes the path the most recently used one again
+    REQUIRE(Find(cache, MakeKey(1, 5)).size() == 5);
+    REQUIRE(Find(cache, MakeKey(2, 4)) == std::vector<dtPolyRef>{ 2, 3, 4 });
+}
+
+TEST_CASE("Paths are cached per query filter", "[NavMeshPathCache]")
+{
+    NavMeshPathCache cache(8);
+    Insert(cache, { 1, 2, 3, 4, 5 }, WalkFlags);
+
+    REQUIRE(Find(cache, MakeKey(1, 5, SwimFlags)).empty());
+    REQUIRE(Find(cache, MakeKey(2, 4, SwimFlags)).empty());
+    REQUIRE(Find(cache, MakeKey(1, 5, WalkFlags, SwimFlags)).empty());
+    REQUIRE(Find(cache, MakeKey(2, 4, WalkFlags, SwimFlags)).empty());
+
+    Insert(cache, { 1, 6, 5 }, SwimFlags);
+    REQUIRE(cache.GetSize() == 2);
+    REQUIRE(Find(cache, MakeKey(1, 5, SwimFlags)) == std::vector<dtPolyRef>{ 1, 6, 5 });
+    REQUIRE(Find(cache, MakeKey(1, 5, WalkFlags)) == std::vector<dtPolyRef>{ 1, 2, 3, 4, 5 });
+}
+
+TEST_CASE("Paths searched before an invalidation are not cached", "[NavMeshPathCache]")
+{
+    NavMeshPathCache cache(8);
+    Insert(cache, { 1, 2, 3 });
+
+    // a search starts, then a tile is loaded while it runs
+    uint32 generation = cache.GetGeneration();
+    cache.Invalidate();
+    REQUIRE(cache.GetSize() == 0);
+    REQUIRE(Find(cache, MakeKey(1, 3)).empty());
+
+    std::vector<dtPolyRef> stalePath = { 4, 5, 6 };
+    cache.Insert(MakeKey(4, 6), stalePath.data(), uint32(stalePath.size()), std::chrono::microseconds(100), generation);
+    REQUIRE(cache.GetSize() == 0);
+    REQUIRE(Find(cache, MakeKey(4, 6)).empty());
+
+    // searches started after the invalidation are cached again
+    Insert(cache, { 4, 7, 6 });
+    REQUIRE(Find(cache, MakeKey(4, 6)) == std::vector<dtPolyRef>{ 4, 7, 6 });
+}
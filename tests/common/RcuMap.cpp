@@ -0,0 +1,220 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "RcuMap.h"
+#include "Define.h"
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+TEST_CASE("Insert, find and erase", "[RcuMap]")
+{
+    Trinity::Containers::RcuMap<uint64, int*> map;
+    int a = 1, b = 2;
+
+    REQUIRE(map.Find(1) == nullptr);
+
+    map.Insert(1, &a);
+    map.Insert(2, &b);
+    REQUIRE(map.Find(1) == &a);
+    REQUIRE(map.Find(2) == &b);
+    REQUIRE(map.GetSize() == 2);
+
+    map.Insert(1, &b);
+    REQUIRE(map.Find(1) == &b);
+    REQUIRE(map.GetSize() == 2);
+
+    REQUIRE(map.Erase(1));
+    REQUIRE_FALSE(map.Erase(1));
+    REQUIRE(map.Find(1) == nullptr);
+    REQUIRE(map.Find(2) == &b);
+    REQUIRE(map.GetSize() == 1);
+}
+
+TEST_CASE("Growing keeps every entry", "[RcuMap]")
+{
+    Trinity::Containers::RcuMap<uint64, uint64> map;
+    for (uint64 i = 0; i < 1000; ++i)
+        map.Insert(i, i + 1);
+
+    for (uint64 i = 0; i < 1000; i += 2)
+        REQUIRE(map.Erase(i));
+
+    REQUIRE(map.GetSize() == 500);
+    for (uint64 i = 0; i < 1000; ++i)
+        REQUIRE(map.Find(i) == (i % 2 ? i + 1 : 0));
+}
+
+TEST_CASE("Retired nodes are kept while a reader is inside", "[RcuMap]")
+{
+    Trinity::Containers::RcuMap<uint64, uint64> map;
+    map.Insert(1, 10);
+    map.Insert(2, 20);
+
+    {
+        Trinity::Containers::RcuEpoch::ReadGuard guard;
+        map.Erase(1);
+        map.Insert(2, 21);
+        map.ReclaimRetired();
+        REQUIRE(map.GetRetiredCount() != 0);
+    }
+
+    map.ReclaimRetired();
+    REQUIRE(map.GetRetiredCount() == 0);
+    REQUIRE(map.Find(2) == 21);
+}
+
+TEST_CASE("Concurrent readers see consistent values", "[RcuMap]")
+{
+    Trinity::Containers::RcuMap<uint64, uint64> map;
+    for (uint64 i = 0; i < 64; ++i)
+        map.Insert(i, i * 2);
+
+    std::atomic<bool> stop(false);
+    std::atomic<uint64> badValues(0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&]()
+        {
+            while (!stop.load(std::memory_order_relaxed))
+                for (uint64 i = 0; i < 4096; ++i)
+                    if (uint64 value = map.Find(i, 0); value && value != i * 2)
+                        ++badValues;
+        });
+    }
+
+    // writes free retired memory on their own while readers keep walking the chains and tables
+    for (uint64 i = 64; i < 4096; ++i)
+        map.Insert(i, i * 2);
+    for (uint64 i = 0; i < 4096; i += 2)
+        map.Erase(i);
+
+    stop = true;
+    for (std::thread& reader : readers)
+        reader.join();
+
+    map.ReclaimRetired();
+    REQUIRE(badValues == 0);
+    REQUIRE(map.GetSize() == 2048);
+    REQUIRE(map.GetRetiredCount() == 0);
+}
+
+namespace
+{
+// lookups per second done by readerCount threads while one thread keeps inserting and erasing entries
+template<class Lookup, class Churn, class Quiesce>
+double MeasureLookups(std::size_t readerCount, Lookup lookup, Churn churn, Quiesce quiesce)
+{
+    constexpr int Rounds = 10;
+    constexpr std::chrono::milliseconds RoundDuration(50);
+
+    uint64 totalLookups = 0;
+    std::chrono::steady_clock::duration totalTime(0);
+    for (int round = 0; round < Rounds; ++round)
+    {
+        std::atomic<bool> stop(false);
+        std::atomic<uint64> lookups(0);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < readerCount; ++t)
+        {
+            threads.emplace_back([&, t]()
+            {
+                uint64 done = 0;
+                uint64 key = t;
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    lookup(key++ % 4096);
+                    ++done;
+                }
+                lookups += done;
+            });
+        }
+
+        threads.emplace_back([&]()
+        {
+            uint64 key = 4096;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                churn(key);
+                ++key;
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        });
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(RoundDuration);
+        stop = true;
+        for (std::thread& thread : threads)
+            thread.join();
+
+        totalTime += std::chrono::steady_clock::now() - start;
+        totalLookups += lookups;
+        quiesce();
+    }
+
+    return double(totalLookups) / std::chrono::duration<double>(totalTime).count();
+}
+}
+
+// not run by default, use tests-common "[.benchmark]"
+TEST_CASE("Lookup contention against shared_mutex", "[RcuMap][.benchmark]")
+{
+    std::size_t readerCount = std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1;
+
+    Trinity::Containers::RcuMap<uint64, uint64*> rcuMap;
+    std::mutex rcuWriteLock;
+    std::unordered_map<uint64, uint64*> lockedMap;
+    std::shared_mutex lock;
+    static uint64 value = 0;
+    for (uint64 i = 0; i < 3000; ++i)
+    {
+        rcuMap.Insert(i, &value);
+        lockedMap[i] = &value;
+    }
+
+    double rcuLookups = MeasureLookups(readerCount,
+        [&](uint64 key) { return rcuMap.Find(key) != nullptr; },
+        [&](uint64 key)
+        {
+            std::lock_guard<std::mutex> guard(rcuWriteLock);
+            rcuMap.Insert(key, &value);
+            rcuMap.Erase(key);
+        },
+        [&]() { rcuMap.ReclaimRetired(); });
+
+    double lockedLookups = MeasureLookups(readerCount,
+        [&](uint64 key)
+        {
+            std::shared_lock<std::shared_mutex> guard(lock);
+            return lockedMap.find(key) != lockedMap.end();
+        },
+        [&](uint64 key)
+        {
+            std::unique_lock<std::shared_mutex> guard(lock);
+            lockedMap[key] = &value;
+            lockedMap.erase(key);
+        },
+        []() { });
+
+    WARN(readerCount << " readers: RcuMap " << uint64(rcuLookups) << " lookups/s, shared_mutex " << uint64(lockedLookups) << " lookups/s");
+    CHECK(rcuLookups > 0);
+}
@@ -0,0 +1,113 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "tc_catch2.h"
+
+#include "SQLOperation.h"
+#include "SQLOperationQueue.h"
+#include <memory>
+
+namespace
+{
+struct TestOperation : SQLOperation
+{
+    explicit TestOperation(int id, uint32 fenceKey = DB_FENCE_NONE) : Id(id) { SetFenceKey(fenceKey); }
+
+    bool Execute() override { return true; }
+
+    int Id;
+};
+
+constexpr uint32 AllLanes = SQLOperationQueue::ALL_LANES;
+constexpr uint32 InteractiveLane = SQLOperationQueue::INTERACTIVE_LANE;
+
+// takes the next operation like a worker would, 0 if none may run yet
+int Take(SQLOperationQueue& queue, uint32 laneMask, std::unique_ptr<SQLOperation>& taken)
+{
+    SQLOperation* operation = nullptr;
+    if (!queue.Pop(operation, laneMask))
+        return 0;
+
+    taken.reset(operation);
+    return static_cast<TestOperation*>(operation)->Id;
+}
+}
+
+TEST_CASE("Fenced reads wait for queued writes of their key only", "[SQLOperationQueue]")
+{
+    SQLOperationQueue queue;
+    queue.Push(new TestOperation(1, 100), DB_QUEUE_PRIORITY_NORMAL);                // logout save of account 100
+    queue.Push(new TestOperation(2, 100), DB_QUEUE_PRIORITY_INTERACTIVE);           // its character list
+    queue.Push(new TestOperation(3, 200), DB_QUEUE_PRIORITY_INTERACTIVE);           // another account
+    queue.Push(new TestOperation(4), DB_QUEUE_PRIORITY_INTERACTIVE);
+
+    std::unique_ptr<SQLOperation> read;
+    REQUIRE(Take(queue, InteractiveLane, read) == 3);
+    REQUIRE(Take(queue, InteractiveLane, read) == 4);
+    REQUIRE(Take(queue, InteractiveLane, read) == 0);
+
+    // a write queued after the read does not hold it back
+    queue.Push(new TestOperation(5, 100), DB_QUEUE_PRIORITY_NORMAL);
+
+    std::unique_ptr<SQLOperation> write;
+    REQUIRE(Take(queue, AllLanes, write) == 1);
+    REQUIRE(Take(queue, InteractiveLane, read) == 0);   // still running
+
+    queue.Complete(write.get());
+    REQUIRE(Take(queue, InteractiveLane, read) == 2);
+    REQUIRE(Take(queue, AllLanes, write) == 5);
+    queue.Complete(write.get());
+}
+
+TEST_CASE("Normal lane fences wait for every normal operation queued before them", "[SQLOperationQueue]")
+{
+    SQLOperationQueue queue;
+    queue.Push(new TestOperation(1), DB_QUEUE_PRIORITY_NORMAL);
+    queue.Push(new TestOperation(2), DB_QUEUE_PRIORITY_BACKGROUND);
+    queue.Push(new TestOperation(3, DB_FENCE_NORMAL_LANE), DB_QUEUE_PRIORITY_INTERACTIVE);
+    queue.Push(new TestOperation(4), DB_QUEUE_PRIORITY_NORMAL);
+
+    std::unique_ptr<SQLOperation> read;
+    REQUIRE(Take(queue, InteractiveLane, read) == 0);
+
+    std::unique_ptr<SQLOperation> first;
+    std::unique_ptr<SQLOperation> second;
+    REQUIRE(Take(queue, AllLanes, first) == 1);
+    REQUIRE(Take(queue, AllLanes, second) == 4);
+    REQUIRE(Take(queue, InteractiveLane, read) == 0);
+
+    // operation 4 was queued after the read, only 1 has to be done
+    queue.Complete(first.get());
+    REQUIRE(Take(queue, InteractiveLane, read) == 3);
+    queue.Complete(second.get());
+}
+
+TEST_CASE("Workers serving all lanes run writes while fenced reads wait", "[SQLOperationQueue]")
+{
+    SQLOperationQueue queue;
+    queue.Push(new TestOperation(1, 100), DB_QUEUE_PRIORITY_BACKGROUND);
+    queue.Push(new TestOperation(2, 100), DB_QUEUE_PRIORITY_INTERACTIVE);
+
+    std::unique_ptr<SQLOperation> operation;
+    REQUIRE(Take(queue, AllLanes, operation) == 1);
+    REQUIRE(queue.Size(DB_QUEUE_PRIORITY_INTERACTIVE) == 1);
+
+    queue.Complete(operation.get());
+    REQUIRE(Take(queue, AllLanes, operation) == 2);
+    REQUIRE(queue.Size() == 0);
+}
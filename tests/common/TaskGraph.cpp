@@ -0,0 +1,93 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "TaskGraph.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Tasks run after their dependencies", "[TaskGraph]")
+{
+    for (std::size_t threads : { 1, 4 })
+    {
+        Trinity::TaskGraph graph;
+        std::mutex lock;
+        std::vector<std::string> order;
+        auto record = [&](std::string name)
+        {
+            return [&, name]()
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                order.push_back(name);
+            };
+        };
+
+        Trinity::TaskGraph::TaskId templates = graph.AddTask("templates", {}, record("templates"));
+        Trinity::TaskGraph::TaskId spells = graph.AddTask("spells", {}, record("spells"));
+        graph.AddTask("spawns", { templates }, record("spawns"));
+        graph.AddTask("conditions", { templates, spells }, record("conditions"));
+        graph.Run(threads);
+
+        REQUIRE(order.size() == 4);
+        auto position = [&](std::string const& name) { return std::find(order.begin(), order.end(), name) - order.begin(); };
+        REQUIRE(position("templates") < position("spawns"));
+        REQUIRE(position("templates") < position("conditions"));
+        REQUIRE(position("spells") < position("conditions"));
+        if (threads == 1)
+            REQUIRE(order == std::vector<std::string>{ "templates", "spells", "spawns", "conditions" });
+    }
+}
+
+TEST_CASE("Independent tasks run concurrently", "[TaskGraph]")
+{
+    Trinity::TaskGraph graph;
+    std::atomic<int> running(0);
+    std::atomic<int> maxRunning(0);
+    for (int i = 0; i < 4; ++i)
+    {
+        graph.AddTask("sleep", {}, [&]()
+        {
+            int now = ++running;
+            int seen = maxRunning;
+            while (now > seen && !maxRunning.compare_exchange_weak(seen, now));
+            std::this_thread::sleep_for(20ms);
+            --running;
+        });
+    }
+
+    graph.Run(4);
+    REQUIRE(maxRunning > 1);
+}
+
+TEST_CASE("Critical path follows the longest dependency chain", "[TaskGraph]")
+{
+    Trinity::TaskGraph graph;
+    Trinity::TaskGraph::TaskId shortTask = graph.AddTask("short", {}, []() { std::this_thread::sleep_for(1ms); });
+    Trinity::TaskGraph::TaskId longTask = graph.AddTask("long", {}, []() { std::this_thread::sleep_for(30ms); });
+    Trinity::TaskGraph::TaskId last = graph.AddTask("last", { shortTask, longTask }, []() { });
+    graph.AddTask("unrelated", {}, []() { });
+    graph.Run(2);
+
+    REQUIRE(graph.GetCriticalPath() == std::vector<Trinity::TaskGraph::TaskId>{ longTask, last });
+    REQUIRE(graph.GetTasks()[longTask].Duration >= 30ms);
+    REQUIRE(graph.GetDuration() >= graph.GetTasks()[longTask].Duration);
+}
@@ -0,0 +1,138 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "UpdateMask.h"
+#include <array>
+#include <chrono>
+#include <random>
+
+namespace
+{
+// player sized table with flags spread like the real one: mostly public, some private/owner/party fields
+struct FieldSet
+{
+    explicit FieldSet(uint32 changedPerMille)
+    {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<uint32> percent(0, 999);
+        uint32 const flagChoices[] = { 0x001, 0x002, 0x004, 0x040, 0x002 | 0x040, 0x100 | 0x001 };
+        for (uint32 index = 0; index < PLAYER_END; ++index)
+        {
+            Flags[index] = flagChoices[percent(rng) % std::size(flagChoices)];
+            ChangedBytes[index] = percent(rng) < changedPerMille;
+        }
+
+        ChangedBits.SetCount(PLAYER_END);
+        for (uint32 index = 0; index < PLAYER_END; ++index)
+            if (ChangedBytes[index])
+                ChangedBits.SetBit(index);
+    }
+
+    std::array<uint32, PLAYER_END> Flags;
+    std::array<uint8, PLAYER_END> ChangedBytes;
+    UpdateMask ChangedBits;
+};
+
+// previous implementation, one byte per field and flags tested for every field
+template<class Visitor>
+void ScanByteMask(FieldSet const& fields, uint32 notifyFlags, uint32 visibleFlag, Visitor&& visit)
+{
+    for (uint32 index = 0; index < PLAYER_END; ++index)
+        if (notifyFlags & fields.Flags[index] || (fields.ChangedBytes[index] && (fields.Flags[index] & visibleFlag)))
+            visit(index);
+}
+
+template<class Visitor>
+void ScanPackedMask(FieldSet const& fields, UpdateFieldFlagMasks const& flagMasks, uint32 notifyFlags, uint32 visibleFlag, Visitor&& visit)
+{
+    uint32 const blockCount = UpdateMask::GetBlockCount(PLAYER_END);
+    std::array<UpdateMask::BlockType, UPDATE_MASK_MAX_BLOCKS> blocks, forced;
+    flagMasks.Select(visibleFlag, blocks.data(), blockCount);
+    flagMasks.Select(notifyFlags, forced.data(), blockCount);
+    for (uint32 block = 0; block < blockCount; ++block)
+        for (UpdateMask::BlockType bits = (blocks[block] & fields.ChangedBits.GetBlock(block)) | forced[block]; bits; bits &= bits - 1)
+            visit(block * UpdateMask::BLOCK_BITS + UpdateMask::GetFirstSetBit(bits));
+}
+}
+
+TEST_CASE("Set, unset and read bits", "[UpdateMask]")
+{
+    UpdateMask mask;
+    mask.SetCount(130);
+    REQUIRE(mask.GetBlockCount() == 3);
+
+    mask.SetBit(0);
+    mask.SetBit(63);
+    mask.SetBit(64);
+    mask.SetBit(129);
+    REQUIRE(mask.GetBit(63));
+    REQUIRE_FALSE(mask.GetBit(62));
+    REQUIRE(mask.GetBlock(0) == ((UpdateMask::BlockType(1) << 63) | 1));
+    REQUIRE(mask.GetBlock(2) == 2);
+
+    mask.UnsetBit(63);
+    REQUIRE_FALSE(mask.GetBit(63));
+
+    mask.Clear();
+    REQUIRE(mask.GetBlock(0) == 0);
+    REQUIRE(mask.GetBlock(1) == 0);
+    REQUIRE(mask.GetBlock(2) == 0);
+
+    REQUIRE(UpdateMask::GetLastBlockMask(130) == 3);
+    REQUIRE(UpdateMask::GetLastBlockMask(128) == ~UpdateMask::BlockType(0));
+}
+
+TEST_CASE("Packed mask selects same fields as per field flag checks", "[UpdateMask]")
+{
+    FieldSet fields(50);
+    UpdateFieldFlagMasks flagMasks(fields.Flags.data(), PLAYER_END);
+
+    for (uint32 visibleFlag : { 0x001u, 0x001u | 0x002u, 0x001u | 0x004u | 0x040u })
+    {
+        std::vector<uint32> expected, packed;
+        ScanByteMask(fields, 0x100, visibleFlag, [&](uint32 index) { expected.push_back(index); });
+        ScanPackedMask(fields, flagMasks, 0x100, visibleFlag, [&](uint32 index) { packed.push_back(index); });
+        REQUIRE(packed == expected);
+    }
+}
+
+// not run by default, use tests-common "[.benchmark]"
+TEST_CASE("Dirty field scan against byte mask", "[UpdateMask][.benchmark]")
+{
+    FieldSet fields(20);
+    UpdateFieldFlagMasks flagMasks(fields.Flags.data(), PLAYER_END);
+    constexpr uint32 Iterations = 100000;
+
+    auto measure = [&](auto scan)
+    {
+        uint64 checksum = 0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < Iterations; ++i)
+            scan([&](uint32 index) { checksum += index; }, i % 2 ? 0x001u : 0x003u);
+
+        double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        return std::make_pair(nanoseconds / Iterations, checksum);
+    };
+
+    auto byteMask = measure([&](auto visit, uint32 visibleFlag) { ScanByteMask(fields, 0x100, visibleFlag, visit); });
+    auto packedMask = measure([&](auto visit, uint32 visibleFlag) { ScanPackedMask(fields, flagMasks, 0x100, visibleFlag, visit); });
+
+    WARN(PLAYER_END << " fields: byte mask " << byteMask.first << " ns/scan, packed mask " << packedMask.first << " ns/scan");
+    CHECK(byteMask.second == packedMask.second);
+}